@@ -505,6 +505,7 @@ extern "C" {
 
 // Make this visible to the outside.
 extern DdNode * cuddUniqueInter(DdManager *unique, int index, DdNode *T, DdNode *E);
+extern int cuddGarbageCollect(DdManager *unique, int clearCache);
     
 extern DdNode * Cudd_addNewVar(DdManager *dd);
 extern DdNode * Cudd_addNewVarAtLevel(DdManager *dd, int level);
@@ -495,6 +495,7 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
     } else if (ioSettings.isExplicitDRNSet()) {
         storm::parser::DirectEncodingParserOptions options;
         options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
+        options.parseValuesInParallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
         result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
     } else {
         STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
@@ -618,7 +619,8 @@ void exportSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>
             case storm::exporter::ModelExportFormat::Drn:
                 storm::api::exportSparseModelAsDrn(model, ioSettings.getExportBuildFilename(),
                                                    input.model ? input.model.get().getParameterNames() : std::vector<std::string>(),
-                                                   !ioSettings.isExplicitExportPlaceholdersDisabled());
+                                                   !ioSettings.isExplicitExportPlaceholdersDisabled(),
+                                                   storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet());
                 break;
             case storm::exporter::ModelExportFormat::Json:
                 storm::api::exportSparseModelAsJson(model, ioSettings.getExportBuildFilename());
@@ -634,7 +636,8 @@ void exportSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>
     if (ioSettings.isExportExplicitSet()) {
         storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(),
                                            input.model ? input.model.get().getParameterNames() : std::vector<std::string>(),
-                                           !ioSettings.isExplicitExportPlaceholdersDisabled());
+                                           !ioSettings.isExplicitExportPlaceholdersDisabled(),
+                                           storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet());
     }
 
     if (ioSettings.isExportDdSet()) {
@@ -755,7 +758,8 @@ std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessDdModel(std
         for (auto const& property : input.properties) {
             formulas.emplace_back(property.getRawFormula());
         }
-        result->first = storm::api::transformSymbolicToSparseModel(symbolicModel, formulas);
+        result->first = storm::api::transformSymbolicToSparseModel(
+            symbolicModel, formulas, storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdSparseStateOrder());
         STORM_LOG_THROW(result, storm::exceptions::NotSupportedException, "The translation to a sparse model is not supported for the given model type.");
     }
 
@@ -1094,6 +1098,93 @@ void verifyWithExplorationEngine(SymbolicInput const& input, ModelProcessingInfo
         });
 }
 
+template<typename ValueType>
+void writeTimePointCurves(std::ostream& stream, std::vector<double> const& timePoints, std::vector<std::string> const& names,
+                          std::vector<std::vector<ValueType>> const& curves) {
+    stream << "time";
+    for (auto const& name : names) {
+        stream << "," << name;
+    }
+    stream << '\n';
+    for (uint64_t timePointIndex = 0; timePointIndex < timePoints.size(); ++timePointIndex) {
+        stream << timePoints[timePointIndex];
+        for (auto const& curve : curves) {
+            stream << "," << storm::utility::convertNumber<double>(curve[timePointIndex]);
+        }
+        stream << '\n';
+    }
+}
+
+template<typename ValueType>
+void verifyTimePointsWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel, SymbolicInput const& input,
+                                      ModelProcessingInformation const& mpi) {
+    auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+    std::vector<double> timePoints = ioSettings.getTimePoints();
+    std::vector<std::string> names;
+    std::vector<std::vector<ValueType>> curves;
+    auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    for (auto const& property : properties) {
+        printModelCheckingProperty(property);
+        storm::utility::Stopwatch watch(true);
+        try {
+            auto const& states = property.getFilter().getStatesFormula();
+            bool filterForInitialStates = states->isInitialFormula();
+            auto results = storm::api::verifyWithSparseEngineForTimePoints<ValueType>(
+                mpi.env, sparseModel, storm::api::createTask<ValueType>(property.getRawFormula(), filterForInitialStates), timePoints);
+
+            std::unique_ptr<storm::modelchecker::CheckResult> filter;
+            if (filterForInitialStates) {
+                filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
+            } else {
+                filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(states, false));
+            }
+            storm::modelchecker::FilterType filterType = property.getFilter().getFilterType();
+            STORM_LOG_THROW(filterType != storm::modelchecker::FilterType::VALUES || filter->asQualitativeCheckResult().count() == 1,
+                            storm::exceptions::NotSupportedException, "Curves require a single value per time point. Consider filtering, e.g., with 'avg'.");
+
+            std::vector<ValueType> curve;
+            curve.reserve(results.size());
+            for (auto& result : results) {
+                result->filter(filter->asQualitativeCheckResult());
+                auto const& quantitativeResult = result->asQuantitativeCheckResult<ValueType>();
+                switch (filterType) {
+                    case storm::modelchecker::FilterType::VALUES:
+                    case storm::modelchecker::FilterType::MIN:
+                        curve.push_back(quantitativeResult.getMin());
+                        break;
+                    case storm::modelchecker::FilterType::MAX:
+                        curve.push_back(quantitativeResult.getMax());
+                        break;
+                    case storm::modelchecker::FilterType::SUM:
+                        curve.push_back(quantitativeResult.sum());
+                        break;
+                    case storm::modelchecker::FilterType::AVG:
+                        curve.push_back(quantitativeResult.average());
+                        break;
+                    default:
+                        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Filter type is not supported for curves.");
+                }
+            }
+            names.push_back(property.getName());
+            curves.push_back(std::move(curve));
+        } catch (storm::exceptions::BaseException const& ex) {
+            STORM_LOG_WARN("Cannot handle property: " << ex.what());
+        }
+        watch.stop();
+        STORM_PRINT("Time for model checking: " << watch << ".\n");
+    }
+
+    if (ioSettings.isExportCurveSet()) {
+        std::ofstream stream;
+        storm::utility::openFile(ioSettings.getExportCurveFilename(), stream);
+        writeTimePointCurves(stream, timePoints, names, curves);
+        storm::utility::closeFile(stream);
+    } else {
+        STORM_PRINT('\n');
+        writeTimePointCurves(std::cout, timePoints, names, curves);
+    }
+}
+
 template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
@@ -1158,7 +1249,11 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
         }
         ++exportCount;
     };
-    verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback);
+    if (ioSettings.isTimePointsSet()) {
+        verifyTimePointsWithSparseEngine<ValueType>(sparseModel, input, mpi);
+    } else {
+        verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback);
+    }
     if (ioSettings.isComputeSteadyStateDistributionSet()) {
         storm::utility::Stopwatch watch(true);
         std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -1,8 +1,12 @@
 #include "DftNextStateGenerator.h"
 
+#include <type_traits>
+
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -15,6 +19,11 @@ DftNextStateGenerator<ValueType, StateType>::DftNextStateGenerator(storm::dft::s
     : mDft(dft), mStateGenerationInfo(stateGenerationInfo), state(nullptr), uniqueFailedState(false) {
     deterministicModel = !mDft.canHaveNondeterminism();
     mTakeFirstDependency = storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().isTakeFirstDependency();
+#ifdef STORM_HAVE_INTELTBB
+    // Successor states are only computed in parallel for floating point values as operations on exact values are not necessarily thread-safe.
+    mParallelExploration =
+        std::is_same<ValueType, double>::value && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#endif
 }
 
 template<typename ValueType, typename StateType>
@@ -132,8 +141,15 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
 
     storm::generator::Choice<ValueType, StateType> choice(0, !exploreDependencies);
 
+    // For BE failures, all successors are explored and can therefore be computed beforehand
+    std::vector<DFTStatePointer> precomputedSuccessors;
+    if (!exploreDependencies) {
+        precomputedSuccessors = createBESuccessorStatesInParallel();
+    }
+    size_t failableIndex = 0;
+
     // Let BE fail
-    for (; iterFailable != state->getFailableElements().end(!exploreDependencies); ++iterFailable) {
+    for (; iterFailable != state->getFailableElements().end(!exploreDependencies); ++iterFailable, ++failableIndex) {
         // Get BE which fails next
         std::pair<std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>,
                   std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const>>
@@ -145,7 +161,13 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
         STORM_LOG_ASSERT((dependency != nullptr) == exploreDependencies, "Failure due to dependencies does not match.");
 
         // Obtain successor state by propagating failure
-        DFTStatePointer newState = createSuccessorState(state, nextBE, dependency);
+        DFTStatePointer newState;
+        if (precomputedSuccessors.empty()) {
+            newState = createSuccessorState(state, nextBE, dependency);
+        } else {
+            STORM_LOG_ASSERT(failableIndex < precomputedSuccessors.size(), "Successor state for failure of " << nextBE->name() << " was not computed.");
+            newState = precomputedSuccessors[failableIndex];
+        }
 
         if (newState->isInvalid() || newState->isTransient()) {
             STORM_LOG_TRACE("State is ignored because " << (newState->isInvalid() ? "it is invalid" : "the transient fault is ignored"));
@@ -226,6 +248,36 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
     return result;
 }
 
+template<typename ValueType, typename StateType>
+std::vector<typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer>
+DftNextStateGenerator<ValueType, StateType>::createBESuccessorStatesInParallel() const {
+    std::vector<DFTStatePointer> successors;
+#ifdef STORM_HAVE_INTELTBB
+    if (!mParallelExploration) {
+        return successors;
+    }
+    // Collect failable BEs in the order of exploration
+    std::vector<std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>> failableBEs;
+    for (auto iterFailable = state->getFailableElements().begin(true); iterFailable != state->getFailableElements().end(true); ++iterFailable) {
+        failableBEs.push_back(iterFailable.getFailBE(mDft).first);
+    }
+    if (failableBEs.size() < MIN_FAILABLE_BES_PARALLEL_EXPLORATION) {
+        return successors;
+    }
+
+    // Each successor is a copy of the current state on which the failure is propagated independently
+    successors.resize(failableBEs.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, failableBEs.size()), [&](tbb::blocked_range<size_t> const& range) {
+        std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> noDependency = nullptr;
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            auto failedBE = failableBEs[i];
+            successors[i] = createSuccessorState(state, failedBE, noDependency);
+        }
+    });
+#endif
+    return successors;
+}
+
 template<typename ValueType, typename StateType>
 typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(
     DFTStatePointer const state, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& failedBE,
@@ -99,6 +99,14 @@ class DftNextStateGenerator {
     storm::generator::StateBehavior<ValueType, StateType> exploreState(StateToIdCallback const& stateToIdCallback, bool exploreDependencies,
                                                                        bool takeFirstDependency);
 
+    /*!
+     * Create the successor states for the failures of all currently failable BEs of the current state in parallel.
+     * Only the successor states are computed, registering them via the callback is still done sequentially.
+     *
+     * @return The successor states in the order of the failable BEs or an empty vector if the successors should be computed sequentially instead.
+     */
+    std::vector<DFTStatePointer> createBESuccessorStatesInParallel() const;
+
     // The dft used for the generation of next states.
     storm::dft::storage::DFT<ValueType> const& mDft;
 
@@ -116,6 +124,12 @@ class DftNextStateGenerator {
 
     // Flag indicating whether only the first dependency (instead of all) should be explored.
     bool mTakeFirstDependency = false;
+
+    // Flag indicating whether the successor states of BE failures are computed in parallel.
+    bool mParallelExploration = false;
+
+    // Minimal number of failable BEs for which the successor states are computed in parallel.
+    static const size_t MIN_FAILABLE_BES_PARALLEL_EXPLORATION = 16;
 };
 
 }  // namespace generator
@@ -250,7 +250,7 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> DFTModelChecker<ValueTyp
             }
         }
         if (printInfo) {
-            composedModel->printModelInformationToStream(std::cout);
+            composedModel->printModelInformationToStream(outputStream);
         }
         return composedModel;
     } else {
@@ -275,7 +275,7 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> DFTModelChecker<ValueTyp
         builder.buildModel(0, 0.0);
         std::shared_ptr<storm::models::sparse::Model<ValueType>> model = builder.getModel();
         if (printInfo) {
-            model->printModelInformationToStream(std::cout);
+            model->printModelInformationToStream(outputStream);
         }
         explorationTimer.stop();
         STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Ctmc), storm::exceptions::NotSupportedException,
@@ -342,8 +342,8 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
             model = builder.getModelApproximation(true, !probabilityFormula);
             // We only output the info from the lower bound as the info for the upper bound is the same
             if (printInfo && dftIOSettings.isShowDftStatisticsSet()) {
-                std::cout << "Model in iteration " << (iteration + 1) << ":\n";
-                model->printModelInformationToStream(std::cout);
+                outputStream << "Model in iteration " << (iteration + 1) << ":\n";
+                model->printModelInformationToStream(outputStream);
             }
             buildingTimer.stop();
 
@@ -377,10 +377,10 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
                              "Under-approximation " << approxResult.first << " is greater than over-approximation " << approxResult.second);
             totalTimer.stop();
             if (printInfo && dftIOSettings.isShowDftStatisticsSet()) {
-                std::cout << "Result after iteration " << (iteration + 1) << ": (" << std::setprecision(10) << approxResult.first << ", " << approxResult.second
-                          << ")\n";
-                printTimings();
-                std::cout << '\n';
+                outputStream << "Result after iteration " << (iteration + 1) << ": (" << std::setprecision(10) << approxResult.first << ", "
+                             << approxResult.second << ")\n";
+                printTimings(outputStream);
+                outputStream << '\n';
             } else {
                 STORM_LOG_DEBUG("Result after iteration " << (iteration + 1) << ": (" << std::setprecision(10) << approxResult.first << ", "
                                                           << approxResult.second << ")");
@@ -394,7 +394,7 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
 
         // STORM_LOG_INFO("Finished approximation after " << iteration << " iteration" << (iteration > 1 ? "s." : "."));
         if (printInfo) {
-            model->printModelInformationToStream(std::cout);
+            model->printModelInformationToStream(outputStream);
         }
         dft_results results;
         results.push_back(approxResult);
@@ -414,7 +414,7 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
 
         // Print model information
         if (printInfo) {
-            model->printModelInformationToStream(std::cout);
+            model->printModelInformationToStream(outputStream);
         }
 
         // Export the model if required
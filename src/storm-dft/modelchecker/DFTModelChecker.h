@@ -34,8 +34,11 @@ class DFTModelChecker {
 
     /*!
      * Constructor.
+     *
+     * @param printOutput Flag whether information about the built models should be printed.
+     * @param outputStream Output stream to print the information to.
      */
-    DFTModelChecker(bool printOutput) : printInfo(printOutput) {}
+    DFTModelChecker(bool printOutput, std::ostream& outputStream = std::cout) : printInfo(printOutput), outputStream(outputStream) {}
 
     /*!
      * Main method for checking DFTs.
@@ -76,6 +79,7 @@ class DFTModelChecker {
 
    private:
     bool printInfo;
+    std::ostream& outputStream;
 
     // Timing values
     storm::utility::Stopwatch buildingTimer;
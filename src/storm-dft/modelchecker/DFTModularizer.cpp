@@ -1,3 +1,5 @@
+#include <memory>
+#include <set>
 #include <sstream>
 
 #include "storm-dft/adapters/SFTBDDPropertyFormulaAdapter.h"
@@ -5,8 +7,13 @@
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/modelchecker/DFTModularizer.h"
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
+#include "storm-dft/storage/DFTIsomorphism.h"
 #include "storm-parsers/api/properties.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/api/properties.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/IOSettings.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -168,14 +175,128 @@ void DFTModularizer::populateElementInfos(DFTElementCPointer const element) {
 }
 
 void DFTModularizer::replaceDynamicModules(DFTElementCPointer const element, std::vector<ValueType> const &timepoints) {
+    std::vector<DFTElementCPointer> dynamicModules{};
+    collectDynamicModules(element, dynamicModules);
+    if (dynamicModules.empty()) {
+        return;
+    }
+
+    // Group isomorphic modules as they have the same failure probabilities.
+    // Modules are only grouped once as the ids in workDFT coincide with the ids in dft at this point.
+    std::unique_ptr<storm::dft::storage::DFTColouring<ValueType>> colouring{};
+    std::vector<ElementId> representatives{};
+    for (auto const &[moduleId, representativeId] : dynamicModuleRepresentatives) {
+        if (moduleId == representativeId) {
+            representatives.push_back(moduleId);
+        }
+    }
+    for (auto const &module : dynamicModules) {
+        if (dynamicModuleRepresentatives.count(module->id()) > 0) {
+            continue;
+        }
+        if (!colouring) {
+            colouring = std::make_unique<storm::dft::storage::DFTColouring<ValueType>>(dft->colourDFT());
+        }
+        auto representativeId{module->id()};
+        for (auto const candidateId : representatives) {
+            if (!dft->findBijection(candidateId, module->id(), *colouring, false).empty()) {
+                STORM_LOG_DEBUG("Dynamic module " << module->name() << " is isomorphic to " << dft->getElement(candidateId)->name() << ".");
+                representativeId = candidateId;
+                break;
+            }
+        }
+        if (representativeId == module->id()) {
+            representatives.push_back(representativeId);
+        }
+        dynamicModuleRepresentatives[module->id()] = representativeId;
+    }
+
+    // Collect the representatives which still need to be analysed for some timepoints
+    std::set<ElementId> usedRepresentatives{};
+    for (auto const &module : dynamicModules) {
+        usedRepresentatives.insert(dynamicModuleRepresentatives.at(module->id()));
+    }
+    std::vector<ElementId> modulesToAnalyse{};
+    std::vector<std::vector<ValueType>> timepointsToAnalyse{};
+    for (auto const representativeId : usedRepresentatives) {
+        auto const &cachedResults{dynamicModuleResults[representativeId]};
+        std::vector<ValueType> missingTimepoints{};
+        for (auto const timebound : timepoints) {
+            if (cachedResults.count(timebound) == 0) {
+                missingTimepoints.push_back(timebound);
+            }
+        }
+        if (!missingTimepoints.empty()) {
+            modulesToAnalyse.push_back(representativeId);
+            timepointsToAnalyse.push_back(std::move(missingTimepoints));
+        }
+    }
+
+    // Prepare the analysis sequentially
+    std::vector<std::shared_ptr<storm::dft::storage::DFT<ValueType>>> subDFTs{};
+    std::vector<FormulaVector> properties{};
+    for (size_t i{0}; i < modulesToAnalyse.size(); ++i) {
+        auto subDFT{getSubDFT(workDFT->getElement(modulesToAnalyse[i]))};
+        subDFT->checkWellFormedness(true, std::cout);
+        subDFTs.push_back(subDFT);
+
+        std::stringstream propertyStream{};
+        for (auto const timebound : timepointsToAnalyse[i]) {
+            propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+        }
+        properties.push_back(storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str())));
+    }
+
+    // Analyse the independent modules
+    std::vector<std::map<ValueType, ValueType>> results(modulesToAnalyse.size());
+    std::vector<std::stringstream> outputs(modulesToAnalyse.size());
+#ifdef STORM_HAVE_INTELTBB
+    // The model checker exports each built model to the same file, so modules are only analysed in parallel if no model is exported.
+    auto const &ioSettings{storm::settings::getModule<storm::settings::modules::IOSettings>()};
+    bool const exportModels{ioSettings.isExportExplicitSet() || ioSettings.isExportDotSet()};
+    STORM_LOG_WARN_COND(!exportModels || !storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet(),
+                        "Dynamic modules are analysed sequentially as the built models are exported.");
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() && !exportModels) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, modulesToAnalyse.size(), 1), [&](tbb::blocked_range<size_t> const &range) {
+            for (size_t i{range.begin()}; i < range.end(); ++i) {
+                results[i] = analyseDynamic(*subDFTs[i], properties[i], timepointsToAnalyse[i], outputs[i]);
+            }
+        });
+    } else {
+#endif
+        for (size_t i{0}; i < modulesToAnalyse.size(); ++i) {
+            results[i] = analyseDynamic(*subDFTs[i], properties[i], timepointsToAnalyse[i], outputs[i]);
+        }
+#ifdef STORM_HAVE_INTELTBB
+    }
+#endif
+    for (size_t i{0}; i < modulesToAnalyse.size(); ++i) {
+        std::cout << outputs[i].str();
+        dynamicModuleResults[modulesToAnalyse[i]].insert(results[i].begin(), results[i].end());
+    }
+    numberOfDynamicModuleAnalyses += modulesToAnalyse.size();
+
+    // Replace all dynamic modules at once
+    std::map<std::string, std::map<ValueType, ValueType>> activeSamples{};
+    for (auto const &module : dynamicModules) {
+        auto const &cachedResults{dynamicModuleResults.at(dynamicModuleRepresentatives.at(module->id()))};
+        auto &samples{activeSamples[module->name()]};
+        for (auto const timebound : timepoints) {
+            samples[timebound] = cachedResults.at(timebound);
+        }
+    }
+    updateWorkDFT(activeSamples);
+}
+
+void DFTModularizer::collectDynamicModules(DFTElementCPointer const element, std::vector<DFTElementCPointer> &dynamicModules) const {
     if (element->isGate()) {
-        auto &elementInfo{elementInfos.at(element->id())};
+        auto const &elementInfo{elementInfos.at(element->id())};
         if (elementInfo.isModule && !elementInfo.isStatic) {
-            analyseDynamic(element, timepoints);
+            dynamicModules.push_back(element);
         } else {
             auto const parent{std::static_pointer_cast<storm::dft::storage::elements::DFTChildren<ValueType> const>(element)};
             for (auto const &child : parent->children()) {
-                replaceDynamicModules(child, timepoints);
+                collectDynamicModules(child, dynamicModules);
             }
         }
     } else if (!element->isBasicElement()) {
@@ -207,19 +328,20 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DFTModularizer::getSubDFT(D
     return dft;
 }
 
-void DFTModularizer::updateWorkDFT(DFTElementCPointer const element, std::map<ValueType, ValueType> activeSamples) {
+void DFTModularizer::updateWorkDFT(std::map<std::string, std::map<ValueType, ValueType>> const &activeSamples) {
     storm::dft::builder::DFTBuilder<ValueType> builder{};
     std::unordered_set<std::string> depInConflict;
     for (auto const id : workDFT->getAllIds()) {
         auto const tmpElement{workDFT->getElement(id)};
-        if (tmpElement->name() != element->name()) {
+        auto const it{activeSamples.find(tmpElement->name())};
+        if (it == activeSamples.end()) {
             builder.copyElement(tmpElement);
             // Remember dependency conflict
             if (tmpElement->isDependency() && workDFT->isDependencyInConflict(id)) {
                 depInConflict.insert(tmpElement->name());
             }
         } else {
-            builder.addBasicElementSamples(element->name(), activeSamples);
+            builder.addBasicElementSamples(tmpElement->name(), it->second);
         }
     }
     builder.setTopLevel(workDFT->getTopLevelElement()->name());
@@ -234,25 +356,13 @@ void DFTModularizer::updateWorkDFT(DFTElementCPointer const element, std::map<Va
     }
 }
 
-void DFTModularizer::analyseDynamic(DFTElementCPointer const element, std::vector<ValueType> const &timepoints) {
-    // Check that analysis is needed
-    if (workDFT->getElement(element->id())->isBasicElement()) {
-        return;
-    }
-    auto subDFT{getSubDFT(element)};
-    subDFT->checkWellFormedness(true, std::cout);
+std::map<ValueType, ValueType> DFTModularizer::analyseDynamic(storm::dft::storage::DFT<ValueType> const &subDFT, FormulaVector const &properties,
+                                                              std::vector<ValueType> const &timepoints, std::ostream &os) {
+    // Model information is printed to the given stream, as the modules might be analysed in parallel
+    storm::dft::modelchecker::DFTModelChecker<ValueType> checker{true, os};
+    auto const result{checker.check(subDFT, properties, false, false, {})};
 
-    storm::dft::modelchecker::DFTModelChecker<ValueType> checker{true};
-    std::stringstream propertyStream{};
-
-    for (auto const timebound : timepoints) {
-        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
-    }
-
-    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
-    auto const result{checker.check(*subDFT, props, false, false, {})};
-
-    checker.printResults(result);
+    checker.printResults(result, os);
 
     std::map<ValueType, ValueType> activeSamples{};
     for (size_t i{0}; i < timepoints.size(); ++i) {
@@ -260,8 +370,7 @@ void DFTModularizer::analyseDynamic(DFTElementCPointer const element, std::vecto
         auto const timebound{timepoints[i]};
         activeSamples[timebound] = probability;
     }
-
-    updateWorkDFT(element, activeSamples);
+    return activeSamples;
 }
 
 }  // namespace modelchecker
@@ -56,6 +56,17 @@ class DFTModularizer {
         return result.at(0);
     }
 
+    /**
+     * \return
+     * The number of analyses of dynamic modules performed so far.
+     *
+     * \note
+     * Isomorphic modules and timepoints that were analysed before do not require a new analysis.
+     */
+    uint64_t getNumberOfDynamicModuleAnalyses() const {
+        return numberOfDynamicModuleAnalyses;
+    }
+
    private:
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> workDFT{};
@@ -127,8 +138,19 @@ class DFTModularizer {
 
     /**
      * Calculate dynamic Modules and replace them with BE's in workDFT
+     *
+     * \note
+     * Isomorphic dynamic modules are only analysed once and the results
+     * are cached across calls.
+     * If Intel TBB is enabled, the dynamic modules are analysed in parallel.
      */
     void replaceDynamicModules(DFTElementCPointer const element, std::vector<ValueType> const &timepoints);
+
+    /**
+     * Collect the topmost dynamic modules below the given element.
+     */
+    void collectDynamicModules(DFTElementCPointer const element, std::vector<DFTElementCPointer> &dynamicModules) const;
+
     /**
      * \return DFT with the given element as the root
      */
@@ -136,17 +158,39 @@ class DFTModularizer {
 
     /**
      * Update the workdDFT.
-     * Replace the given element with a sample BE
+     * Replace each of the given elements with a sample BE
+     *
+     * \param activeSamples
+     * Mapping from the names of the elements to replace to their samples.
      */
-    void updateWorkDFT(DFTElementCPointer const element, std::map<ValueType, ValueType> activeSamples);
+    void updateWorkDFT(std::map<std::string, std::map<ValueType, ValueType>> const &activeSamples);
 
     /**
-     * Analyse the dynamic module with the given element as the root.
+     * Analyse the given dynamic module.
+     *
+     * \param properties
+     * The properties for the failure probabilities at the given timepoints.
+     *
+     * \param os
+     * Stream the results of the analysis are printed to.
+     *
+     * \return
+     * The failure probability of the module for each of the timepoints.
      *
      * \note
-     * Updates the workDFT with the calculated probability
+     * Does not access the modularizer and can therefore be called concurrently.
      */
-    void analyseDynamic(DFTElementCPointer const element, std::vector<ValueType> const &timepoints);
+    static std::map<ValueType, ValueType> analyseDynamic(storm::dft::storage::DFT<ValueType> const &subDFT, FormulaVector const &properties,
+                                                         std::vector<ValueType> const &timepoints, std::ostream &os);
+
+    // Mapping from (the ids of) dynamic modules to the representative of the class of isomorphic modules.
+    std::map<ElementId, ElementId> dynamicModuleRepresentatives{};
+
+    // Cached results of the dynamic modules, i.e. a mapping from the representatives
+    // to the failure probability for each timepoint that was analysed before.
+    std::map<ElementId, std::map<ValueType, ValueType>> dynamicModuleResults{};
+
+    uint64_t numberOfDynamicModuleAnalyses{0};
 
     // don't reinitialize Sylvan BDD
     // temporary
@@ -1,11 +1,16 @@
 #include <gmm/gmm_std.h>
 
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/eigen.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -235,6 +240,199 @@ Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t
     bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
     return &bddToBirnbaumFactorsElement.second;
 }
+
+/**
+ * Flattened copy of a bdd that computes the probability of the bdd
+ * together with its partial derivatives with respect to
+ * the probabilities of all variables in a single pass.
+ *
+ * The partial derivative with respect to a variable is exactly its birnbaum factor.
+ * It is computed in reverse mode:
+ * The adjoint of a node is the sum over all paths from the root to the node
+ * of the probability to take that path.
+ * The derivative with respect to a variable is then the sum over
+ * all nodes labelled with the variable of
+ * adjoint * (probability of then child - probability of else child).
+ *
+ * \note
+ * Only the constructor accesses sylvan.
+ * The computations work on plain arrays,
+ * where the nodes of one layer are independent of each other
+ * and are processed in parallel if enabled.
+ */
+class BddDerivatives {
+   public:
+    BddDerivatives(Bdd const bdd) {
+        // Index 0 and 1 are reserved for the terminals
+        nodes.resize(2);
+        std::unordered_map<uint64_t, size_t> bddToIndex{};
+        root = addNode(bdd, bddToIndex);
+
+        // Compute layers bottom up (children before parents)
+        std::vector<size_t> height(nodes.size(), 0);
+        for (size_t node{2}; node < nodes.size(); ++node) {
+            // Nodes are added after their children
+            height[node] = 1 + std::max(height[nodes[node].thenIndex], height[nodes[node].elseIndex]);
+            if (height[node] > bottomUpLayers.size()) {
+                bottomUpLayers.resize(height[node]);
+            }
+            bottomUpLayers[height[node] - 1].push_back(node);
+        }
+
+        // Compute layers top down (parents before children)
+        parents.resize(nodes.size());
+        std::vector<size_t> depth(nodes.size(), 0);
+        for (size_t node{nodes.size() - 1}; node >= 2; --node) {
+            for (auto const child : {nodes[node].thenIndex, nodes[node].elseIndex}) {
+                parents[child].push_back(node);
+                depth[child] = std::max(depth[child], depth[node] + 1);
+            }
+        }
+        for (size_t node{2}; node < nodes.size(); ++node) {
+            if (depth[node] >= topDownLayers.size()) {
+                topDownLayers.resize(depth[node] + 1);
+            }
+            topDownLayers[depth[node]].push_back(node);
+        }
+
+        for (size_t node{2}; node < nodes.size(); ++node) {
+            varToNodes[nodes[node].var].push_back(node);
+        }
+        variables.reserve(varToNodes.size());
+        for (auto const &i : varToNodes) {
+            variables.push_back(i.first);
+        }
+    }
+
+    /**
+     * Computes the probabilities and derivatives
+     * given the probabilities of the variables.
+     */
+    void compute(size_t const chunksize, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities, bool const parallel) {
+        probabilities.resize(nodes.size());
+        adjoints.resize(nodes.size());
+        probabilities[0] = Eigen::ArrayXd::Constant(chunksize, 0);
+        probabilities[1] = Eigen::ArrayXd::Constant(chunksize, 1);
+
+        // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
+        for (auto const &layer : bottomUpLayers) {
+            forAll(layer.size(), parallel, [&](size_t const i) {
+                auto const &node{nodes[layer[i]]};
+                auto const &currentProbabilities{indexToProbabilities.at(node.var)};
+                probabilities[layer[i]] =
+                    currentProbabilities * probabilities[node.thenIndex] + (1 - currentProbabilities) * probabilities[node.elseIndex];
+            });
+        }
+
+        // Propagate adjoints from the root to the children
+        for (auto const &layer : topDownLayers) {
+            forAll(layer.size(), parallel, [&](size_t const i) {
+                auto const nodeIndex{layer[i]};
+                auto &adjoint{adjoints[nodeIndex]};
+                adjoint = Eigen::ArrayXd::Constant(chunksize, nodeIndex == root ? 1 : 0);
+                for (auto const parentIndex : parents[nodeIndex]) {
+                    auto const &parent{nodes[parentIndex]};
+                    auto const &parentProbabilities{indexToProbabilities.at(parent.var)};
+                    if (parent.thenIndex == nodeIndex) {
+                        adjoint += adjoints[parentIndex] * parentProbabilities;
+                    } else {
+                        adjoint += adjoints[parentIndex] * (1 - parentProbabilities);
+                    }
+                }
+            });
+        }
+
+        // Accumulate derivatives per variable
+        derivatives.resize(variables.size());
+        forAll(variables.size(), parallel, [&](size_t const i) {
+            auto &derivative{derivatives[i]};
+            derivative = Eigen::ArrayXd::Constant(chunksize, 0);
+            for (auto const nodeIndex : varToNodes.at(variables[i])) {
+                auto const &node{nodes[nodeIndex]};
+                derivative += adjoints[nodeIndex] * (probabilities[node.thenIndex] - probabilities[node.elseIndex]);
+            }
+        });
+        zeroDerivative = Eigen::ArrayXd::Constant(chunksize, 0);
+    }
+
+    /**
+     * \return The probabilities of the bdd computed by the last call to compute.
+     */
+    Eigen::ArrayXd const &getProbabilities() const {
+        return probabilities[root];
+    }
+
+    /**
+     * \return The derivatives with respect to the given variable computed by the last call to compute.
+     */
+    Eigen::ArrayXd const &getDerivatives(uint32_t const variableIndex) const {
+        auto const it{std::lower_bound(variables.begin(), variables.end(), variableIndex)};
+        if (it == variables.end() || *it != variableIndex) {
+            // The bdd does not depend on the variable
+            return zeroDerivative;
+        }
+        return derivatives[it - variables.begin()];
+    }
+
+   private:
+    struct Node {
+        uint32_t var{0};
+        size_t thenIndex{0};
+        size_t elseIndex{0};
+    };
+
+    size_t addNode(Bdd const bdd, std::unordered_map<uint64_t, size_t> &bddToIndex) {
+        if (bdd.isZero()) {
+            return 0;
+        } else if (bdd.isOne()) {
+            return 1;
+        }
+
+        auto const it{bddToIndex.find(bdd.GetBDD())};
+        if (it != bddToIndex.end()) {
+            return it->second;
+        }
+
+        Node node{};
+        node.var = bdd.TopVar();
+        node.thenIndex = addNode(bdd.Then(), bddToIndex);
+        node.elseIndex = addNode(bdd.Else(), bddToIndex);
+        nodes.push_back(node);
+        bddToIndex[bdd.GetBDD()] = nodes.size() - 1;
+        return nodes.size() - 1;
+    }
+
+    template<typename FuncType>
+    static void forAll(size_t const size, bool const parallel, FuncType func) {
+#ifdef STORM_HAVE_INTELTBB
+        if (parallel) {
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, size, 16), [&](tbb::blocked_range<size_t> const &range) {
+                for (size_t i{range.begin()}; i < range.end(); ++i) {
+                    func(i);
+                }
+            });
+            return;
+        }
+#endif
+        for (size_t i{0}; i < size; ++i) {
+            func(i);
+        }
+    }
+
+    std::vector<Node> nodes{};
+    size_t root{0};
+    std::vector<std::vector<size_t>> bottomUpLayers{};
+    std::vector<std::vector<size_t>> topDownLayers{};
+    std::vector<std::vector<size_t>> parents{};
+    std::map<uint32_t, std::vector<size_t>> varToNodes{};
+    // Sorted variables occurring in the bdd
+    std::vector<uint32_t> variables{};
+
+    std::vector<Eigen::ArrayXd> probabilities{};
+    std::vector<Eigen::ArrayXd> adjoints{};
+    std::vector<Eigen::ArrayXd> derivatives{};
+    Eigen::ArrayXd zeroDerivative{};
+};
 }  // namespace
 
 SFTBDDChecker::SFTBDDChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager)
@@ -391,26 +589,12 @@ ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beNa
 
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueType timebound, FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    auto const resultsAtTimepoints{getAllImportanceMeasuresAtTimepoints({timebound}, 0, func)};
 
     std::vector<ValueType> resultVector{};
-    resultVector.reserve(getDFT()->getBasicElements().size());
-
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
-    std::map<uint64_t, ValueType> bddToProbability{};
-
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
-
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const index{getSylvanBddManager()->getIndex(be->name())};
-        std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
-        auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-        auto const &beProbability{indexToProbability[index]};
-        resultVector.push_back(func(beProbability, probability, birnbaumFactor));
+    resultVector.reserve(resultsAtTimepoints.size());
+    for (auto const &i : resultsAtTimepoints) {
+        resultVector.push_back(i.at(0));
     }
     return resultVector;
 }
@@ -452,50 +636,49 @@ std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::str
 }
 
 template<typename FuncType>
-std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize,
-                                                                                        FuncType func) {
+void SFTBDDChecker::forAllBirnbaumFactorsAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func) {
     auto const bdd{getTopLevelElementBdd()};
     auto const basicElements{getDFT()->getBasicElements()};
 
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<std::vector<ValueType>> resultVector{};
-    resultVector.resize(getDFT()->getBasicElements().size());
-    for (auto &i : resultVector) {
-        i.reserve(timepoints.size());
-    }
+    bool parallel{false};
+#ifdef STORM_HAVE_INTELTBB
+    parallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#endif
 
+    BddDerivatives bddDerivatives{bdd};
     chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+        // Compute the birnbaum factors of all basic elements at once
+        bddDerivatives.compute(currentChunksize, indexToProbabilities, parallel);
+        auto const &probabilitiesArray{bddDerivatives.getProbabilities()};
 
         for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
-            auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
-
-            // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
-            auto const index{getSylvanBddManager()->getIndex(be->name())};
-            auto const &birnbaumFactorsArray{
-                *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
+            auto const index{getSylvanBddManager()->getIndex(basicElements[basicElementIndex]->name())};
             auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
-
-            auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
-
-            // Update result Probabilities
-            for (size_t i{0}; i < currentChunksize; ++i) {
-                resultVector[basicElementIndex].push_back(ImportanceMeasureArray(i));
-            }
+            auto const &birnbaumFactorsArray{bddDerivatives.getDerivatives(index)};
+            func(basicElementIndex, currentChunksize, beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray);
         }
     });
+}
+
+template<typename FuncType>
+std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize,
+                                                                                        FuncType func) {
+    std::vector<std::vector<ValueType>> resultVector{};
+    resultVector.resize(getDFT()->getBasicElements().size());
+    for (auto &i : resultVector) {
+        i.reserve(timepoints.size());
+    }
+
+    forAllBirnbaumFactorsAtTimepoints(timepoints, chunksize,
+                                      [&](auto const basicElementIndex, auto const currentChunksize, auto const &beProbabilitiesArray,
+                                          auto const &probabilitiesArray, auto const &birnbaumFactorsArray) {
+                                          auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
+
+                                          // Update result Probabilities
+                                          for (size_t i{0}; i < currentChunksize; ++i) {
+                                              resultVector[basicElementIndex].push_back(ImportanceMeasureArray(i));
+                                          }
+                                      });
 
     return resultVector;
 }
@@ -539,6 +722,34 @@ struct RRWFunctor {
 
 }  // namespace
 
+SFTBDDChecker::ImportanceMeasures SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize) {
+    ImportanceMeasures result{};
+    auto const nrBasicElements{getDFT()->getBasicElements().size()};
+    for (auto *measure : {&result.birnbaumFactors, &result.CIFs, &result.DIFs, &result.RAWs, &result.RRWs}) {
+        measure->resize(nrBasicElements);
+        for (auto &i : *measure) {
+            i.reserve(timepoints.size());
+        }
+    }
+
+    forAllBirnbaumFactorsAtTimepoints(timepoints, chunksize,
+                                      [&](auto const basicElementIndex, auto const currentChunksize, auto const &beProbabilitiesArray,
+                                          auto const &probabilitiesArray, auto const &birnbaumFactorsArray) {
+                                          auto const appendMeasure = [&](std::vector<std::vector<ValueType>> &measure, auto const &measureArray) {
+                                              for (size_t i{0}; i < currentChunksize; ++i) {
+                                                  measure[basicElementIndex].push_back(measureArray(i));
+                                              }
+                                          };
+                                          appendMeasure(result.birnbaumFactors, birnbaumFactorsArray);
+                                          appendMeasure(result.CIFs, CIFFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+                                          appendMeasure(result.DIFs, DIFFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+                                          appendMeasure(result.RAWs, RAWFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+                                          appendMeasure(result.RRWs, RRWFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+                                      });
+
+    return result;
+}
+
 ValueType SFTBDDChecker::getBirnbaumFactorAtTimebound(std::string const &beName, ValueType timebound) {
     return getImportanceMeasureAtTimebound(beName, timebound, BirnbaumFunctor{});
 }
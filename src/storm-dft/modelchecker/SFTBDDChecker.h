@@ -24,6 +24,19 @@ class SFTBDDChecker {
     using ValueType = double;
     using Bdd = sylvan::Bdd;
 
+    /**
+     * The importance measures of all basic events.
+     * Each measure is sorted after the order of dft->getBasicElements
+     * and contains one value per timepoint.
+     */
+    struct ImportanceMeasures {
+        std::vector<std::vector<ValueType>> birnbaumFactors;
+        std::vector<std::vector<ValueType>> CIFs;
+        std::vector<std::vector<ValueType>> DIFs;
+        std::vector<std::vector<ValueType>> RAWs;
+        std::vector<std::vector<ValueType>> RRWs;
+    };
+
     SFTBDDChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft,
                   std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager = std::make_shared<storm::dft::storage::SylvanBddManager>());
 
@@ -340,6 +353,24 @@ class SFTBDDChecker {
      */
     std::vector<std::vector<ValueType>> getAllRRWsAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize = 0);
 
+    /**
+     * \return
+     * The birnbaum factor, CIF, DIF, RAW and RRW of all basic events
+     *
+     * \param timepoints
+     * Array of timebounds to calculate the measures for.
+     *
+     * \param chunksize
+     * Splits the timepoints array into chunksize chunks.
+     * A value of 0 represents to calculate the whole array at once.
+     *
+     * \note
+     * The birnbaum factors of all basic events are the partial derivatives
+     * of the top level probability and are computed in a single pass over the BDD.
+     * If Intel TBB is enabled, independent BDD nodes are processed in parallel.
+     */
+    ImportanceMeasures getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize = 0);
+
    private:
     /**
      * Recursively traverses the given BDD and returns the minimalCutSets.
@@ -373,6 +404,14 @@ class SFTBDDChecker {
     template<typename FuncType>
     std::vector<std::vector<ValueType>> getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func);
 
+    /**
+     * Computes the birnbaum factors of all basic events in a single pass
+     * and calls func(basicElementIndex, chunksize, beProbabilities, probabilities, birnbaumFactors)
+     * for each basic event and each chunk of timepoints.
+     */
+    template<typename FuncType>
+    void forAllBirnbaumFactorsAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func);
+
     /**
      * \return
      * Generated Bdd that represents the formula of the top level event
@@ -7,6 +7,7 @@
 
 #include "storm-pars/derivative/GradientDescentInstantiationSearcher.h"
 #include "storm-pars/derivative/SparseDerivativeInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseBatchInstantiationModelChecker.h"
 #include "storm-pars/modelchecker/instantiation/SparseCtmcInstantiationModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseParameterLiftingModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseDtmcParameterLiftingModelChecker.h"
@@ -513,6 +514,79 @@ namespace storm {
             }
         }
 
+        template <typename ValueType>
+        std::vector<storm::utility::parametric::Valuation<ValueType>> getSampleValuations(SampleInformation<ValueType> const& samples) {
+            std::vector<storm::utility::parametric::Valuation<ValueType>> result;
+            for (auto const& product : samples.cartesianProducts) {
+                // Enumerate the cartesian product such that the value of the first parameter changes fastest.
+                std::vector<storm::utility::parametric::Valuation<ValueType>> productValuations(1);
+                for (auto const& entry : product) {
+                    std::vector<storm::utility::parametric::Valuation<ValueType>> extendedValuations;
+                    extendedValuations.reserve(productValuations.size() * entry.second.size());
+                    for (auto const& value : entry.second) {
+                        for (auto const& valuation : productValuations) {
+                            extendedValuations.push_back(valuation);
+                            extendedValuations.back()[entry.first] = value;
+                        }
+                    }
+                    productValuations = std::move(extendedValuations);
+                }
+                result.insert(result.end(), std::make_move_iterator(productValuations.begin()), std::make_move_iterator(productValuations.end()));
+            }
+            return result;
+        }
+
+        template<typename ModelType, typename ValueType>
+        void verifyPropertiesAtSamplePointsBatched(ModelType const& model, SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
+            auto const& parSettings = storm::settings::getModule<storm::settings::modules::ParametricSettings>();
+            STORM_LOG_THROW(samples.graphPreserving, storm::exceptions::NotSupportedException, "Batch sampling requires graph-preserving samples (see --samples-graph-preserving).");
+
+            storm::modelchecker::SparseBatchInstantiationModelChecker<ModelType> modelchecker(model);
+            modelchecker.setBatchSize(parSettings.getSamplesBatchSize());
+            std::vector<storm::utility::parametric::Valuation<ValueType>> valuations = getSampleValuations(samples);
+
+            std::vector<std::string> propertyNames;
+            std::vector<std::vector<double>> propertyValues;
+            for (auto const& property : input.properties) {
+                storm::cli::printModelCheckingProperty(property);
+                storm::utility::Stopwatch watch(true);
+                modelchecker.specifyFormula(storm::api::createTask<ValueType>(property.getRawFormula(), true));
+                std::vector<double> values = modelchecker.check(Environment(), valuations);
+                watch.stop();
+
+                if (!parSettings.isExportSamplesSet()) {
+                    for (uint64_t sample = 0; sample < valuations.size(); ++sample) {
+                        std::stringstream ss;
+                        bool first = true;
+                        for (auto const& entry : valuations[sample]) {
+                            ss << (first ? "" : ", ") << entry.first << "=" << entry.second;
+                            first = false;
+                        }
+                        STORM_PRINT_AND_LOG("Result (initial state) for instance [" << ss.str() << "]: " << values[sample] << '\n');
+                    }
+                }
+                STORM_PRINT_AND_LOG("Overall time for sampling all " << valuations.size() << " instances: " << watch << "\n\n");
+                propertyNames.push_back(property.getName());
+                propertyValues.push_back(std::move(values));
+            }
+
+            if (parSettings.isExportSamplesSet()) {
+                storm::api::exportSamplesToFile(valuations, propertyNames, propertyValues, parSettings.getExportSamplesPath());
+            }
+        }
+
+        template <typename ValueType>
+        void verifyPropertiesAtSamplePointsBatched(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
+            STORM_LOG_THROW(!samples.exact, storm::exceptions::NotSupportedException, "Batch sampling is not supported with exact arithmetic.");
+            if (model->isOfType(storm::models::ModelType::Dtmc)) {
+                verifyPropertiesAtSamplePointsBatched(*model->template as<storm::models::sparse::Dtmc<ValueType>>(), input, samples);
+            } else if (model->isOfType(storm::models::ModelType::Mdp)) {
+                verifyPropertiesAtSamplePointsBatched(*model->template as<storm::models::sparse::Mdp<ValueType>>(), input, samples);
+            } else {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Batch sampling is currently only supported for DTMCs and MDPs.");
+            }
+        }
+
         template <typename ValueType>
         void verifyPropertiesWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
 
@@ -541,7 +615,9 @@ namespace storm {
             } else {
                 STORM_LOG_TRACE("Sampling the model at given points.");
 
-                if (samples.exact) {
+                if (storm::settings::getModule<storm::settings::modules::ParametricSettings>().isSamplesBatchSet()) {
+                    verifyPropertiesAtSamplePointsBatched<ValueType>(model, input, samples);
+                } else if (samples.exact) {
                     verifyPropertiesAtSamplePoints<ValueType, storm::RationalNumber>(model, input, samples);
                 } else {
                     verifyPropertiesAtSamplePoints<ValueType, double>(model, input, samples);
@@ -862,7 +938,7 @@ namespace storm {
                         optionalDepthLimit = regionSettings.getDepthLimit();
                     }
                     // TODO @Jip: change allow model simplification when not using monotonicity, for benchmarking purposes simplification is moved forward.
-                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), false, monotonicitySettings, monThresh);
+                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), false, monotonicitySettings, monThresh, regionSettings.getNumberOfRefinementWorkers());
                     return result;
                 };
             } else {
@@ -1,7 +1,10 @@
 #include "storm/io/file.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/analysis/GraphConditions.h"
+#include "storm/adapters/JsonAdapter.h"
+#include "storm-pars/utility/parametric.h"
 
 namespace storm {
     namespace api {
@@ -32,5 +35,58 @@ namespace storm {
             std::copy(stringConstraints.begin(), stringConstraints.end(), std::ostream_iterator<std::string>(filestream, "\n"));
             storm::utility::closeFile(filestream);
         }
+
+        /*!
+         * Exports the values computed at the given sample points.
+         * If the path ends with '.json', the samples are exported as a JSON array with one object per sample point. Otherwise, one line of comma-separated values is written per sample point.
+         * @param valueNames the names of the computed values (e.g. the considered properties)
+         * @param values for each name, the values in the order of the valuations
+         */
+        template <typename ValueType>
+        void exportSamplesToFile(std::vector<storm::utility::parametric::Valuation<ValueType>> const& valuations, std::vector<std::string> const& valueNames, std::vector<std::vector<double>> const& values, std::string const& path) {
+            STORM_LOG_THROW(valueNames.size() == values.size(), storm::exceptions::IllegalArgumentException, "The number of value names and value vectors do not match.");
+            std::ofstream filestream;
+            storm::utility::openFile(path, filestream);
+            if (path.size() >= 5 && path.compare(path.size() - 5, 5, ".json") == 0) {
+                storm::json<double> samples = storm::json<double>::array();
+                for (uint64_t sample = 0; sample < valuations.size(); ++sample) {
+                    storm::json<double> entry;
+                    for (auto const& parameterValue : valuations[sample]) {
+                        entry[parameterValue.first.name()] = storm::utility::convertNumber<double>(parameterValue.second);
+                    }
+                    for (uint64_t valueIndex = 0; valueIndex < valueNames.size(); ++valueIndex) {
+                        entry[valueNames[valueIndex]] = values[valueIndex][sample];
+                    }
+                    samples.push_back(std::move(entry));
+                }
+                filestream << samples.dump(4) << '\n';
+            } else {
+                bool first = true;
+                if (!valuations.empty()) {
+                    for (auto const& parameterValue : valuations.front()) {
+                        filestream << (first ? "" : ",") << parameterValue.first.name();
+                        first = false;
+                    }
+                }
+                for (auto const& valueName : valueNames) {
+                    filestream << (first ? "" : ",") << valueName;
+                    first = false;
+                }
+                filestream << '\n';
+                for (uint64_t sample = 0; sample < valuations.size(); ++sample) {
+                    first = true;
+                    for (auto const& parameterValue : valuations[sample]) {
+                        filestream << (first ? "" : ",") << storm::utility::convertNumber<double>(parameterValue.second);
+                        first = false;
+                    }
+                    for (auto const& valueVector : values) {
+                        filestream << (first ? "" : ",") << valueVector[sample];
+                        first = false;
+                    }
+                    filestream << '\n';
+                }
+            }
+            storm::utility::closeFile(filestream);
+        }
     }
 }
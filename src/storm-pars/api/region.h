@@ -6,6 +6,8 @@
 #include <memory>
 #include <boost/optional.hpp>
 
+#include "storm-config.h"
+
 #include "storm-pars/modelchecker/results/RegionCheckResult.h"
 #include "storm-pars/modelchecker/results/RegionRefinementCheckResult.h"
 #include "storm-pars/modelchecker/region/RegionCheckEngine.h"
@@ -235,12 +237,31 @@ namespace storm {
          * @param allowModelSimplification
          * @param useMonotonicity
          * @param monThresh if given, determines at which depth to start using monotonicity
+         * @param numberOfWorkers the number of region model checkers that analyze regions concurrently (only supported for the (inexact) parameter lifting engine without monotonicity and if Storm does not use CLN)
          */
         template <typename ValueType>
-        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true, MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0) {
+        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine, boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none, storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true, MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0, uint64_t numberOfWorkers = 1) {
             Environment env;
             bool preconditionsValidated = false;
             auto regionChecker = initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated, monotonicitySetting);
+            if (numberOfWorkers > 1) {
+#ifdef STORM_USE_CLN_RF
+                // The reference counts of CLN numbers are not atomic, but the region checkers share the coefficients of the model and the regions.
+                STORM_LOG_WARN("Concurrent region refinement is not supported if Storm uses CLN for rational functions. Continuing with a single region model checker.");
+#else
+                // The workers are specified in the same way as the region checker, which amounts to cloning the lifted model checker.
+                // Exact arithmetic and monotonicity checking are not guaranteed to be thread-safe, so we only support the (inexact) parameter lifting engine.
+                if (engine == storm::modelchecker::RegionCheckEngine::ParameterLifting && !monotonicitySetting.useMonotonicity) {
+                    std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<ValueType>>> workers;
+                    for (uint64_t worker = 1; worker < numberOfWorkers; ++worker) {
+                        workers.push_back(initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated, monotonicitySetting));
+                    }
+                    regionChecker->setRefinementWorkers(workers);
+                } else {
+                    STORM_LOG_WARN("Concurrent region refinement is only supported for the parameter lifting engine without monotonicity. Continuing with a single region model checker.");
+                }
+#endif
+            }
             return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, monThresh);
         }
 
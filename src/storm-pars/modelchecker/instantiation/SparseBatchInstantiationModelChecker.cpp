@@ -0,0 +1,275 @@
+#include "storm-pars/modelchecker/instantiation/SparseBatchInstantiationModelChecker.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        template <typename SparseModelType>
+        SparseBatchInstantiationModelChecker<SparseModelType>::SparseBatchInstantiationModelChecker(SparseModelType const& parametricModel) : parametricModel(parametricModel), batchSize(64), minimize(false) {
+            STORM_LOG_THROW(parametricModel.getInitialStates().getNumberOfSetBits() == 1, storm::exceptions::NotSupportedException, "Batch sampling requires a model with a unique initial state.");
+        }
+
+        template <typename SparseModelType>
+        void SparseBatchInstantiationModelChecker<SparseModelType>::specifyFormula(CheckTask<storm::logic::Formula, ParametricType> const& checkTask) {
+            storm::logic::Formula const& formula = checkTask.getFormula();
+            STORM_LOG_THROW(formula.isProbabilityOperatorFormula() || formula.isRewardOperatorFormula(), storm::exceptions::NotSupportedException, "Batch sampling is only supported for probability and reward operator formulas.");
+            if (parametricModel.isNondeterministicModel()) {
+                STORM_LOG_THROW(checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException, "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
+                minimize = storm::solver::minimize(checkTask.getOptimizationDirection());
+            }
+            storm::logic::Formula const& subformula = formula.asOperatorFormula().getSubformula();
+
+            storm::modelchecker::SparsePropositionalModelChecker<SparseModelType> propositionalChecker(parametricModel);
+            if (formula.isProbabilityOperatorFormula() && subformula.isUntilFormula()) {
+                auto const& untilFormula = subformula.asUntilFormula();
+                STORM_LOG_THROW(propositionalChecker.canHandle(untilFormula.getLeftSubformula()) && propositionalChecker.canHandle(untilFormula.getRightSubformula()), storm::exceptions::NotSupportedException, "Batch sampling with non-propositional subformulas is not supported");
+                storm::storage::BitVector phiStates = std::move(propositionalChecker.check(untilFormula.getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                storm::storage::BitVector psiStates = std::move(propositionalChecker.check(untilFormula.getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                specifyUntilFormula(checkTask, phiStates, psiStates);
+            } else if (subformula.isEventuallyFormula()) {
+                auto const& eventuallyFormula = subformula.asEventuallyFormula();
+                STORM_LOG_THROW(propositionalChecker.canHandle(eventuallyFormula.getSubformula()), storm::exceptions::NotSupportedException, "Batch sampling with non-propositional subformulas is not supported");
+                storm::storage::BitVector targetStates = std::move(propositionalChecker.check(eventuallyFormula.getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                if (formula.isProbabilityOperatorFormula()) {
+                    specifyUntilFormula(checkTask, storm::storage::BitVector(parametricModel.getNumberOfStates(), true), targetStates);
+                } else {
+                    STORM_LOG_THROW(eventuallyFormula.isReachabilityRewardFormula(), storm::exceptions::NotSupportedException, "Batch sampling is only supported for reachability rewards.");
+                    specifyReachabilityRewardFormula(checkTask, targetStates);
+                }
+            } else {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Batch sampling is not supported for the formula " << formula << ".");
+            }
+        }
+
+        template <typename SparseModelType>
+        void SparseBatchInstantiationModelChecker<SparseModelType>::specifyUntilFormula(CheckTask<storm::logic::Formula, ParametricType> const&, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+            auto const& transitionMatrix = parametricModel.getTransitionMatrix();
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+            if (!parametricModel.isNondeterministicModel()) {
+                statesWithProbability01 = storm::utility::graph::performProb01(parametricModel.getBackwardTransitions(), phiStates, psiStates);
+            } else if (minimize) {
+                statesWithProbability01 = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), parametricModel.getBackwardTransitions(), phiStates, psiStates);
+            } else {
+                statesWithProbability01 = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), parametricModel.getBackwardTransitions(), phiStates, psiStates);
+            }
+            maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+
+            uint64_t initialState = *parametricModel.getInitialStates().begin();
+            if (!maybeStates.get(initialState)) {
+                initialStateValue = statesWithProbability01.second.get(initialState) ? storm::utility::one<double>() : storm::utility::zero<double>();
+                return;
+            }
+            initialStateValue = boost::none;
+
+            // The one-step probabilities to go to target states.
+            std::vector<ParametricType> b = transitionMatrix.getConstrainedRowSumVector(storm::storage::BitVector(transitionMatrix.getRowCount(), true), statesWithProbability01.second);
+            buildEquationSystem(transitionMatrix.getRowFilter(maybeStates), b);
+        }
+
+        template <typename SparseModelType>
+        void SparseBatchInstantiationModelChecker<SparseModelType>::specifyReachabilityRewardFormula(CheckTask<storm::logic::Formula, ParametricType> const& checkTask, storm::storage::BitVector const& targetStates) {
+            auto const& transitionMatrix = parametricModel.getTransitionMatrix();
+            storm::storage::BitVector allStates(parametricModel.getNumberOfStates(), true);
+            storm::storage::BitVector infinityStates;
+            if (!parametricModel.isNondeterministicModel()) {
+                infinityStates = storm::utility::graph::performProb1(parametricModel.getBackwardTransitions(), allStates, targetStates);
+            } else if (minimize) {
+                infinityStates = storm::utility::graph::performProb1E(transitionMatrix, transitionMatrix.getRowGroupIndices(), parametricModel.getBackwardTransitions(), allStates, targetStates);
+            } else {
+                infinityStates = storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), parametricModel.getBackwardTransitions(), allStates, targetStates);
+            }
+            infinityStates.complement();
+            maybeStates = ~(targetStates | infinityStates);
+
+            uint64_t initialState = *parametricModel.getInitialStates().begin();
+            if (!maybeStates.get(initialState)) {
+                initialStateValue = infinityStates.get(initialState) ? storm::utility::infinity<double>() : storm::utility::zero<double>();
+                return;
+            }
+            initialStateValue = boost::none;
+
+            // Value iteration starting from zero could converge to a wrong fixpoint if the maybe states contain an end component in which minimizing schedulers collect no reward.
+            STORM_LOG_THROW(!parametricModel.isNondeterministicModel() || !minimize || storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), parametricModel.getBackwardTransitions(), maybeStates, ~maybeStates).full(), storm::exceptions::NotSupportedException, "Batch sampling of minimal rewards is not supported for models with end components.");
+
+            STORM_LOG_THROW((checkTask.isRewardModelSet() && parametricModel.hasRewardModel(checkTask.getRewardModel())) || (!checkTask.isRewardModelSet() && parametricModel.hasUniqueRewardModel()), storm::exceptions::InvalidPropertyException, "The reward model specified by the CheckTask is not available in the given model.");
+            typename SparseModelType::RewardModelType const& rewardModel = checkTask.isRewardModelSet() ? parametricModel.getRewardModel(checkTask.getRewardModel()) : parametricModel.getUniqueRewardModel();
+            std::vector<ParametricType> b = rewardModel.getTotalRewardVector(transitionMatrix);
+
+            // As a maybe state does not have reward infinity, a choice leading to an infinity state will never be picked. Hence, we can unselect the corresponding rows
+            buildEquationSystem(transitionMatrix.getRowFilter(maybeStates, ~infinityStates), b);
+        }
+
+        template <typename SparseModelType>
+        void SparseBatchInstantiationModelChecker<SparseModelType>::buildEquationSystem(storm::storage::BitVector const& selectedRows, std::vector<ParametricType> const& b) {
+            auto const& transitionMatrix = parametricModel.getTransitionMatrix();
+            std::vector<uint_fast64_t> stateToMaybeState = maybeStates.getNumberOfSetBitsBeforeIndices();
+            initialMaybeState = stateToMaybeState[*parametricModel.getInitialStates().begin()];
+
+            functions = storm::utility::parametric::CompiledRationalFunctions();
+            rowGroupIndices.assign(1, 0);
+            rowIndices.assign(1, 0);
+            columns.clear();
+            entryFunctions.clear();
+            rowFunctions.clear();
+            for (auto state : maybeStates) {
+                for (uint64_t row = transitionMatrix.getRowGroupIndices()[state]; row < transitionMatrix.getRowGroupIndices()[state + 1]; ++row) {
+                    if (!selectedRows.get(row)) {
+                        continue;
+                    }
+                    for (auto const& entry : transitionMatrix.getRow(row)) {
+                        // Entries leading to non-maybe states are either covered by b or lead to states with value zero.
+                        if (maybeStates.get(entry.getColumn())) {
+                            columns.push_back(stateToMaybeState[entry.getColumn()]);
+                            entryFunctions.push_back(functions.add(entry.getValue()));
+                        }
+                    }
+                    rowIndices.push_back(columns.size());
+                    rowFunctions.push_back(functions.add(b[row]));
+                }
+                STORM_LOG_ASSERT(rowFunctions.size() > rowGroupIndices.back(), "No selected row for maybe state " << state << ".");
+                rowGroupIndices.push_back(rowFunctions.size());
+            }
+        }
+
+        template <typename SparseModelType>
+        std::vector<double> SparseBatchInstantiationModelChecker<SparseModelType>::check(Environment const& env, std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations) const {
+            if (initialStateValue) {
+                return std::vector<double>(valuations.size(), initialStateValue.get());
+            }
+            STORM_LOG_THROW(!rowGroupIndices.empty(), storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+
+            // Converting the valuations involves (exact) arithmetic on the parameter values, which is why it is done before going parallel.
+            std::vector<std::vector<double>> variableValues;
+            variableValues.reserve(valuations.size());
+            for (auto const& valuation : valuations) {
+                variableValues.push_back(functions.getVariableValues(valuation));
+            }
+
+            std::vector<double> result(valuations.size());
+            uint64_t numberOfBatches = (valuations.size() + batchSize - 1) / batchSize;
+            auto checkBatches = [&](uint64_t firstBatch, uint64_t lastBatch) {
+                for (uint64_t batch = firstBatch; batch < lastBatch; ++batch) {
+                    uint64_t first = batch * batchSize;
+                    checkBatch(env, variableValues, first, std::min<uint64_t>(batchSize, valuations.size() - first), result);
+                }
+            };
+#ifdef STORM_HAVE_INTELTBB
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfBatches, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                    checkBatches(range.begin(), range.end());
+                });
+                return result;
+            }
+#endif
+            checkBatches(0, numberOfBatches);
+            return result;
+        }
+
+        template <typename SparseModelType>
+        void SparseBatchInstantiationModelChecker<SparseModelType>::checkBatch(Environment const& env, std::vector<std::vector<double>> const& variableValues, uint64_t first, uint64_t size, std::vector<double>& result) const {
+            // Evaluate all occurring functions. The value of function f under the j-th valuation of the batch is at position f * size + j
+            uint64_t numberOfVariables = functions.getVariables().size();
+            std::vector<double> batchVariableValues(numberOfVariables * size);
+            for (uint64_t j = 0; j < size; ++j) {
+                for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+                    batchVariableValues[variable * size + j] = variableValues[first + j][variable];
+                }
+            }
+            std::vector<double> functionValues;
+            functions.evaluate(batchVariableValues, size, functionValues);
+
+            double const precision = storm::utility::convertNumber<double>(env.solver().minMax().getPrecision());
+            bool const relative = env.solver().minMax().getRelativeTerminationCriterion();
+            uint64_t const maxIterations = env.solver().minMax().getMaximalNumberOfIterations();
+
+            // The value of maybe state s under the j-th valuation of the batch is at position s * size + j
+            uint64_t numberOfMaybeStates = rowGroupIndices.size() - 1;
+            std::vector<double> values(numberOfMaybeStates * size, storm::utility::zero<double>());
+            std::vector<double> newValues(values.size());
+            std::vector<double> rowValues(size);
+            bool converged = false;
+            uint64_t iterations = 0;
+            while (!converged && iterations < maxIterations) {
+                converged = true;
+                for (uint64_t state = 0; state < numberOfMaybeStates; ++state) {
+                    double* stateValues = newValues.data() + state * size;
+                    for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                        double const* bValues = functionValues.data() + rowFunctions[row] * size;
+                        std::copy(bValues, bValues + size, rowValues.begin());
+                        for (uint64_t entry = rowIndices[row]; entry < rowIndices[row + 1]; ++entry) {
+                            double const* entryValues = functionValues.data() + entryFunctions[entry] * size;
+                            double const* successorValues = values.data() + columns[entry] * size;
+                            for (uint64_t j = 0; j < size; ++j) {
+                                rowValues[j] += entryValues[j] * successorValues[j];
+                            }
+                        }
+                        if (row == rowGroupIndices[state]) {
+                            std::copy(rowValues.begin(), rowValues.end(), stateValues);
+                        } else if (minimize) {
+                            for (uint64_t j = 0; j < size; ++j) {
+                                stateValues[j] = std::min(stateValues[j], rowValues[j]);
+                            }
+                        } else {
+                            for (uint64_t j = 0; j < size; ++j) {
+                                stateValues[j] = std::max(stateValues[j], rowValues[j]);
+                            }
+                        }
+                    }
+                    if (converged) {
+                        double const* oldStateValues = values.data() + state * size;
+                        for (uint64_t j = 0; j < size; ++j) {
+                            double difference = std::abs(stateValues[j] - oldStateValues[j]);
+                            if (relative ? difference > precision * std::abs(stateValues[j]) : difference > precision) {
+                                converged = false;
+                                break;
+                            }
+                        }
+                    }
+                }
+                values.swap(newValues);
+                ++iterations;
+            }
+            STORM_LOG_WARN_COND(converged, "Batch value iteration did not converge within " << iterations << " iterations.");
+
+            std::copy(values.begin() + initialMaybeState * size, values.begin() + (initialMaybeState + 1) * size, result.begin() + first);
+        }
+
+        template <typename SparseModelType>
+        void SparseBatchInstantiationModelChecker<SparseModelType>::setBatchSize(uint64_t value) {
+            STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "The batch size has to be positive.");
+            batchSize = value;
+        }
+
+        template <typename SparseModelType>
+        uint64_t SparseBatchInstantiationModelChecker<SparseModelType>::getBatchSize() const {
+            return batchSize;
+        }
+
+        template class SparseBatchInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>>;
+        template class SparseBatchInstantiationModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>>;
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "storm-pars/utility/parametric.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/CheckTask.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace modelchecker {
+
+        /*!
+         * Class to efficiently check a formula on a parametric DTMC or MDP for a large number of parameter instantiations at once.
+         *
+         * All instantiations share the sparsity pattern of the parametric model: The occurring transition probabilities and rewards are compiled once and
+         * evaluated for a whole batch of valuations, where the values of the different valuations for one matrix entry are stored consecutively.
+         * Each batch is then solved with a value iteration that updates the values of all valuations of the batch at once.
+         * The batches are processed in parallel if Intel TBB is available and enabled.
+         *
+         * @note It is assumed that all considered instantiations are graph-preserving. Computations are performed in double precision.
+         * @note Only (unbounded) reachability probabilities and reachability rewards are supported.
+         */
+        template <typename SparseModelType>
+        class SparseBatchInstantiationModelChecker {
+        public:
+            typedef typename SparseModelType::ValueType ParametricType;
+
+            SparseBatchInstantiationModelChecker(SparseModelType const& parametricModel);
+
+            /*!
+             * Specifies the property to check. The qualitative analysis and the compilation of the occurring functions is done here (once for all valuations).
+             * @note If the formula has a bound, the values are computed without comparing them against the bound.
+             */
+            void specifyFormula(CheckTask<storm::logic::Formula, ParametricType> const& checkTask);
+
+            /*!
+             * Computes the value at the (unique) initial state of the model for each of the given valuations.
+             * @return the values in the order of the given valuations
+             */
+            std::vector<double> check(Environment const& env, std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations) const;
+
+            /*!
+             * Sets the number of valuations that are solved together with one value iteration.
+             */
+            void setBatchSize(uint64_t value);
+            uint64_t getBatchSize() const;
+
+        private:
+            void specifyUntilFormula(CheckTask<storm::logic::Formula, ParametricType> const& checkTask, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            void specifyReachabilityRewardFormula(CheckTask<storm::logic::Formula, ParametricType> const& checkTask, storm::storage::BitVector const& targetStates);
+
+            /*!
+             * Builds the equation system restricted to the maybe states and the selected rows.
+             * @param b the parametric one-step values of the rows
+             */
+            void buildEquationSystem(storm::storage::BitVector const& selectedRows, std::vector<ParametricType> const& b);
+
+            /*!
+             * Solves the equation system for the given batch of valuations.
+             * @param variableValues the values of the variables of the compiled functions for each valuation
+             * @param result the values for the valuations of the batch are written to the positions first, ..., first + size - 1
+             */
+            void checkBatch(Environment const& env, std::vector<std::vector<double>> const& variableValues, uint64_t first, uint64_t size, std::vector<double>& result) const;
+
+            SparseModelType const& parametricModel;
+            uint64_t batchSize;
+            bool minimize;
+
+            // If the initial state is not a maybe state, its value does not depend on the valuation.
+            boost::optional<double> initialStateValue;
+
+            // The equation system x = A*x + b over the maybe states, where the matrix entries and the vector entries refer to compiled functions.
+            storm::storage::BitVector maybeStates;
+            uint64_t initialMaybeState;
+            std::vector<uint64_t> rowGroupIndices;
+            std::vector<uint64_t> rowIndices;
+            std::vector<uint64_t> columns;
+            std::vector<uint64_t> entryFunctions;
+            std::vector<uint64_t> rowFunctions;
+            storm::utility::parametric::CompiledRationalFunctions functions;
+        };
+    }
+}
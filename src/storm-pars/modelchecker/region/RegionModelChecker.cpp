@@ -1,10 +1,14 @@
 #include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <deque>
 #include <queue>
 
 #include "storm-pars/analysis/OrderExtender.cpp"
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/Dtmc.h"
@@ -62,11 +66,11 @@ namespace storm {
                 std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
                 
                 // FIFO queues storing the data for the regions that we still need to process.
-                std::queue<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> unprocessedRegions;
+                std::deque<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> unprocessedRegions;
 
-                std::queue<uint64_t> refinementDepths;
-                unprocessedRegions.emplace(region, RegionResult::Unknown);
-                refinementDepths.push(0);
+                std::deque<uint64_t> refinementDepths;
+                unprocessedRegions.emplace_back(region, RegionResult::Unknown);
+                refinementDepths.push_back(0);
 
                 uint_fast64_t numOfAnalyzedRegions = 0;
                 CoefficientType displayedProgress = storm::utility::zero<CoefficientType>();
@@ -84,6 +88,10 @@ namespace storm {
                     displayedProgress = storm::utility::zero<CoefficientType>();
                 }
 
+                // Results for the regions at the front of the queue that have been analyzed concurrently by the refinement workers.
+                // As regions are only removed from the front and appended at the back, the i-th result always belongs to the i-th region in the queue.
+                std::deque<RegionResult> concurrentlyAnalyzedResults;
+
                 // NORMAL WHILE LOOP
                 uint64_t currentDepth = refinementDepths.front();
                 while ((!useMonotonicity || currentDepth < monThresh) && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
@@ -93,7 +101,20 @@ namespace storm {
                     auto& res = unprocessedRegions.front().second;
                     std::shared_ptr<storm::analysis::Order> order;
                     std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult;
-                    res = analyzeRegion(env, currentRegion, hypothesis, res, false);
+                    if (concurrentlyAnalyzedResults.empty() && !refinementWorkers.empty()) {
+                        // Analyze the next batch of regions at once. Regions from which on monotonicity is to be used are not part of the batch.
+                        uint64_t numberOfRegions = std::min<uint64_t>(unprocessedRegions.size(), (refinementWorkers.size() + 1) * regionsPerRefinementWorker);
+                        if (useMonotonicity) {
+                            numberOfRegions = std::lower_bound(refinementDepths.begin(), refinementDepths.begin() + numberOfRegions, monThresh) - refinementDepths.begin();
+                        }
+                        concurrentlyAnalyzedResults = analyzeRegionsConcurrently(env, unprocessedRegions, numberOfRegions, hypothesis);
+                    }
+                    if (concurrentlyAnalyzedResults.empty()) {
+                        res = analyzeRegion(env, currentRegion, hypothesis, res, false);
+                    } else {
+                        res = concurrentlyAnalyzedResults.front();
+                        concurrentlyAnalyzedResults.pop_front();
+                    }
 
                     switch (res) {
                         case RegionResult::AllSat:
@@ -116,8 +137,8 @@ namespace storm {
 
                                 currentRegion.split(currentRegion.getCenterPoint(), newRegions);
                                 for (auto& newRegion : newRegions) {
-                                    unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
-                                    refinementDepths.push(currentDepth + 1);
+                                    unprocessedRegions.emplace_back(std::move(newRegion), initResForNewRegions);
+                                    refinementDepths.push_back(currentDepth + 1);
                                 }
 
                             } else {
@@ -127,8 +148,8 @@ namespace storm {
                             break;
                     }
                     ++numOfAnalyzedRegions;
-                    unprocessedRegions.pop();
-                    refinementDepths.pop();
+                    unprocessedRegions.pop_front();
+                    refinementDepths.pop_front();
                     if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
                         while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
                             STORM_PRINT_AND_LOG("#");
@@ -270,8 +291,8 @@ namespace storm {
                                             }
                                         }
                                     }
-                                    unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
-                                    refinementDepths.push(currentDepth + 1);
+                                    unprocessedRegions.emplace_back(std::move(newRegion), initResForNewRegions);
+                                    refinementDepths.push_back(currentDepth + 1);
                                 }
                             } else {
                                 // If the region is not further refined, it is still added to the result
@@ -281,8 +302,8 @@ namespace storm {
                     }
 
                     ++numOfAnalyzedRegions;
-                    unprocessedRegions.pop();
-                    refinementDepths.pop();
+                    unprocessedRegions.pop_front();
+                    refinementDepths.pop_front();
                     if (!useSameOrder) {
                         orders.pop();
                     }
@@ -301,7 +322,7 @@ namespace storm {
                 // Add the still unprocessed regions to the result
                 while (!unprocessedRegions.empty()) {
                     result.push_back(std::move(unprocessedRegions.front()));
-                    unprocessedRegions.pop();
+                    unprocessedRegions.pop_front();
                 }
                 
                 if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
@@ -401,6 +422,39 @@ namespace storm {
             this->useOnlyGlobal = global;
         }
 
+        template <typename ParametricType>
+        void RegionModelChecker<ParametricType>::setRefinementWorkers(std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& workers) {
+            this->refinementWorkers = workers;
+        }
+
+        template <typename ParametricType>
+        std::deque<RegionResult> RegionModelChecker<ParametricType>::analyzeRegionsConcurrently(Environment const& env, std::deque<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> const& regions, uint64_t numberOfRegions, RegionResultHypothesis const& hypothesis) {
+            STORM_LOG_ASSERT(numberOfRegions <= regions.size(), "Invalid number of regions.");
+            std::deque<RegionResult> results(numberOfRegions, RegionResult::Unknown);
+
+            // Each model checker (this one and the workers) repeatedly takes the next region that has not been analyzed yet.
+            // The results are stored at the position of the region, so the outcome does not depend on the scheduling.
+            std::atomic<uint64_t> nextRegion(0);
+            auto analyzeWithChecker = [&](RegionModelChecker<ParametricType>& checker) {
+                for (uint64_t regionIndex = nextRegion++; regionIndex < numberOfRegions; regionIndex = nextRegion++) {
+                    results[regionIndex] = checker.analyzeRegion(env, regions[regionIndex].first, hypothesis, regions[regionIndex].second, false);
+                }
+            };
+
+#ifdef STORM_HAVE_INTELTBB
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, refinementWorkers.size() + 1, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t checkerIndex = range.begin(); checkerIndex < range.end(); ++checkerIndex) {
+                        analyzeWithChecker(checkerIndex == 0 ? *this : *refinementWorkers[checkerIndex - 1]);
+                    }
+                });
+                return results;
+            }
+#endif
+            analyzeWithChecker(*this);
+            return results;
+        }
+
         template <typename ParametricType>
         void
         RegionModelChecker<ParametricType>::splitSmart(storm::storage::ParameterRegion<ParametricType> &currentRegion,
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <memory>
 
 #include "storm-pars/analysis/Order.h"
@@ -94,6 +95,15 @@ namespace storm {
             void setUseBounds(bool bounds = true);
             void setUseOnlyGlobal(bool global = true);
 
+            /*!
+             * Sets region model checkers that analyze regions concurrently to this model checker during region refinement.
+             * Every worker has to be specified for the same model and check task as this model checker.
+             * The result of the refinement does not depend on the number of workers.
+             * @note The regions are only analyzed concurrently if Intel TBB is available and enabled.
+             * @note The workers share the coefficients of the model and of the regions, so they must not be used if Storm uses CLN for rational functions.
+             */
+            void setRefinementWorkers(std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& workers);
+
             void setMonotoneParameters(std::pair<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>, std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneParameters);
 
         private:
@@ -101,6 +111,17 @@ namespace storm {
             bool useOnlyGlobal = false;
             bool useBounds = false;
 
+            /*!
+             * Analyzes the first regions of the given queue using this model checker and the refinement workers.
+             * @return the results for the analyzed regions (in the order of the regions)
+             */
+            std::deque<RegionResult> analyzeRegionsConcurrently(Environment const& env, std::deque<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> const& regions, uint64_t numberOfRegions, RegionResultHypothesis const& hypothesis);
+
+            // Model checkers that analyze regions concurrently during region refinement
+            std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> refinementWorkers;
+            // The number of regions that are analyzed at once per model checker during region refinement
+            static const uint64_t regionsPerRefinementWorker = 8;
+
         protected:
 
             uint_fast64_t numberOfRegionsKnownThroughMonotonicity;
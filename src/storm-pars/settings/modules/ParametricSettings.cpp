@@ -21,6 +21,8 @@ namespace storm {
             const std::string ParametricSettings::samplesOptionName = "samples";
             const std::string ParametricSettings::samplesGraphPreservingOptionName = "samples-graph-preserving";
             const std::string ParametricSettings::sampleExactOptionName = "sample-exact";
+            const std::string ParametricSettings::samplesBatchOptionName = "samples-batch";
+            const std::string ParametricSettings::exportSamplesOptionName = "exportsamples";
             const std::string ParametricSettings::useMonotonicityName = "use-monotonicity";
 //            const std::string ParametricSettings::onlyGlobalName = "onlyGlobal";
 
@@ -34,6 +36,10 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("samples", "The samples are semicolon-separated entries of the form 'Var1=Val1:Val2:...:Valk,Var2=... that span the sample spaces.").setDefaultValueString("").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, samplesGraphPreservingOptionName, false, "Sets whether it can be assumed that the samples are graph-preserving.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, sampleExactOptionName, false, "Sets whether to sample using exact arithmetic.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, samplesBatchOptionName, false, "Sets whether all samples are checked at once with batched value iteration. Requires graph-preserving samples and is only supported for reachability probabilities and rewards on DTMCs and MDPs.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The number of samples that are solved together.").setDefaultValueUnsignedInteger(64).makeOptional().addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportSamplesOptionName, false, "A path to a file where the results of batch sampling are written to (as JSON if the path ends with '.json' and as CSV otherwise).")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("path", "the location.").addValidatorString(ArgumentValidatorFactory::createWritableFileValidator()).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, useMonotonicityName, false, "If set, monotonicity will be used.").build());
 //                this->addOption(storm::settings::OptionBuilder(moduleName, onlyGlobalName, false, "If set, only global monotonicity will be used.").build());
             }
@@ -70,6 +76,22 @@ namespace storm {
                 return this->getOption(sampleExactOptionName).getHasOptionBeenSet();
             }
 
+            bool ParametricSettings::isSamplesBatchSet() const {
+                return this->getOption(samplesBatchOptionName).getHasOptionBeenSet();
+            }
+
+            uint64_t ParametricSettings::getSamplesBatchSize() const {
+                return this->getOption(samplesBatchOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+            }
+
+            bool ParametricSettings::isExportSamplesSet() const {
+                return this->getOption(exportSamplesOptionName).getHasOptionBeenSet();
+            }
+
+            std::string ParametricSettings::getExportSamplesPath() const {
+                return this->getOption(exportSamplesOptionName).getArgumentByName("path").getValueAsString();
+            }
+
             bool ParametricSettings::isUseMonotonicitySet() const {
                 return this->getOption(useMonotonicityName).getHasOptionBeenSet();
             }
@@ -64,6 +64,26 @@ namespace storm {
                  */
                 bool isSampleExactSet() const;
 
+                /*!
+                 * Retrieves whether all samples are to be checked at once with batched value iteration.
+                 */
+                bool isSamplesBatchSet() const;
+
+                /*!
+                 * Retrieves the number of samples that are solved together in batch mode.
+                 */
+                uint64_t getSamplesBatchSize() const;
+
+                /*!
+                 * Retrieves whether the sampling results are to be exported.
+                 */
+                bool isExportSamplesSet() const;
+
+                /*!
+                 * Retrieves the path of the file to which the sampling results are exported.
+                 */
+                std::string getExportSamplesPath() const;
+
                 /*!
                  * Retrieves whether monotonicity should be used
                  */
@@ -82,6 +102,8 @@ namespace storm {
                 const static std::string samplesOptionName;
                 const static std::string samplesGraphPreservingOptionName;
                 const static std::string sampleExactOptionName;
+                const static std::string samplesBatchOptionName;
+                const static std::string exportSamplesOptionName;
                 const static std::string useMonotonicityName;
 //                const static std::string onlyGlobalName;
 
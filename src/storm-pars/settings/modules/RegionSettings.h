@@ -70,6 +70,11 @@ namespace storm {
                  * Returns the depth threshold (if set). It is illegal to call this method if no depth threshold has been set.
                  */
                 uint64_t getDepthLimit() const;
+
+                /*!
+                 * Retrieves the number of region model checkers that analyze regions concurrently during refinement
+                 */
+                uint64_t getNumberOfRefinementWorkers() const;
                 
                 /*!
 				 * Retrieves whether an extremal value is to be computed
@@ -122,6 +127,7 @@ namespace storm {
 				const static std::string hypothesisOptionName;
 				const static std::string hypothesisShortOptionName;
 				const static std::string refineOptionName;
+				const static std::string refinementWorkersOptionName;
 				const static std::string splittingThresholdName;
 				const static std::string extremumOptionName;
 				const static std::string extremumSuggestionOptionName;
@@ -1,5 +1,9 @@
 #include "storm-pars/transformer/ParameterLifter.h"
 
+#include <algorithm>
+#include <map>
+#include <type_traits>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/vector.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -331,6 +335,56 @@ namespace storm {
     
         template<typename ParametricType, typename ConstantType>
         void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            if (std::is_same<ConstantType, double>::value) {
+                // Evaluate the compiled functions at the vertices of the region
+                if (compiledFunctionValuations.size() != collectedFunctions.size()) {
+                    compileCollectedFunctions();
+                }
+                auto const& variables = compiledFunctions.getVariables();
+                std::vector<double> lowerValues, upperValues;
+                lowerValues.reserve(variables.size());
+                upperValues.reserve(variables.size());
+                for (auto const& variable : variables) {
+                    lowerValues.push_back(storm::utility::convertNumber<double>(region.getLowerBoundary(variable)));
+                    upperValues.push_back(storm::utility::convertNumber<double>(region.getUpperBoundary(variable)));
+                }
+                if (useBatchEvaluation) {
+                    uint64_t const batchSize = vertexValuations.size();
+                    batchVariableValues.resize(variables.size() * batchSize);
+                    for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+                        for (uint64_t vertex = 0; vertex < batchSize; ++vertex) {
+                            batchVariableValues[variable * batchSize + vertex] = vertexValuations[vertex][variable] ? upperValues[variable] : lowerValues[variable];
+                        }
+                    }
+                    compiledFunctions.evaluate(batchVariableValues, batchSize, batchResults);
+                }
+                std::vector<double> variableValues(variables.size());
+                for (auto const& functionValuation : compiledFunctionValuations) {
+                    double result = 0.0;
+                    for (uint64_t vertexIndex = 0; vertexIndex < functionValuation.vertexValuations.size(); ++vertexIndex) {
+                        uint64_t const vertex = functionValuation.vertexValuations[vertexIndex];
+                        double currentResult;
+                        if (useBatchEvaluation) {
+                            currentResult = batchResults[functionValuation.function * vertexValuations.size() + vertex];
+                        } else {
+                            for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+                                variableValues[variable] = vertexValuations[vertex][variable] ? upperValues[variable] : lowerValues[variable];
+                            }
+                            currentResult = compiledFunctions.evaluate(functionValuation.function, variableValues);
+                        }
+                        if (vertexIndex == 0) {
+                            result = currentResult;
+                        } else if (storm::solver::minimize(dirForUnspecifiedParameters)) {
+                            result = std::min(result, currentResult);
+                        } else {
+                            result = std::max(result, currentResult);
+                        }
+                    }
+                    *functionValuation.placeholder = storm::utility::convertNumber<ConstantType>(result);
+                }
+                return;
+            }
+
             for (auto &collectedFunctionValuationPlaceholder : collectedFunctions) {
                 ParametricType const &function = collectedFunctionValuationPlaceholder.first.first;
                 AbstractValuation const &abstrValuation = collectedFunctionValuationPlaceholder.first.second;
@@ -349,6 +403,54 @@ namespace storm {
             }
         }
         
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::compileCollectedFunctions() {
+            compiledFunctionValuations.clear();
+            compiledFunctionValuations.reserve(collectedFunctions.size());
+            for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
+                AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
+                CompiledFunctionValuation compiledFunctionValuation;
+                compiledFunctionValuation.function = compiledFunctions.add(collectedFunctionValuationPlaceholder.first.first);
+                for (auto const& variable : abstrValuation.getLowerParameters()) {
+                    compiledFunctionValuation.lowerVariables.push_back(compiledFunctions.getVariableIndex(variable));
+                }
+                for (auto const& variable : abstrValuation.getUpperParameters()) {
+                    compiledFunctionValuation.upperVariables.push_back(compiledFunctions.getVariableIndex(variable));
+                }
+                for (auto const& variable : abstrValuation.getUnspecifiedParameters()) {
+                    compiledFunctionValuation.unspecifiedVariables.push_back(compiledFunctions.getVariableIndex(variable));
+                }
+                compiledFunctionValuation.placeholder = &collectedFunctionValuationPlaceholder.second;
+                compiledFunctionValuations.push_back(std::move(compiledFunctionValuation));
+            }
+
+            // Determine the vertices of the region at which the functions need to be evaluated. This can only be done once all functions are added,
+            // as only then the variables are known. Variables that do not occur in a function are set to their lower bound.
+            vertexValuations.clear();
+            std::map<std::vector<bool>, uint64_t> vertexValuationIndices;
+            uint64_t numberOfNeededEvaluations = 0;
+            for (auto& compiledFunctionValuation : compiledFunctionValuations) {
+                std::vector<bool> vertexValuation(compiledFunctions.getVariables().size(), false);
+                for (auto const& variable : compiledFunctionValuation.upperVariables) {
+                    vertexValuation[variable] = true;
+                }
+                uint64_t const numberOfVertices = 1ull << compiledFunctionValuation.unspecifiedVariables.size();
+                for (uint64_t vertex = 0; vertex < numberOfVertices; ++vertex) {
+                    for (uint64_t variableIndex = 0; variableIndex < compiledFunctionValuation.unspecifiedVariables.size(); ++variableIndex) {
+                        vertexValuation[compiledFunctionValuation.unspecifiedVariables[variableIndex]] = (vertex >> variableIndex) % 2 != 0;
+                    }
+                    auto insertionRes = vertexValuationIndices.emplace(vertexValuation, vertexValuations.size());
+                    if (insertionRes.second) {
+                        vertexValuations.push_back(vertexValuation);
+                    }
+                    compiledFunctionValuation.vertexValuations.push_back(insertionRes.first->second);
+                }
+                numberOfNeededEvaluations += numberOfVertices;
+            }
+            // The batch evaluates every function at every vertex, which only pays off if most of these evaluations are needed.
+            useBatchEvaluation = compiledFunctions.getNumberOfFunctions() * vertexValuations.size() <= 4 * numberOfNeededEvaluations;
+        }
+
         template class ParameterLifter<storm::RationalFunction, double>;
         template class ParameterLifter<storm::RationalFunction, storm::RationalNumber>;
     }
@@ -8,6 +8,7 @@
 
 #include "storm-pars/storage/ParameterRegion.h"
 #include "storm-pars/utility/parametric.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/solver/OptimizationDirection.h"
@@ -150,6 +151,28 @@ namespace storm {
 
                 // Stores the collected functions with the valuations together with a placeholder for the result.
                 std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+
+                /*!
+                 * Compiles the collected functions such that they can be evaluated in double precision without invoking carl.
+                 */
+                void compileCollectedFunctions();
+
+                // A collected function and valuation in terms of the indices of the compiled functions and variables.
+                struct CompiledFunctionValuation {
+                    uint64_t function;
+                    std::vector<uint64_t> lowerVariables, upperVariables, unspecifiedVariables;
+                    // The indices of the vertex valuations (see below) at which the function needs to be evaluated
+                    std::vector<uint64_t> vertexValuations;
+                    ConstantType* placeholder;
+                };
+                storm::utility::parametric::CompiledRationalFunctions compiledFunctions;
+                std::vector<CompiledFunctionValuation> compiledFunctionValuations;
+                // The distinct vertices of the region that are needed for the collected valuations. Each vertex is given by the set of variables
+                // (indexed as in the compiled functions) that are at their upper bound. All functions are evaluated at these vertices in a single batch.
+                std::vector<std::vector<bool>> vertexValuations;
+                // Whether the batch evaluation is used. This is not the case if it evaluates many more function/vertex pairs than needed.
+                bool useBatchEvaluation = false;
+                std::vector<double> batchVariableValues, batchResults;
             };
             
             FunctionValuationCollector functionValuationCollector;
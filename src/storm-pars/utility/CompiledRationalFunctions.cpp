@@ -0,0 +1,190 @@
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+            const uint64_t CompiledRationalFunctions::noIndex = std::numeric_limits<uint64_t>::max();
+
+            uint64_t CompiledRationalFunctions::add(storm::RationalFunction const& function) {
+                auto functionIt = functionIndices.find(function);
+                if (functionIt != functionIndices.end()) {
+                    return functionIt->second;
+                }
+
+                uint64_t result = nominators.size();
+                if (function.denominator().isConstant()) {
+                    nominators.push_back(addPolynomial(function.nominator().polynomialWithCoefficient(), storm::utility::convertNumber<double>(function.denominator().constantPart())));
+                    denominators.push_back(noIndex);
+                } else {
+                    nominators.push_back(addPolynomial(function.nominator().polynomialWithCoefficient(), 1.0));
+                    denominators.push_back(addPolynomial(function.denominator().polynomialWithCoefficient(), 1.0));
+                }
+                functionIndices.emplace(function, result);
+                return result;
+            }
+
+            uint64_t CompiledRationalFunctions::getNumberOfFunctions() const {
+                return nominators.size();
+            }
+
+            std::vector<CompiledRationalFunctions::VariableType> const& CompiledRationalFunctions::getVariables() const {
+                return variables;
+            }
+
+            uint64_t CompiledRationalFunctions::getVariableIndex(VariableType const& variable) const {
+                auto variableIt = variableIndices.find(variable);
+                STORM_LOG_THROW(variableIt != variableIndices.end(), storm::exceptions::InvalidArgumentException, "The variable " << variable << " does not occur in the compiled functions.");
+                return variableIt->second;
+            }
+
+            std::vector<double> CompiledRationalFunctions::getVariableValues(Valuation<storm::RationalFunction> const& valuation) const {
+                std::vector<double> result;
+                result.reserve(variables.size());
+                for (auto const& variable : variables) {
+                    auto valuationIt = valuation.find(variable);
+                    STORM_LOG_THROW(valuationIt != valuation.end(), storm::exceptions::InvalidArgumentException, "No value given for the variable " << variable << ".");
+                    result.push_back(storm::utility::convertNumber<double>(valuationIt->second));
+                }
+                return result;
+            }
+
+            void CompiledRationalFunctions::evaluate(std::vector<double> const& variableValues, uint64_t batchSize, std::vector<double>& result) const {
+                STORM_LOG_ASSERT(variableValues.size() == variables.size() * batchSize, "Unexpected number of variable values.");
+                // All intermediate results are stored such that the values for the different valuations are consecutive, which allows the compiler to vectorize the inner loops.
+                std::vector<double> powerValues(powerVariables.size() * batchSize);
+                for (uint64_t power = 0; power < powerVariables.size(); ++power) {
+                    double* values = powerValues.data() + power * batchSize;
+                    double const* variableValue = variableValues.data() + powerVariables[power] * batchSize;
+                    if (powerPredecessors[power] == noIndex) {
+                        std::copy(variableValue, variableValue + batchSize, values);
+                    } else {
+                        double const* predecessorValue = powerValues.data() + powerPredecessors[power] * batchSize;
+                        for (uint64_t j = 0; j < batchSize; ++j) {
+                            values[j] = predecessorValue[j] * variableValue[j];
+                        }
+                    }
+                }
+
+                uint64_t numberOfMonomials = monomialOffsets.size() - 1;
+                std::vector<double> monomialValues(numberOfMonomials * batchSize);
+                for (uint64_t monomial = 0; monomial < numberOfMonomials; ++monomial) {
+                    double* values = monomialValues.data() + monomial * batchSize;
+                    double const* firstFactorValue = powerValues.data() + monomialFactors[monomialOffsets[monomial]] * batchSize;
+                    std::copy(firstFactorValue, firstFactorValue + batchSize, values);
+                    for (uint64_t factor = monomialOffsets[monomial] + 1; factor < monomialOffsets[monomial + 1]; ++factor) {
+                        double const* factorValue = powerValues.data() + monomialFactors[factor] * batchSize;
+                        for (uint64_t j = 0; j < batchSize; ++j) {
+                            values[j] *= factorValue[j];
+                        }
+                    }
+                }
+
+                std::vector<double> polynomialValues(polynomialConstants.size() * batchSize);
+                for (uint64_t polynomial = 0; polynomial < polynomialConstants.size(); ++polynomial) {
+                    double* values = polynomialValues.data() + polynomial * batchSize;
+                    std::fill(values, values + batchSize, polynomialConstants[polynomial]);
+                    for (uint64_t term = termOffsets[polynomial]; term < termOffsets[polynomial + 1]; ++term) {
+                        double const coefficient = termCoefficients[term];
+                        double const* monomialValue = monomialValues.data() + termMonomials[term] * batchSize;
+                        for (uint64_t j = 0; j < batchSize; ++j) {
+                            values[j] += coefficient * monomialValue[j];
+                        }
+                    }
+                }
+
+                result.resize(nominators.size() * batchSize);
+                for (uint64_t function = 0; function < nominators.size(); ++function) {
+                    double* values = result.data() + function * batchSize;
+                    double const* nominatorValue = polynomialValues.data() + nominators[function] * batchSize;
+                    if (denominators[function] == noIndex) {
+                        std::copy(nominatorValue, nominatorValue + batchSize, values);
+                    } else {
+                        double const* denominatorValue = polynomialValues.data() + denominators[function] * batchSize;
+                        for (uint64_t j = 0; j < batchSize; ++j) {
+                            values[j] = nominatorValue[j] / denominatorValue[j];
+                        }
+                    }
+                }
+            }
+
+            double CompiledRationalFunctions::evaluate(uint64_t function, std::vector<double> const& variableValues) const {
+                STORM_LOG_ASSERT(variableValues.size() == variables.size(), "Unexpected number of variable values.");
+                double result = evaluatePolynomial(nominators[function], variableValues);
+                if (denominators[function] != noIndex) {
+                    result /= evaluatePolynomial(denominators[function], variableValues);
+                }
+                return result;
+            }
+
+            double CompiledRationalFunctions::evaluatePolynomial(uint64_t polynomial, std::vector<double> const& variableValues) const {
+                double result = polynomialConstants[polynomial];
+                for (uint64_t term = termOffsets[polynomial]; term < termOffsets[polynomial + 1]; ++term) {
+                    double termValue = termCoefficients[term];
+                    uint64_t monomial = termMonomials[term];
+                    for (uint64_t factor = monomialOffsets[monomial]; factor < monomialOffsets[monomial + 1]; ++factor) {
+                        uint64_t power = monomialFactors[factor];
+                        termValue *= std::pow(variableValues[powerVariables[power]], powerExponents[power]);
+                    }
+                    result += termValue;
+                }
+                return result;
+            }
+
+            uint64_t CompiledRationalFunctions::getPower(uint64_t variable, uint64_t exponent) {
+                auto powerIt = powerIndices.find(std::make_pair(variable, exponent));
+                if (powerIt != powerIndices.end()) {
+                    return powerIt->second;
+                }
+                uint64_t predecessor = exponent > 1 ? getPower(variable, exponent - 1) : noIndex;
+                uint64_t result = powerVariables.size();
+                powerVariables.push_back(variable);
+                powerExponents.push_back(exponent);
+                powerPredecessors.push_back(predecessor);
+                powerIndices.emplace(std::make_pair(variable, exponent), result);
+                return result;
+            }
+
+            uint64_t CompiledRationalFunctions::addPolynomial(storm::RawPolynomial const& polynomial, double const& divisor) {
+                uint64_t result = polynomialConstants.size();
+                double constant = 0.0;
+                for (auto const& term : polynomial) {
+                    double coefficient = storm::utility::convertNumber<double>(term.coeff()) / divisor;
+                    if (term.isConstant()) {
+                        constant += coefficient;
+                        continue;
+                    }
+                    std::vector<uint64_t> factors;
+                    for (auto const& variableExponent : term.monomial()->exponents()) {
+                        auto variableIt = variableIndices.find(variableExponent.first);
+                        if (variableIt == variableIndices.end()) {
+                            variableIt = variableIndices.emplace(variableExponent.first, variables.size()).first;
+                            variables.push_back(variableExponent.first);
+                        }
+                        factors.push_back(getPower(variableIt->second, variableExponent.second));
+                    }
+                    auto monomialIt = monomialIndices.find(factors);
+                    if (monomialIt == monomialIndices.end()) {
+                        monomialIt = monomialIndices.emplace(factors, monomialOffsets.size() - 1).first;
+                        monomialFactors.insert(monomialFactors.end(), factors.begin(), factors.end());
+                        monomialOffsets.push_back(monomialFactors.size());
+                    }
+                    termCoefficients.push_back(coefficient);
+                    termMonomials.push_back(monomialIt->second);
+                }
+                polynomialConstants.push_back(constant);
+                termOffsets.push_back(termCoefficients.size());
+                return result;
+            }
+
+        }
+    }
+}
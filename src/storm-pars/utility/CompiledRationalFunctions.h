@@ -0,0 +1,94 @@
+#pragma once
+
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+            /*!
+             * Compiles a collection of rational functions into a flat program that evaluates them in double precision.
+             * Powers of variables and monomials that occur in several functions are only evaluated once per valuation and
+             * constant denominators are folded into the coefficients of the nominator.
+             * Valuations are given as vectors indexed by the variable indices of this program (see getVariables()).
+             */
+            class CompiledRationalFunctions {
+            public:
+                typedef storm::RationalFunctionVariable VariableType;
+
+                CompiledRationalFunctions() = default;
+
+                /*!
+                 * Adds the given function to the program.
+                 * @return the index of the function. Equal functions get the same index.
+                 */
+                uint64_t add(storm::RationalFunction const& function);
+
+                uint64_t getNumberOfFunctions() const;
+
+                /*!
+                 * Retrieves the variables of all added functions, ordered by their index.
+                 */
+                std::vector<VariableType> const& getVariables() const;
+
+                uint64_t getVariableIndex(VariableType const& variable) const;
+
+                /*!
+                 * Converts the given valuation into a vector of variable values as expected by the evaluation methods.
+                 */
+                std::vector<double> getVariableValues(Valuation<storm::RationalFunction> const& valuation) const;
+
+                /*!
+                 * Evaluates all functions for a batch of valuations.
+                 * @param variableValues the value of variable v in the j-th valuation is at position v * batchSize + j
+                 * @param batchSize the number of valuations
+                 * @param result the value of function f under the j-th valuation is written to position f * batchSize + j
+                 */
+                void evaluate(std::vector<double> const& variableValues, uint64_t batchSize, std::vector<double>& result) const;
+
+                /*!
+                 * Evaluates a single function for the given variable values (indexed by variable index).
+                 */
+                double evaluate(uint64_t function, std::vector<double> const& variableValues) const;
+
+            private:
+                uint64_t getPower(uint64_t variable, uint64_t exponent);
+                uint64_t addPolynomial(storm::RawPolynomial const& polynomial, double const& divisor);
+                double evaluatePolynomial(uint64_t polynomial, std::vector<double> const& variableValues) const;
+
+                static const uint64_t noIndex;
+
+                std::vector<VariableType> variables;
+                std::map<VariableType, uint64_t> variableIndices;
+
+                // x^e is computed as x^(e-1) * x, where x^(e-1) is always evaluated first.
+                std::vector<uint64_t> powerVariables;
+                std::vector<uint64_t> powerExponents;
+                std::vector<uint64_t> powerPredecessors;
+                std::map<std::pair<uint64_t, uint64_t>, uint64_t> powerIndices;
+
+                // Each monomial is a product of (at least one) powers.
+                std::vector<uint64_t> monomialOffsets = {0};
+                std::vector<uint64_t> monomialFactors;
+                std::map<std::vector<uint64_t>, uint64_t> monomialIndices;
+
+                // Each polynomial is a constant plus a weighted sum of monomials.
+                std::vector<double> polynomialConstants;
+                std::vector<uint64_t> termOffsets = {0};
+                std::vector<double> termCoefficients;
+                std::vector<uint64_t> termMonomials;
+
+                // Each function is a nominator polynomial and an optional denominator polynomial.
+                std::vector<uint64_t> nominators;
+                std::vector<uint64_t> denominators;
+                std::unordered_map<storm::RationalFunction, uint64_t> functionIndices;
+            };
+
+        }
+    }
+}
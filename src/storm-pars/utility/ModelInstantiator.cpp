@@ -21,6 +21,14 @@ namespace storm {
                         initializeMatrixMapping(rewModel.second.getTransitionRewardMatrix(), this->functions, this->matrixMapping, parametricModel.getRewardModel(rewModel.first).getTransitionRewardMatrix());
                     }
                 }
+                
+                if (std::is_same<ConstantType, double>::value) {
+                    for (auto& functionResult : this->functions) {
+                        uint64_t function = this->compiledFunctions.add(functionResult.first);
+                        STORM_LOG_ASSERT(function == this->compiledFunctionPlaceholders.size(), "Unexpected index of compiled function.");
+                        this->compiledFunctionPlaceholders.push_back(&functionResult.second);
+                    }
+                }
             }
             
             template<typename ParametricSparseModelType, typename ConstantType>
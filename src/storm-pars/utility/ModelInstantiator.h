@@ -6,6 +6,7 @@
 #include <type_traits>
 
 #include "storm-pars/utility/parametric.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -134,6 +135,14 @@ namespace storm {
                         !std::is_same<PMT,ConstantSparseModelType>::value
                 >::type
                 instantiate_helper(storm::utility::parametric::Valuation<ParametricType> const& valuation) {
+                    if (std::is_same<ConstantType, double>::value) {
+                        // Evaluate all functions at once using the compiled program
+                        this->compiledFunctions.evaluate(this->compiledFunctions.getVariableValues(valuation), 1, this->compiledFunctionResults);
+                        for (uint64_t function = 0; function < this->compiledFunctionPlaceholders.size(); ++function) {
+                            *this->compiledFunctionPlaceholders[function] = storm::utility::convertNumber<ConstantType>(this->compiledFunctionResults[function]);
+                        }
+                        return;
+                    }
                     for(auto& functionResult : this->functions){
                         functionResult.second=storm::utility::convertNumber<ConstantType>(
                                 storm::utility::parametric::evaluate(functionResult.first, valuation));
@@ -189,6 +198,11 @@ namespace storm {
                 std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping; 
                 /// Connection of Vector entries with placeholders
                 std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping; 
+                /// The occurring functions compiled for the evaluation in double precision (only used if the constant type is double)
+                storm::utility::parametric::CompiledRationalFunctions compiledFunctions;
+                /// The placeholders for the results of the compiled functions (indexed by the function index within the compiled functions)
+                std::vector<ConstantType*> compiledFunctionPlaceholders;
+                std::vector<double> compiledFunctionResults;
                 
                 
             };
@@ -6,6 +6,7 @@
 #include <regex>
 #include <string>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/exceptions/AbortException.h"
@@ -160,9 +161,51 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
         modelComponents->rateTransitions = true;
     }
 
+    // Values of transitions can be parsed in parallel. In this case, the transitions (and the starts of row groups) are buffered and inserted into the
+    // builder in the original order once the values of the current chunk have been parsed. Only doubles are parsed in parallel, as the parsers of
+    // exact numbers and rational functions are not thread-safe.
+    bool parseInParallel = options.parseValuesInParallel && std::is_same<ValueType, double>::value;
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!parseInParallel, "Parallel parsing of DRN files requires Intel TBB. Falling back to sequential parsing.");
+    parseInParallel = false;
+#endif
+    STORM_LOG_THROW(!parseInParallel || options.transitionsPerChunk > 0, storm::exceptions::InvalidArgumentException,
+                    "The number of transitions per chunk must be positive.");
+    struct PendingTransition {
+        size_t row;
+        size_t target;
+        std::string valueString;
+    };
+    std::vector<PendingTransition> pendingTransitions;
+    // Pairs of the number of pending transitions preceding a row group and the starting row of that row group.
+    std::vector<std::pair<size_t, size_t>> pendingRowGroups;
+    auto flushPendingTransitions = [&]() {
+        std::vector<ValueType> values(pendingTransitions.size());
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, pendingTransitions.size()), [&](tbb::blocked_range<size_t> const& range) {
+            for (size_t index = range.begin(); index < range.end(); ++index) {
+                values[index] = parseValue(pendingTransitions[index].valueString, placeholders, valueParser);
+            }
+        });
+#endif
+        auto rowGroupIt = pendingRowGroups.begin();
+        for (size_t index = 0; index < pendingTransitions.size(); ++index) {
+            for (; rowGroupIt != pendingRowGroups.end() && rowGroupIt->first == index; ++rowGroupIt) {
+                builder.newRowGroup(rowGroupIt->second);
+            }
+            builder.addNextValue(pendingTransitions[index].row, pendingTransitions[index].target, std::move(values[index]));
+        }
+        for (; rowGroupIt != pendingRowGroups.end(); ++rowGroupIt) {
+            builder.newRowGroup(rowGroupIt->second);
+        }
+        pendingTransitions.clear();
+        pendingRowGroups.clear();
+    };
+
     // Iterate over all lines
     std::string line;
     size_t row = 0;
+    size_t rowGroupCount = 0;
     size_t state = 0;
     uint64_t lineNumber = 0;
     bool firstState = true;
@@ -204,8 +247,13 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                             "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << state << " but got " << parsedId << ".");
             if (nonDeterministic) {
                 STORM_LOG_TRACE("new Row Group starts at " << row << ".");
-                builder.newRowGroup(row);
-                STORM_LOG_THROW(nrChoices == 0 || builder.getCurrentRowGroupCount() < nrChoices, storm::exceptions::WrongFormatException,
+                if (parseInParallel) {
+                    pendingRowGroups.emplace_back(pendingTransitions.size(), row);
+                } else {
+                    builder.newRowGroup(row);
+                }
+                ++rowGroupCount;
+                STORM_LOG_THROW(nrChoices == 0 || rowGroupCount < nrChoices, storm::exceptions::WrongFormatException,
                                 "More actions detected than declared (in @nr_choices).");
             }
 
@@ -360,12 +408,19 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
             STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException,
                             "':' not found in '" << line << "' on line " << lineNumber << ".");
             size_t target = parseNumber<size_t>(line.substr(0, posColon - 1));
-            std::string valueStr = line.substr(posColon + 2);
-            ValueType value = parseValue(valueStr, placeholders, valueParser);
-            STORM_LOG_TRACE("Transition " << row << " -> " << target << ": " << value);
             STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
                             "In line " << lineNumber << " target state " << target << " is greater than state size " << stateSize);
-            builder.addNextValue(row, target, value);
+            std::string valueStr = line.substr(posColon + 2);
+            if (parseInParallel) {
+                pendingTransitions.push_back({row, target, std::move(valueStr)});
+                if (pendingTransitions.size() >= options.transitionsPerChunk) {
+                    flushPendingTransitions();
+                }
+            } else {
+                ValueType value = parseValue(valueStr, placeholders, valueParser);
+                STORM_LOG_TRACE("Transition " << row << " -> " << target << ": " << value);
+                builder.addNextValue(row, target, value);
+            }
         }
 
         if (storm::utility::resources::isTerminate()) {
@@ -375,6 +430,9 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
         }
 
     }  // end state iteration
+    if (parseInParallel) {
+        flushPendingTransitions();
+    }
     STORM_LOG_TRACE("Finished parsing");
 
     if (nonDeterministic) {
@@ -11,6 +11,10 @@ namespace parser {
 
 struct DirectEncodingParserOptions {
     bool buildChoiceLabeling = false;
+    // If set, the values of transitions are parsed in parallel (requires Intel TBB). Only supported for models with double values.
+    bool parseValuesInParallel = false;
+    // The number of transitions whose values are parsed together (only relevant when parsing in parallel).
+    uint64_t transitionsPerChunk = 1ull << 16;
 };
 /*!
  *	Parser for models in the DRN format with explicit encoding.
@@ -34,6 +34,7 @@
 #include "storm-pomdp-cli/settings/modules/POMDPSettings.h"
 #include "storm-pomdp-cli/settings/modules/QualitativePOMDPAnalysisSettings.h"
 #include "storm-pomdp-cli/settings/modules/BeliefExplorationSettings.h"
+#include "storm-pomdp-cli/settings/modules/PointBasedSettings.h"
 #include "storm-pomdp-cli/settings/modules/ToParametricSettings.h"
 
 
@@ -52,6 +53,7 @@ namespace storm {
             storm::settings::addModule<storm::settings::modules::POMDPSettings>();
             storm::settings::addModule<storm::settings::modules::QualitativePOMDPAnalysisSettings>();
             storm::settings::addModule<storm::settings::modules::BeliefExplorationSettings>();
+            storm::settings::addModule<storm::settings::modules::PointBasedSettings>();
             storm::settings::addModule<storm::settings::modules::ToParametricSettings>();
         
             storm::settings::addModule<storm::settings::modules::TransformationSettings>();
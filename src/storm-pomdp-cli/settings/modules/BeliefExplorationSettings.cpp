@@ -28,6 +28,8 @@ namespace storm {
             const std::string observationThresholdOption = "obs-threshold";
             const std::string numericPrecisionOption = "numeric-precision";
             const std::string triangulationModeOption = "triangulationmode";
+            const std::string parallelExpansionOption = "parallel-expansion";
+            const std::string incrementalValuesOption = "incremental-values";
 
             BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleName) {
                 
@@ -50,6 +52,10 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, triangulationModeOption, false,"Sets how to triangulate beliefs when discretizing.").setIsAdvanced().addArgument(
                         storm::settings::ArgumentBuilder::createStringArgument("value","the triangulation mode").setDefaultValueString("dynamic").addValidatorString(storm::settings::ArgumentValidatorFactory::createMultipleChoiceValidator({"dynamic", "static"})).build()).build());
+
+                this->addOption(storm::settings::OptionBuilder(moduleName, parallelExpansionOption, false,"If set, the successors of the beliefs in the exploration queue are computed in parallel (requires Intel TBB and --enable-tbb).").setIsAdvanced().build());
+
+                this->addOption(storm::settings::OptionBuilder(moduleName, incrementalValuesOption, false,"Sets whether after a refinement step only the values of states that can reach a changed part of the belief MDP are re-computed.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("value","on or off").setDefaultValueString("on").addValidatorString(storm::settings::ArgumentValidatorFactory::createMultipleChoiceValidator({"on", "off"})).build()).addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("limit","The number of consecutive incremental computations after which all values are re-computed.").setDefaultValueUnsignedInteger(4).makeOptional().build()).build());
             }
 
             bool BeliefExplorationSettings::isRefineSet() const {
@@ -132,6 +138,18 @@ namespace storm {
             bool BeliefExplorationSettings::isStaticTriangulationModeSet() const {
                 return this->getOption(triangulationModeOption).getArgumentByName("value").getValueAsString() == "static";
             }
+
+            bool BeliefExplorationSettings::isParallelExpansionSet() const {
+                return this->getOption(parallelExpansionOption).getHasOptionBeenSet();
+            }
+
+            bool BeliefExplorationSettings::isIncrementalValueComputationSet() const {
+                return this->getOption(incrementalValuesOption).getArgumentByName("value").getValueAsString() == "on";
+            }
+
+            uint64_t BeliefExplorationSettings::getMaximalNumberOfConsecutiveIncrementalChecks() const {
+                return this->getOption(incrementalValuesOption).getArgumentByName("limit").getValueAsUnsignedInteger();
+            }
             
             template<typename ValueType>
             void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const {
@@ -168,6 +186,9 @@ namespace storm {
                     }
                 }
                 options.dynamicTriangulation = isDynamicTriangulationModeSet();
+                options.parallelExpansion = isParallelExpansionSet();
+                options.incrementalValueComputation = isIncrementalValueComputationSet();
+                options.maximalNumberOfConsecutiveIncrementalChecks = getMaximalNumberOfConsecutiveIncrementalChecks();
             }
             
             template void BeliefExplorationSettings::setValuesInOptionsStruct<double>(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<double>& options) const;
@@ -60,6 +60,12 @@ namespace storm {
                 
                 bool isDynamicTriangulationModeSet() const;
                 bool isStaticTriangulationModeSet() const;
+
+                bool isParallelExpansionSet() const;
+
+                /// Controls whether only the values of states affected by a refinement step are re-computed
+                bool isIncrementalValueComputationSet() const;
+                uint64_t getMaximalNumberOfConsecutiveIncrementalChecks() const;
     
                 template<typename ValueType>
                 void setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const;
@@ -0,0 +1,116 @@
+#include "storm-pomdp-cli/settings/modules/PointBasedSettings.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/ArgumentBuilder.h"
+
+#include "storm/utility/NumberTraits.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelCheckerOptions.h"
+
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            const std::string PointBasedSettings::moduleName = "pbvi";
+            
+            const std::string precisionOption = "precision";
+            const std::string trialLimitOption = "trials";
+            const std::string timeLimitOption = "time";
+            const std::string trialDepthOption = "trial-depth";
+            const std::string pruneIntervalOption = "prune-interval";
+            const std::string numericPrecisionOption = "numeric-precision";
+
+            PointBasedSettings::PointBasedSettings() : ModuleSettings(moduleName) {
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, precisionOption, false,"Sets the goal gap between the lower and the upper bound at the initial belief.").addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value","The goal precision.").setDefaultValueDouble(1e-4).addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleGreaterEqualValidator(0.0)).build()).addArgument(storm::settings::ArgumentBuilder::createStringArgument("kind","Whether the gap is absolute or relative to the upper bound.").setDefaultValueString("absolute").makeOptional().addValidatorString(storm::settings::ArgumentValidatorFactory::createMultipleChoiceValidator({"absolute", "relative"})).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, trialLimitOption, false, "Sets the maximal number of trials.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count","The number of trials.").build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, timeLimitOption, false, "Sets after which time no further trials are started.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time","In seconds.").build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, trialDepthOption, false,"Sets the maximal number of beliefs that are visited in a single trial.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("depth","The maximal depth.").setDefaultValueUnsignedInteger(200).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, pruneIntervalOption, false,"Sets after how many trials alpha-vectors that are not optimal at any visited belief are removed.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("trials","The number of trials between two prunings (0 means never).").setDefaultValueUnsignedInteger(16).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, numericPrecisionOption, false,"Sets the precision used to determine whether two belief-states are equal.").setIsAdvanced().addArgument(
+                        storm::settings::ArgumentBuilder::createDoubleArgument("value","the precision").setDefaultValueDouble(1e-9).makeOptional().addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0, 1)).build()).build());
+            }
+
+            double PointBasedSettings::getPrecision() const {
+                return this->getOption(precisionOption).getArgumentByName("value").getValueAsDouble();
+            }
+            
+            bool PointBasedSettings::isRelativePrecisionSet() const {
+                return this->getOption(precisionOption).getArgumentByName("kind").getValueAsString() == "relative";
+            }
+            
+            bool PointBasedSettings::isTrialLimitSet() const {
+                return this->getOption(trialLimitOption).getHasOptionBeenSet();
+            }
+            
+            uint64_t PointBasedSettings::getTrialLimit() const {
+                return this->getOption(trialLimitOption).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            bool PointBasedSettings::isTimeLimitSet() const {
+                return this->getOption(timeLimitOption).getHasOptionBeenSet();
+            }
+            
+            uint64_t PointBasedSettings::getTimeLimit() const {
+                return this->getOption(timeLimitOption).getArgumentByName("time").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t PointBasedSettings::getMaxTrialDepth() const {
+                return this->getOption(trialDepthOption).getArgumentByName("depth").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t PointBasedSettings::getPruneInterval() const {
+                return this->getOption(pruneIntervalOption).getArgumentByName("trials").getValueAsUnsignedInteger();
+            }
+            
+            bool PointBasedSettings::isNumericPrecisionSetFromDefault() const {
+                return !this->getOption(numericPrecisionOption).getHasOptionBeenSet() || this->getOption(numericPrecisionOption).getArgumentByName("value").wasSetFromDefaultValue();
+            }
+            
+            double PointBasedSettings::getNumericPrecision() const {
+                return this->getOption(numericPrecisionOption).getArgumentByName("value").getValueAsDouble();
+            }
+            
+            template<typename ValueType>
+            void PointBasedSettings::setValuesInOptionsStruct(storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<ValueType>& options) const {
+                options.precision = storm::utility::convertNumber<ValueType>(getPrecision());
+                options.relativePrecision = isRelativePrecisionSet();
+                if (isTrialLimitSet()) {
+                    options.trialLimit = getTrialLimit();
+                } else {
+                    options.trialLimit = boost::none;
+                }
+                if (isTimeLimitSet()) {
+                    options.timeLimit = getTimeLimit();
+                } else {
+                    options.timeLimit = boost::none;
+                }
+                options.maxTrialDepth = getMaxTrialDepth();
+                options.pruneInterval = getPruneInterval();
+                
+                options.numericPrecision = storm::utility::convertNumber<ValueType>(getNumericPrecision());
+                if (storm::NumberTraits<ValueType>::IsExact) {
+                    if (isNumericPrecisionSetFromDefault()) {
+                        STORM_LOG_WARN_COND(storm::utility::isZero(options.numericPrecision), "Setting numeric precision to zero because exact arithmethic is used.");
+                        options.numericPrecision = storm::utility::zero<ValueType>();
+                    } else {
+                        STORM_LOG_WARN_COND(storm::utility::isZero(options.numericPrecision), "A non-zero numeric precision was set although exact arithmethic is used. Results might be inexact.");
+                    }
+                }
+            }
+            
+            template void PointBasedSettings::setValuesInOptionsStruct<double>(storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<double>& options) const;
+            template void PointBasedSettings::setValuesInOptionsStruct<storm::RationalNumber>(storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<storm::RationalNumber>& options) const;
+
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
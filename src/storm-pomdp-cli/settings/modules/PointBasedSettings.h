@@ -0,0 +1,56 @@
+#pragma once
+
+#include "storm-config.h"
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+    namespace pomdp {
+        namespace modelchecker {
+            template<typename ValueType>
+            struct PointBasedPomdpModelCheckerOptions;
+        }
+    }
+    
+    namespace settings {
+        namespace modules {
+
+            /*!
+             * This class represents the settings for point-based value iteration on POMDPs.
+             */
+            class PointBasedSettings : public ModuleSettings {
+            public:
+
+                /*!
+                 * Creates a new set of point-based value iteration settings.
+                 */
+                PointBasedSettings();
+
+                virtual ~PointBasedSettings() = default;
+                
+                /// The goal gap between the bounds at the initial belief
+                double getPrecision() const;
+                bool isRelativePrecisionSet() const;
+                
+                bool isTrialLimitSet() const;
+                uint64_t getTrialLimit() const;
+                
+                bool isTimeLimitSet() const;
+                uint64_t getTimeLimit() const;
+                
+                uint64_t getMaxTrialDepth() const;
+                uint64_t getPruneInterval() const;
+                
+                /// Used to determine whether two beliefs are equal
+                bool isNumericPrecisionSetFromDefault() const;
+                double getNumericPrecision() const;
+    
+                template<typename ValueType>
+                void setValuesInOptionsStruct(storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<ValueType>& options) const;
+                
+                // The name of the module.
+                static const std::string moduleName;
+            };
+
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
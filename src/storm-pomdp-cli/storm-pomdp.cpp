@@ -5,6 +5,7 @@
 #include "storm-pomdp-cli/settings/modules/POMDPSettings.h"
 #include "storm-pomdp-cli/settings/modules/QualitativePOMDPAnalysisSettings.h"
 #include "storm-pomdp-cli/settings/modules/BeliefExplorationSettings.h"
+#include "storm-pomdp-cli/settings/modules/PointBasedSettings.h"
 #include "storm-pomdp-cli/settings/modules/ToParametricSettings.h"
 
 #include "storm-pomdp-cli/settings/PomdpSettings.h"
@@ -23,6 +24,7 @@
 #include "storm-pomdp/analysis/UniqueObservationStates.h"
 #include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
 #include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelChecker.h"
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelChecker.h"
 #include "storm-pomdp/analysis/FormulaInformation.h"
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
@@ -280,6 +282,22 @@ namespace storm {
                     STORM_PRINT_AND_LOG('\n');
                     analysisPerformed = true;
                 }
+                if (pomdpSettings.isPointBasedSet()) {
+                    STORM_PRINT_AND_LOG("Performing point-based value iteration... ");
+                    storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<ValueType> options;
+                    storm::settings::getModule<storm::settings::modules::PointBasedSettings>().setValuesInOptionsStruct(options);
+                    storm::pomdp::modelchecker::PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(pomdp, options);
+                    auto result = checker.check(formula);
+                    checker.printStatisticsToStream(std::cout);
+                    if (storm::utility::resources::isTerminate()) {
+                        STORM_PRINT_AND_LOG("\nResult till abort: ")
+                    } else {
+                        STORM_PRINT_AND_LOG("\nResult: ")
+                    }
+                    printResult(result.lowerBound, result.upperBound);
+                    STORM_PRINT_AND_LOG('\n');
+                    analysisPerformed = true;
+                }
                 if (pomdpSettings.isQualitativeAnalysisSet()) {
                     performQualitativeAnalysis(pomdp, formulaInfo, formula);
                     analysisPerformed = true;
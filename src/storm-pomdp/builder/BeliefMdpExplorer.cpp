@@ -3,6 +3,9 @@
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
 
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -10,6 +13,7 @@
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/SignalHandler.h"
 
@@ -28,7 +32,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType>
-        BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds) : beliefManager(beliefManager), pomdpValueBounds(pomdpValueBounds), status(Status::Uninitialized) {
+        BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds, bool incrementalValueComputation, uint64_t maximalNumberOfConsecutiveIncrementalChecks) : beliefManager(beliefManager), pomdpValueBounds(pomdpValueBounds), incrementalValueComputation(incrementalValueComputation), maximalNumberOfConsecutiveIncrementalChecks(maximalNumberOfConsecutiveIncrementalChecks), numberOfConsecutiveIncrementalChecks(0), status(Status::Uninitialized) {
             // Intentionally left empty
         }
 
@@ -58,6 +62,9 @@ namespace storm {
             delayedExplorationChoices.clear();
             optimalChoices = boost::none;
             optimalChoicesReachableMdpStates = boost::none;
+            previousCheckDirection = boost::none;
+            changedMdpStates = boost::none;
+            numberOfConsecutiveIncrementalChecks = 0;
             exploredMdp = nullptr;
             internalAddRowGroupIndex(); // Mark the start of the first row group
 
@@ -96,6 +103,11 @@ namespace storm {
         template<typename PomdpType, typename BeliefValueType>
         void BeliefMdpExplorer<PomdpType, BeliefValueType>::restartExploration() {
             STORM_LOG_ASSERT(status == Status::ModelChecked || status == Status::ModelFinished, "Method call is invalid in current status.");
+            if (status != Status::ModelChecked) {
+                // The current values are only estimates
+                previousCheckDirection = boost::none;
+            }
+            changedMdpStates = boost::none;
             status = Status::Exploring;
             // We will not erase old states during the exploration phase, so most state-based data (like mappings between MDP and Belief states) remain valid.
             exploredBeliefIds.clear();
@@ -151,6 +163,18 @@ namespace storm {
             return mdpStateToBeliefIdMap[currentMdpState];
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId>
+        BeliefMdpExplorer<PomdpType, BeliefValueType>::getNextBeliefsToExplore(uint64_t maxNumberOfBeliefs) const {
+            STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+            std::vector<BeliefId> result;
+            result.reserve(std::min<uint64_t>(maxNumberOfBeliefs, mdpStatesToExplore.size()));
+            for (auto stateIt = mdpStatesToExplore.begin(); stateIt != mdpStatesToExplore.end() && result.size() < maxNumberOfBeliefs; ++stateIt) {
+                result.push_back(mdpStateToBeliefIdMap[*stateIt]);
+            }
+            return result;
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         void BeliefMdpExplorer<PomdpType, BeliefValueType>::addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue,
                                                                                         ValueType const &bottomStateValue) {
@@ -340,6 +364,10 @@ namespace storm {
             // If this was a restarted exploration, we might still have unexplored states (which were only reachable and explored in a previous build).
             // We get rid of these before rebuilding the model
             if (exploredMdp) {
+                // The changes have to be detected while the state indices of the previous MDP are still valid.
+                if (previousCheckDirection) {
+                    changedMdpStates = computeChangedMdpStates();
+                }
                 dropUnexploredStates();
             }
 
@@ -499,7 +527,54 @@ namespace storm {
             storm::utility::vector::filterVectorInPlace(lowerValueBounds, relevantMdpStates);
             storm::utility::vector::filterVectorInPlace(upperValueBounds, relevantMdpStates);
             storm::utility::vector::filterVectorInPlace(values, relevantMdpStates);
+            if (changedMdpStates) {
+                changedMdpStates = changedMdpStates.get() % relevantMdpStates;
+            }
+        }
 
+        template<typename PomdpType, typename BeliefValueType>
+        storm::storage::BitVector BeliefMdpExplorer<PomdpType, BeliefValueType>::computeChangedMdpStates() const {
+            STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+            STORM_LOG_ASSERT(exploredMdp, "Method called although no 'old' MDP is available.");
+            auto const &oldTransitions = exploredMdp->getTransitionMatrix();
+            auto const &oldTargetStates = exploredMdp->getStates("target");
+            std::vector<ValueType> const *oldActionRewards = exploredMdp->hasRewardModel() ? &exploredMdp->getUniqueRewardModel().getStateActionRewardVector() : nullptr;
+
+            // States that were added during this exploration are always considered as changed
+            storm::storage::BitVector result(getCurrentNumberOfMdpStates(), true);
+            for (MdpStateType state = 0; state < oldTransitions.getRowGroupCount(); ++state) {
+                uint64_t oldRow = oldTransitions.getRowGroupIndices()[state];
+                uint64_t row = exploredChoiceIndices[state];
+                uint64_t rowEnd = exploredChoiceIndices[state + 1];
+                if (rowEnd - row != oldTransitions.getRowGroupSize(state) || targetStates.get(state) != oldTargetStates.get(state)) {
+                    continue;
+                }
+                bool stateChanged = false;
+                for (; row < rowEnd && !stateChanged; ++row, ++oldRow) {
+                    auto const &transitions = exploredMdpTransitions[row];
+                    auto oldTransitionRow = oldTransitions.getRow(oldRow);
+                    if (transitions.size() != oldTransitionRow.getNumberOfEntries()) {
+                        stateChanged = true;
+                        break;
+                    }
+                    // Both the map and the matrix row are sorted by column
+                    auto oldEntryIt = oldTransitionRow.begin();
+                    for (auto const &entry : transitions) {
+                        if (entry.first != oldEntryIt->getColumn() || entry.second != oldEntryIt->getValue()) {
+                            stateChanged = true;
+                            break;
+                        }
+                        ++oldEntryIt;
+                    }
+                    if (oldActionRewards && mdpActionRewards[row] != (*oldActionRewards)[oldRow]) {
+                        stateChanged = true;
+                    }
+                }
+                if (!stateChanged) {
+                    result.set(state, false);
+                }
+            }
+            return result;
         }
 
         template<typename PomdpType, typename BeliefValueType>
@@ -565,15 +640,36 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType>
-        void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(storm::solver::OptimizationDirection const &dir) {
+        void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(storm::Environment const& env, storm::solver::OptimizationDirection const &dir) {
             STORM_LOG_ASSERT(status == Status::ModelFinished, "Method call is invalid in current status.");
             STORM_LOG_ASSERT(exploredMdp, "Tried to compute values but the MDP is not explored");
+            // The kept values are only approximations (unless computed exactly) whose errors would accumulate over the refinement steps. Hence, the
+            // incremental computation is not used if sound or exact values are requested and all values are re-computed from time to time.
+            bool incremental = incrementalValueComputation && !env.solver().isForceSoundness() && !env.solver().isForceExact() &&
+                               numberOfConsecutiveIncrementalChecks < maximalNumberOfConsecutiveIncrementalChecks;
+            if (incremental && changedMdpStates && previousCheckDirection == dir) {
+                // Only the states that can reach a changed state might get a different value.
+                storm::storage::BitVector affectedStates = storm::utility::graph::performProbGreater0E(
+                        exploredMdp->getBackwardTransitions(), storm::storage::BitVector(exploredMdp->getNumberOfStates(), true), changedMdpStates.get());
+                if (!affectedStates.full()) {
+                    STORM_LOG_DEBUG("Re-computing the values of " << affectedStates.getNumberOfSetBits() << " of " << affectedStates.size() << " MDP states.");
+                    computeValuesOfMdpStates(env, dir, affectedStates);
+                    changedMdpStates = boost::none;
+                    ++numberOfConsecutiveIncrementalChecks;
+                    status = Status::ModelChecked;
+                    return;
+                }
+            }
+            changedMdpStates = boost::none;
+            numberOfConsecutiveIncrementalChecks = 0;
+
             auto property = createStandardProperty(dir, exploredMdp->hasRewardModel());
-            auto task = createStandardCheckTask(property);
+            auto task = createStandardCheckTask(property, values);
 
-            std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(exploredMdp, task));
+            std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, exploredMdp, task));
             if (res) {
                 values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
+                previousCheckDirection = dir;
                 STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(lowerValueBounds, values, std::less_equal<ValueType>()),
                                           "Computed values are smaller than the lower bound.");
                 STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(upperValueBounds, values, std::greater_equal<ValueType>()),
@@ -585,6 +681,95 @@ namespace storm {
             status = Status::ModelChecked;
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfMdpStates(storm::Environment const& env, storm::solver::OptimizationDirection const &dir,
+                                                                                      storm::storage::BitVector const &mdpStates) {
+            bool computeRewards = exploredMdp->hasRewardModel();
+            auto const &transitions = exploredMdp->getTransitionMatrix();
+            std::vector<ValueType> const *actionRewards = computeRewards ? &exploredMdp->getUniqueRewardModel().getStateActionRewardVector() : nullptr;
+            storm::storage::BitVector const &mdpTargetStates = exploredMdp->getStates("target");
+
+            // Build the sub-MDP. The transitions to other states are redirected to an additional target state (with the probability to reach the
+            // target from that state) and to an additional bottom state (with the remaining probability).
+            // For rewards, the value of the other state is collected on the transition and only states with infinite value lead to the bottom state.
+            std::vector<uint_fast64_t> toSubMdpStateMap = mdpStates.getNumberOfSetBitsBeforeIndices();
+            uint64_t numSubMdpStates = mdpStates.getNumberOfSetBits() + 2;
+            uint64_t subMdpTargetState = numSubMdpStates - 2;
+            uint64_t subMdpBottomState = numSubMdpStates - 1;
+            storm::storage::SparseMatrixBuilder<ValueType> builder(0, numSubMdpStates, 0, false, true, numSubMdpStates);
+            std::vector<ValueType> subMdpActionRewards;
+            std::vector<ValueType> subMdpValueHints;
+            storm::storage::BitVector subMdpTargetStates(numSubMdpStates, false);
+            uint64_t subMdpRow = 0;
+            for (auto const &state : mdpStates) {
+                if (mdpTargetStates.get(state)) {
+                    subMdpTargetStates.set(toSubMdpStateMap[state], true);
+                }
+                subMdpValueHints.push_back(values[state]);
+                builder.newRowGroup(subMdpRow);
+                for (uint64_t row = transitions.getRowGroupIndices()[state]; row < transitions.getRowGroupIndices()[state + 1]; ++row) {
+                    ValueType targetProbability = storm::utility::zero<ValueType>();
+                    ValueType bottomProbability = storm::utility::zero<ValueType>();
+                    ValueType reward = computeRewards ? (*actionRewards)[row] : storm::utility::zero<ValueType>();
+                    for (auto const &entry : transitions.getRow(row)) {
+                        if (mdpStates.get(entry.getColumn())) {
+                            builder.addNextValue(subMdpRow, toSubMdpStateMap[entry.getColumn()], entry.getValue());
+                        } else if (computeRewards) {
+                            if (storm::utility::isInfinity(values[entry.getColumn()])) {
+                                bottomProbability += entry.getValue();
+                            } else {
+                                targetProbability += entry.getValue();
+                                reward += entry.getValue() * values[entry.getColumn()];
+                            }
+                        } else {
+                            targetProbability += entry.getValue() * values[entry.getColumn()];
+                            bottomProbability += entry.getValue() * (storm::utility::one<ValueType>() - values[entry.getColumn()]);
+                        }
+                    }
+                    if (!storm::utility::isZero(targetProbability)) {
+                        builder.addNextValue(subMdpRow, subMdpTargetState, targetProbability);
+                    }
+                    if (bottomProbability > storm::utility::zero<ValueType>()) {
+                        builder.addNextValue(subMdpRow, subMdpBottomState, bottomProbability);
+                    }
+                    subMdpActionRewards.push_back(std::move(reward));
+                    ++subMdpRow;
+                }
+            }
+            for (auto const &sinkState : {subMdpTargetState, subMdpBottomState}) {
+                builder.newRowGroup(subMdpRow);
+                builder.addNextValue(subMdpRow, sinkState, storm::utility::one<ValueType>());
+                subMdpActionRewards.push_back(storm::utility::zero<ValueType>());
+                ++subMdpRow;
+            }
+            subMdpTargetStates.set(subMdpTargetState, true);
+            subMdpValueHints.push_back(computeRewards ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>());
+            subMdpValueHints.push_back(computeRewards ? storm::utility::infinity<ValueType>() : storm::utility::zero<ValueType>());
+
+            storm::models::sparse::StateLabeling subMdpLabeling(numSubMdpStates);
+            subMdpLabeling.addLabel("init");
+            subMdpLabeling.addLabelToState("init", 0);
+            subMdpLabeling.addLabel("target", std::move(subMdpTargetStates));
+            std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> subMdpRewardModels;
+            if (computeRewards) {
+                subMdpRewardModels.emplace("default",
+                                           storm::models::sparse::StandardRewardModel<ValueType>(boost::optional<std::vector<ValueType>>(), std::move(subMdpActionRewards)));
+            }
+            auto subMdp = std::make_shared<storm::models::sparse::Mdp<ValueType>>(builder.build(), std::move(subMdpLabeling), std::move(subMdpRewardModels));
+
+            auto property = createStandardProperty(dir, computeRewards);
+            auto task = createStandardCheckTask(property, std::move(subMdpValueHints));
+            std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, subMdp, task));
+            if (res) {
+                auto const &subMdpValues = res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector();
+                storm::utility::vector::setVectorValues(values, mdpStates, subMdpValues);
+                previousCheckDirection = dir;
+            } else {
+                STORM_LOG_ASSERT(storm::utility::resources::isTerminate(), "Empty check result!");
+                STORM_LOG_ERROR("No result obtained while checking.");
+            }
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         bool BeliefMdpExplorer<PomdpType, BeliefValueType>::hasComputedValues() const {
             return status == Status::ModelChecked;
@@ -720,12 +905,13 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType>
         storm::modelchecker::CheckTask<storm::logic::Formula, typename BeliefMdpExplorer<PomdpType, BeliefValueType>::ValueType>
-        BeliefMdpExplorer<PomdpType, BeliefValueType>::createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property) {
+        BeliefMdpExplorer<PomdpType, BeliefValueType>::createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property,
+                                                                              std::vector<ValueType> valueHints) {
             //Note: The property should not run out of scope after calling this because the task only stores the property by reference.
             // Therefore, this method needs the property by reference (and not const reference)
             auto task = storm::api::createTask<ValueType>(property, false);
             auto hint = storm::modelchecker::ExplicitModelCheckerHint<ValueType>();
-            hint.setResultHint(values);
+            hint.setResultHint(std::move(valueHints));
             auto hintPtr = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>(hint);
             task.setHint(hintPtr);
             return task;
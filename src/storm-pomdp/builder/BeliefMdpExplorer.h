@@ -12,6 +12,7 @@
 #include "storm-pomdp/modelchecker/TrivialPomdpValueBoundsModelChecker.h"
 
 namespace storm {
+    class Environment;
     
     namespace builder {
         template<typename PomdpType, typename BeliefValueType = typename PomdpType::ValueType>
@@ -38,7 +39,14 @@ namespace storm {
                 ModelChecked
             };
 
-            BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager, storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds);
+            /*!
+             * @param incrementalValueComputation If set, only the values of states that can reach a changed part of the MDP are re-computed after a
+             * restarted exploration. This is never done if the values are to be computed soundly or exactly.
+             * @param maximalNumberOfConsecutiveIncrementalChecks The number of consecutive incremental value computations after which the values of
+             * all states are re-computed (to avoid accumulating errors).
+             */
+            BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager, storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds,
+                              bool incrementalValueComputation = true, uint64_t maximalNumberOfConsecutiveIncrementalChecks = 4);
 
             BeliefMdpExplorer(BeliefMdpExplorer &&other) = default;
 
@@ -58,6 +66,12 @@ namespace storm {
 
             BeliefId exploreNextState();
 
+            /*!
+             * Retrieves the beliefs of the states that are explored next (in the order of exploration).
+             * @param maxNumberOfBeliefs The maximal number of beliefs to retrieve.
+             */
+            std::vector<BeliefId> getNextBeliefsToExplore(uint64_t maxNumberOfBeliefs) const;
+
             void addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue = storm::utility::zero<ValueType>(),
                                              ValueType const &bottomStateValue = storm::utility::zero<ValueType>());
 
@@ -139,7 +153,12 @@ namespace storm {
 
             ValueType computeUpperValueBoundAtBelief(BeliefId const &beliefId) const;
 
-            void computeValuesOfExploredMdp(storm::solver::OptimizationDirection const &dir);
+            /*!
+             * Computes the values of the explored MDP.
+             * If the exploration was restarted after the values of the previous MDP were computed, only the states that can reach a state whose
+             * behavior changed are re-computed. The values of all other states are taken from the previous computation.
+             */
+            void computeValuesOfExploredMdp(storm::Environment const& env, storm::solver::OptimizationDirection const &dir);
 
             bool hasComputedValues() const;
 
@@ -173,7 +192,8 @@ namespace storm {
 
             std::shared_ptr<storm::logic::Formula const> createStandardProperty(storm::solver::OptimizationDirection const &dir, bool computeRewards);
 
-            storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property);
+            storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property,
+                                                                                                     std::vector<ValueType> valueHints);
 
             MdpStateType getCurrentMdpState() const;
 
@@ -187,6 +207,18 @@ namespace storm {
 
             void insertValueHints(ValueType const &lowerBound, ValueType const &upperBound);
 
+            /*!
+             * Computes the states of the currently explored MDP whose transitions, rewards, or target status differ from the previously explored MDP.
+             * Has to be called before unexplored states are dropped.
+             */
+            storm::storage::BitVector computeChangedMdpStates() const;
+
+            /*!
+             * Computes the values of the given states of the explored MDP, assuming that the values of all other states are already known.
+             * To this end, a sub-MDP is solved in which the transitions to the other states are redirected to a target and a bottom state.
+             */
+            void computeValuesOfMdpStates(storm::Environment const& env, storm::solver::OptimizationDirection const &dir, storm::storage::BitVector const &mdpStates);
+
             MdpStateType getOrAddMdpState(BeliefId const &beliefId);
             
             // Belief state related information
@@ -220,6 +252,13 @@ namespace storm {
             std::vector<ValueType> values; // Contains an estimate during building and the actual result after a check has performed
             boost::optional<storm::storage::BitVector> optimalChoices;
             boost::optional<storm::storage::BitVector> optimalChoicesReachableMdpStates;
+
+            // Information for the incremental value computation after a restarted exploration
+            bool incrementalValueComputation;
+            uint64_t maximalNumberOfConsecutiveIncrementalChecks;
+            boost::optional<storm::solver::OptimizationDirection> previousCheckDirection;
+            boost::optional<storm::storage::BitVector> changedMdpStates;
+            uint64_t numberOfConsecutiveIncrementalChecks;
             
             // The current status of this explorer
             Status status;
@@ -39,6 +39,9 @@ namespace storm {
                 
                 ValueType numericPrecision = storm::NumberTraits<ValueType>::IsExact ? storm::utility::zero<ValueType>() : storm::utility::convertNumber<ValueType>(1e-9); /// Used to decide whether two beliefs are equal
                 bool dynamicTriangulation = true; // Sets whether the triangulation is done in a dynamic way (yielding more precise triangulations)
+                bool parallelExpansion = false; // Sets whether the successors of the beliefs in the exploration queue are computed in parallel (in batches)
+                bool incrementalValueComputation = true; // Sets whether a refinement step only re-computes the values of states that can reach a changed part of the MDP
+                uint64_t maximalNumberOfConsecutiveIncrementalChecks = 4; // The number of consecutive incremental value computations after which the values of all states are re-computed
             };
         }
     }
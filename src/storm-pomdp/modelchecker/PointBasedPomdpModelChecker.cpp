@@ -0,0 +1,512 @@
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelChecker.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include "storm-pomdp/analysis/FormulaInformation.h"
+#include "storm-pomdp/modelchecker/TrivialPomdpValueBoundsModelChecker.h"
+#include "storm-pomdp/transformer/MakeStateSetObservationClosed.h"
+
+#include "storm/logic/Formulas.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/vector.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace pomdp {
+        namespace modelchecker {
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::Statistics::Statistics() : trials(0), backups(0), prunedAlphaVectors(0), aborted(false) {
+                // Intentionally left empty
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::PointBasedPomdpModelChecker(std::shared_ptr<PomdpModelType> pomdp, Options options) : inputPomdp(pomdp), options(options) {
+                STORM_LOG_ASSERT(inputPomdp, "The given POMDP is not initialized.");
+                STORM_LOG_ERROR_COND(inputPomdp->isCanonic(), "Input Pomdp is not known to be canonic. This might lead to unexpected verification results.");
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            typename PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::Result PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::check(storm::logic::Formula const& formula) {
+                // Potentially reset preprocessed model from previous call
+                preprocessedPomdp.reset();
+
+                // Reset all collected statistics
+                statistics = Statistics();
+                statistics.totalTime.start();
+                statistics.initializationTime.start();
+                // Extract the relevant information from the formula
+                auto formulaInfo = storm::pomdp::analysis::getFormulaInformation(pomdp(), formula);
+
+                // Compute some initial bounds on the values for each state of the pomdp
+                auto initialPomdpValueBounds = TrivialPomdpValueBoundsModelChecker<storm::models::sparse::Pomdp<ValueType>>(pomdp()).getValueBounds(formula, formulaInfo);
+                uint64_t initialPomdpState = pomdp().getInitialStates().getNextSetIndex(0);
+                Result result(initialPomdpValueBounds.getHighestLowerBound(initialPomdpState), initialPomdpValueBounds.getSmallestUpperBound(initialPomdpState));
+                STORM_LOG_INFO("Initial value bounds are [" << result.lowerBound << ", " <<  result.upperBound << "]");
+
+                boost::optional<std::string> rewardModelName;
+                std::set<uint32_t> targetObservations;
+                if (formulaInfo.isNonNestedReachabilityProbability() || formulaInfo.isNonNestedExpectedRewardFormula()) {
+                    if (formulaInfo.getTargetStates().observationClosed) {
+                        targetObservations = formulaInfo.getTargetStates().observations;
+                    } else {
+                        storm::transformer::MakeStateSetObservationClosed<ValueType> obsCloser(inputPomdp);
+                        std::tie(preprocessedPomdp, targetObservations) = obsCloser.transform(formulaInfo.getTargetStates().states);
+                    }
+                    if (formulaInfo.isNonNestedReachabilityProbability()) {
+                        if (!formulaInfo.getSinkStates().empty()) {
+                            auto reachableFromSinkStates = storm::utility::graph::getReachableStates(pomdp().getTransitionMatrix(), formulaInfo.getSinkStates().states, formulaInfo.getSinkStates().states, ~formulaInfo.getSinkStates().states);
+                            reachableFromSinkStates &= ~formulaInfo.getSinkStates().states;
+                            STORM_LOG_THROW(reachableFromSinkStates.empty(), storm::exceptions::NotSupportedException, "There are sink states that can reach non-sink states. This is currently not supported");
+                        }
+                    } else {
+                        // Expected reward formula!
+                        rewardModelName = formulaInfo.getRewardModelName();
+                    }
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unsupported formula '" << formula << "'.");
+                }
+
+                initialize(targetObservations, formulaInfo.minimize(), rewardModelName, initialPomdpValueBounds);
+                statistics.initializationTime.stop();
+
+                BeliefId initialBelief = beliefManager->getInitialBelief();
+                // Trials only descend to successors whose weighted gap exceeds this threshold.
+                ValueType gapThreshold = options.precision;
+                boost::optional<std::pair<ValueType, ValueType>> previousInitialValues;
+                storm::utility::Stopwatch trialTime(true);
+                while (!storm::utility::resources::isTerminate()) {
+                    ValueType innerValue = getInnerValue(initialBelief);
+                    ValueType outerValue = getOuterValue(initialBelief);
+                    if (minimize) {
+                        result.updateUpperBound(innerValue);
+                        result.updateLowerBound(outerValue);
+                    } else {
+                        result.updateLowerBound(innerValue);
+                        result.updateUpperBound(outerValue);
+                    }
+                    if (result.diff(options.relativePrecision) <= options.precision) {
+                        break;
+                    }
+                    if (options.trialLimit && statistics.trials >= options.trialLimit.get()) {
+                        STORM_LOG_INFO("Trial limit reached.");
+                        break;
+                    }
+                    if (options.timeLimit && static_cast<uint64_t>(trialTime.getTimeInSeconds()) > options.timeLimit.get()) {
+                        STORM_LOG_INFO("Time limit exceeded.");
+                        break;
+                    }
+
+                    // The gap at the initial belief can exceed the precision although the weighted gap of every successor is below it.
+                    // If the previous trial did not change the bounds at the initial belief, we therefore descend to any successor with a positive gap.
+                    bool stagnated = previousInitialValues && previousInitialValues->first == innerValue && previousInitialValues->second == outerValue;
+                    gapThreshold = stagnated ? storm::utility::zero<ValueType>() : options.precision;
+                    previousInitialValues = std::make_pair(innerValue, outerValue);
+
+                    bool improved = performTrial(gapThreshold);
+                    ++statistics.trials;
+                    if (!improved && stagnated) {
+                        // The trial did not change any bound, so all further trials would follow the same path without any effect.
+                        STORM_LOG_WARN("Trials do not improve the bounds any longer. Consider increasing the maximal trial depth.");
+                        break;
+                    }
+                    if (options.pruneInterval > 0 && statistics.trials % options.pruneInterval == 0) {
+                        pruneAlphaVectors();
+                    }
+                    STORM_LOG_INFO_COND(statistics.trials % 100 == 0, "Value bounds after " << statistics.trials << " trials are [" << result.lowerBound << ", " << result.upperBound << "]");
+                }
+
+                if (storm::utility::resources::isTerminate()) {
+                    statistics.aborted = true;
+                }
+                statistics.totalTime.stop();
+                return result;
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            void PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::printStatisticsToStream(std::ostream& stream) const {
+                stream << "##### Point-Based Value Iteration Statistics ######\n";
+                stream << "# Input model: \n";
+                pomdp().printModelInformationToStream(stream);
+                if (statistics.aborted) {
+                    stream << "# Computation aborted early\n";
+                }
+                stream << "# Total check time: " << statistics.totalTime << '\n';
+                stream << "# Time spend for the initialization: " << statistics.initializationTime << '\n';
+                stream << "# Number of trials: " << statistics.trials << '\n';
+                stream << "# Number of backups: " << statistics.backups << '\n';
+                if (beliefManager) {
+                    uint64_t numberOfAlphaVectors = 0;
+                    for (auto const& observationAlphaVectors : alphaVectors) {
+                        numberOfAlphaVectors += observationAlphaVectors.size();
+                    }
+                    stream << "# Number of alpha-vectors: " << numberOfAlphaVectors << " (" << statistics.prunedAlphaVectors << " pruned)\n";
+                    stream << "# Number of belief points of the " << (minimize ? "lower" : "upper") << " bound: " << beliefPointIndices.size() << '\n';
+                    stream << "# Number of discovered beliefs: " << beliefManager->getNumberOfBeliefIds() << '\n';
+                }
+                stream << "##########################################\n";
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            void PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::initialize(std::set<uint32_t> const& targetObservationSet, bool min, boost::optional<std::string> const& rewardModelName,
+                                                                                         TrivialPomdpValueBounds<ValueType> const& pomdpValueBounds) {
+                minimize = min;
+                computeRewards = rewardModelName.is_initialized();
+                beliefManager = std::make_shared<BeliefManagerType>(pomdp(), storm::utility::convertNumber<BeliefValueType>(options.numericPrecision), BeliefManagerType::TriangulationMode::Static);
+                if (computeRewards) {
+                    beliefManager->setRewardModel(rewardModelName);
+                    actionRewards = pomdp().getRewardModel(rewardModelName.get()).getTotalRewardVector(pomdp().getTransitionMatrix());
+                } else {
+                    actionRewards.clear();
+                }
+                targetValue = computeRewards ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
+                targetObservations = storm::storage::BitVector(pomdp().getNrObservations(), false);
+                for (auto const& observation : targetObservationSet) {
+                    targetObservations.set(observation, true);
+                }
+
+                // Alpha-vectors only have entries for the states with the corresponding observation
+                observationStates.assign(pomdp().getNrObservations(), std::vector<uint64_t>());
+                localStateIndices.resize(pomdp().getNumberOfStates());
+                for (uint64_t state = 0; state < pomdp().getNumberOfStates(); ++state) {
+                    auto& states = observationStates[pomdp().getObservation(state)];
+                    localStateIndices[state] = states.size();
+                    states.push_back(state);
+                }
+
+                // The values of the fully observable MDP (i.e. the outer bounds) are the corner values of the outer bound
+                auto const& outerBounds = minimize ? pomdpValueBounds.lower : pomdpValueBounds.upper;
+                STORM_LOG_ASSERT(!outerBounds.empty(), "No outer bounds available.");
+                cornerValues = outerBounds.front();
+                for (auto boundIt = outerBounds.begin() + 1; boundIt != outerBounds.end(); ++boundIt) {
+                    for (uint64_t state = 0; state < cornerValues.size(); ++state) {
+                        if (isBetter((*boundIt)[state], cornerValues[state])) {
+                            continue;
+                        }
+                        cornerValues[state] = (*boundIt)[state];
+                    }
+                }
+
+                // The values of the guessed schedulers (i.e. the inner bounds) yield the initial alpha-vectors
+                auto const& innerBounds = minimize ? pomdpValueBounds.upper : pomdpValueBounds.lower;
+                alphaVectors.assign(pomdp().getNrObservations(), std::vector<std::vector<ValueType>>());
+                for (uint32_t observation = 0; observation < pomdp().getNrObservations(); ++observation) {
+                    if (targetObservations.get(observation)) {
+                        alphaVectors[observation].emplace_back(observationStates[observation].size(), targetValue);
+                        continue;
+                    }
+                    for (auto const& bound : innerBounds) {
+                        std::vector<ValueType> alphaVector;
+                        alphaVector.reserve(observationStates[observation].size());
+                        for (auto const& state : observationStates[observation]) {
+                            alphaVector.push_back(bound[state]);
+                        }
+                        addAlphaVector(observation, std::move(alphaVector));
+                    }
+                }
+
+                beliefPoints.assign(pomdp().getNrObservations(), std::vector<BeliefPoint>());
+                beliefPointIndices.clear();
+                visitedBeliefs.assign(pomdp().getNrObservations(), std::vector<BeliefId>());
+                visitedBeliefIds.clear();
+                chosenAlphaVectors.assign(pomdp().getNrObservations(), 0);
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            bool PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::performTrial(ValueType const& gapThreshold) {
+                std::vector<BeliefId> path;
+                BeliefId currentBelief = beliefManager->getInitialBelief();
+                while (path.size() < options.maxTrialDepth && !isTarget(currentBelief)) {
+                    path.push_back(currentBelief);
+                    if (currentBelief >= visitedBeliefIds.size()) {
+                        visitedBeliefIds.resize(currentBelief + 1, false);
+                    }
+                    if (!visitedBeliefIds.get(currentBelief)) {
+                        visitedBeliefIds.set(currentBelief, true);
+                        visitedBeliefs[beliefManager->getBeliefObservation(currentBelief)].push_back(currentBelief);
+                    }
+
+                    // Follow the successor that contributes most to the gap under the optimistic action
+                    uint64_t action = getOuterOptimalAction(currentBelief);
+                    BeliefId nextBelief = beliefManager->noId();
+                    ValueType maxWeightedGap = storm::utility::zero<ValueType>();
+                    for (auto const& successor : beliefManager->expand(currentBelief, action)) {
+                        ValueType weightedGap = successor.second * getGap(successor.first);
+                        if (weightedGap > maxWeightedGap) {
+                            maxWeightedGap = weightedGap;
+                            nextBelief = successor.first;
+                        }
+                    }
+                    if (nextBelief == beliefManager->noId() || maxWeightedGap <= gapThreshold) {
+                        break;
+                    }
+                    currentBelief = nextBelief;
+                }
+
+                // Update the bounds in reverse order so that the improvements are propagated towards the initial belief
+                bool improved = false;
+                for (auto beliefIt = path.rbegin(); beliefIt != path.rend(); ++beliefIt) {
+                    improved |= update(*beliefIt);
+                }
+                return improved;
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            bool PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::update(BeliefId const& beliefId) {
+                ++statistics.backups;
+                uint32_t observation = beliefManager->getBeliefObservation(beliefId);
+                uint64_t numberOfActions = beliefManager->getBeliefNumberOfChoices(beliefId);
+
+                // Find the best action for both bounds. For the inner bound, we also memorize the optimal alpha-vector of each successor.
+                uint64_t bestInnerAction = 0;
+                ValueType bestInnerValue = storm::utility::zero<ValueType>();
+                ValueType bestOuterValue = storm::utility::zero<ValueType>();
+                std::vector<std::pair<uint32_t, uint64_t>> bestSuccessorAlphaVectors, successorAlphaVectors;
+                for (uint64_t action = 0; action < numberOfActions; ++action) {
+                    ValueType reward = computeRewards ? beliefManager->getBeliefActionReward(beliefId, action) : storm::utility::zero<ValueType>();
+                    ValueType innerValue = reward;
+                    ValueType outerValue = reward;
+                    successorAlphaVectors.clear();
+                    for (auto const& successor : beliefManager->expand(beliefId, action)) {
+                        ValueType successorInnerValue;
+                        uint64_t alphaVectorIndex = getOptimalAlphaVectorIndex(successor.first, successorInnerValue);
+                        successorAlphaVectors.emplace_back(beliefManager->getBeliefObservation(successor.first), alphaVectorIndex);
+                        innerValue += successor.second * successorInnerValue;
+                        outerValue += successor.second * getOuterValue(successor.first);
+                    }
+                    if (action == 0 || isBetter(innerValue, bestInnerValue)) {
+                        bestInnerAction = action;
+                        bestInnerValue = innerValue;
+                        bestSuccessorAlphaVectors.swap(successorAlphaVectors);
+                    }
+                    if (action == 0 || isBetter(outerValue, bestOuterValue)) {
+                        bestOuterValue = outerValue;
+                    }
+                }
+
+                // The new alpha-vector corresponds to the scheduler that first takes the best action and then continues according to the optimal
+                // alpha-vector of the successor observation. It is computed for all states with the current observation in a single pass over the matrix.
+                bool improved = false;
+                if (isBetter(bestInnerValue, getInnerValue(beliefId))) {
+                    improved = true;
+                    for (auto const& successorAlphaVector : bestSuccessorAlphaVectors) {
+                        chosenAlphaVectors[successorAlphaVector.first] = successorAlphaVector.second;
+                    }
+                    auto const& transitionMatrix = pomdp().getTransitionMatrix();
+                    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+                    std::vector<ValueType> alphaVector;
+                    alphaVector.reserve(observationStates[observation].size());
+                    for (auto const& state : observationStates[observation]) {
+                        uint64_t row = rowGroupIndices[state] + bestInnerAction;
+                        ValueType value = computeRewards ? actionRewards[row] : storm::utility::zero<ValueType>();
+                        for (auto const& entry : transitionMatrix.getRow(row)) {
+                            if (!storm::utility::isZero(entry.getValue())) {
+                                uint32_t successorObservation = pomdp().getObservation(entry.getColumn());
+                                value += entry.getValue() * alphaVectors[successorObservation][chosenAlphaVectors[successorObservation]][localStateIndices[entry.getColumn()]];
+                            }
+                        }
+                        alphaVector.push_back(std::move(value));
+                    }
+                    // Successor observations that do not occur at this belief use the first alpha-vector, which is equally valid.
+                    for (auto const& successorAlphaVector : bestSuccessorAlphaVectors) {
+                        chosenAlphaVectors[successorAlphaVector.first] = 0;
+                    }
+                    addAlphaVector(observation, std::move(alphaVector));
+                }
+
+                // For the outer bound, the backed up value is stored at a belief point
+                if (isBetter(getOuterValue(beliefId), bestOuterValue)) {
+                    improved = true;
+                    auto pointIndexIt = beliefPointIndices.find(beliefId);
+                    if (pointIndexIt == beliefPointIndices.end()) {
+                        ValueType cornerValue = storm::utility::zero<ValueType>();
+                        for (auto const& entry : beliefManager->getBeliefEntries(beliefId)) {
+                            cornerValue += storm::utility::convertNumber<ValueType>(entry.second) * cornerValues[entry.first];
+                        }
+                        beliefPointIndices.emplace(beliefId, beliefPoints[observation].size());
+                        beliefPoints[observation].push_back({beliefId, bestOuterValue, cornerValue});
+                    } else {
+                        beliefPoints[observation][pointIndexIt->second].value = bestOuterValue;
+                    }
+                }
+                return improved;
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            uint64_t PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::getOuterOptimalAction(BeliefId const& beliefId) {
+                uint64_t bestAction = 0;
+                ValueType bestValue = storm::utility::zero<ValueType>();
+                for (uint64_t action = 0, numberOfActions = beliefManager->getBeliefNumberOfChoices(beliefId); action < numberOfActions; ++action) {
+                    ValueType value = computeRewards ? beliefManager->getBeliefActionReward(beliefId, action) : storm::utility::zero<ValueType>();
+                    for (auto const& successor : beliefManager->expand(beliefId, action)) {
+                        value += successor.second * getOuterValue(successor.first);
+                    }
+                    if (action == 0 || isBetter(value, bestValue)) {
+                        bestAction = action;
+                        bestValue = value;
+                    }
+                }
+                return bestAction;
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            void PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::pruneAlphaVectors() {
+                for (uint32_t observation = 0; observation < alphaVectors.size(); ++observation) {
+                    auto& observationAlphaVectors = alphaVectors[observation];
+                    if (observationAlphaVectors.size() <= 1 || visitedBeliefs[observation].empty()) {
+                        continue;
+                    }
+                    storm::storage::BitVector optimalAlphaVectors(observationAlphaVectors.size(), false);
+                    for (auto const& beliefId : visitedBeliefs[observation]) {
+                        ValueType value;
+                        optimalAlphaVectors.set(getOptimalAlphaVectorIndex(beliefId, value), true);
+                    }
+                    statistics.prunedAlphaVectors += observationAlphaVectors.size() - optimalAlphaVectors.getNumberOfSetBits();
+                    storm::utility::vector::filterVectorInPlace(observationAlphaVectors, optimalAlphaVectors);
+                }
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            void PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::addAlphaVector(uint32_t observation, std::vector<ValueType>&& alphaVector) {
+                auto dominates = [this](std::vector<ValueType> const& first, std::vector<ValueType> const& second) {
+                    for (uint64_t i = 0; i < first.size(); ++i) {
+                        if (isBetter(second[i], first[i])) {
+                            return false;
+                        }
+                    }
+                    return true;
+                };
+                auto& observationAlphaVectors = alphaVectors[observation];
+                for (auto const& existingAlphaVector : observationAlphaVectors) {
+                    if (dominates(existingAlphaVector, alphaVector)) {
+                        return;
+                    }
+                }
+                auto newEnd = std::remove_if(observationAlphaVectors.begin(), observationAlphaVectors.end(), [&](std::vector<ValueType> const& existingAlphaVector) { return dominates(alphaVector, existingAlphaVector); });
+                statistics.prunedAlphaVectors += std::distance(newEnd, observationAlphaVectors.end());
+                observationAlphaVectors.erase(newEnd, observationAlphaVectors.end());
+                observationAlphaVectors.push_back(std::move(alphaVector));
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            typename PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::ValueType PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::computeDotProduct(BeliefId const& beliefId, std::vector<ValueType> const& alphaVector) {
+                ValueType result = storm::utility::zero<ValueType>();
+                for (auto const& entry : beliefManager->getBeliefEntries(beliefId)) {
+                    result += storm::utility::convertNumber<ValueType>(entry.second) * alphaVector[localStateIndices[entry.first]];
+                }
+                return result;
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            uint64_t PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::getOptimalAlphaVectorIndex(BeliefId const& beliefId, ValueType& value) {
+                auto const& observationAlphaVectors = alphaVectors[beliefManager->getBeliefObservation(beliefId)];
+                STORM_LOG_ASSERT(!observationAlphaVectors.empty(), "No alpha-vector available.");
+                uint64_t result = 0;
+                value = computeDotProduct(beliefId, observationAlphaVectors.front());
+                for (uint64_t index = 1; index < observationAlphaVectors.size(); ++index) {
+                    ValueType alphaVectorValue = computeDotProduct(beliefId, observationAlphaVectors[index]);
+                    if (isBetter(alphaVectorValue, value)) {
+                        result = index;
+                        value = std::move(alphaVectorValue);
+                    }
+                }
+                return result;
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            typename PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::ValueType PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::getInnerValue(BeliefId const& beliefId) {
+                ValueType result;
+                getOptimalAlphaVectorIndex(beliefId, result);
+                return result;
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            typename PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::ValueType PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::getOuterValue(BeliefId const& beliefId) {
+                if (isTarget(beliefId)) {
+                    return targetValue;
+                }
+                auto belief = beliefManager->getBeliefEntries(beliefId);
+                ValueType cornerValue = storm::utility::zero<ValueType>();
+                for (auto const& entry : belief) {
+                    cornerValue += storm::utility::convertNumber<ValueType>(entry.second) * cornerValues[entry.first];
+                }
+                if (storm::utility::isInfinity(cornerValue)) {
+                    return cornerValue;
+                }
+
+                // Sawtooth interpolation: The belief is written as a convex combination of a belief point and the corners of the simplex,
+                // where the weight of the belief point is the largest possible one.
+                ValueType result = cornerValue;
+                for (auto const& point : beliefPoints[beliefManager->getBeliefObservation(beliefId)]) {
+                    if (storm::utility::isInfinity(point.cornerValue)) {
+                        continue;
+                    }
+                    // Both beliefs are sorted by state, so the support of the point is matched against the belief in a single merge pass.
+                    BeliefValueType weight = storm::utility::one<BeliefValueType>();
+                    auto pointBelief = beliefManager->getBeliefEntries(point.beliefId);
+                    uint64_t beliefPosition = 0;
+                    for (auto const& pointEntry : pointBelief) {
+                        while (beliefPosition < belief.size() && belief[beliefPosition].first < pointEntry.first) {
+                            ++beliefPosition;
+                        }
+                        if (beliefPosition == belief.size() || belief[beliefPosition].first != pointEntry.first) {
+                            weight = storm::utility::zero<BeliefValueType>();
+                            break;
+                        }
+                        weight = std::min<BeliefValueType>(weight, belief[beliefPosition].second / pointEntry.second);
+                    }
+                    if (storm::utility::isZero(weight)) {
+                        continue;
+                    }
+                    ValueType interpolatedValue = cornerValue + storm::utility::convertNumber<ValueType>(weight) * (point.value - point.cornerValue);
+                    if (isBetter(result, interpolatedValue)) {
+                        result = std::move(interpolatedValue);
+                    }
+                }
+                return result;
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            typename PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::ValueType PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::getGap(BeliefId const& beliefId) {
+                if (isTarget(beliefId)) {
+                    return storm::utility::zero<ValueType>();
+                }
+                ValueType innerValue = getInnerValue(beliefId);
+                ValueType outerValue = getOuterValue(beliefId);
+                if (storm::utility::isInfinity(innerValue) && storm::utility::isInfinity(outerValue)) {
+                    return storm::utility::zero<ValueType>();
+                }
+                ValueType gap = minimize ? innerValue - outerValue : outerValue - innerValue;
+                return gap > storm::utility::zero<ValueType>() ? gap : storm::utility::zero<ValueType>();
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            bool PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::isTarget(BeliefId const& beliefId) {
+                return targetObservations.get(beliefManager->getBeliefObservation(beliefId));
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            bool PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::isBetter(ValueType const& first, ValueType const& second) const {
+                return minimize ? first < second : first > second;
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            PomdpModelType const& PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::pomdp() const {
+                if (preprocessedPomdp) {
+                    return *preprocessedPomdp;
+                } else {
+                    return *inputPomdp;
+                }
+            }
+
+            template class PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<double>>;
+            template class PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<storm::RationalNumber>>;
+
+        }
+    }
+}
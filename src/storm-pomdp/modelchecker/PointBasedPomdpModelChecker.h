@@ -0,0 +1,149 @@
+#pragma once
+
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm-pomdp/storage/BeliefManager.h"
+#include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelChecker.h"
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelCheckerOptions.h"
+
+namespace storm {
+    namespace logic {
+        class Formula;
+    }
+
+    namespace pomdp {
+        namespace modelchecker {
+
+            /*!
+             * Computes bounds on reachability probabilities and expected rewards of POMDPs with point-based value iteration.
+             *
+             * The bound that is approached from the inside (the lower bound when maximizing and the upper bound when minimizing) is represented
+             * by sets of alpha-vectors, one set for each observation. Every alpha-vector is the value vector of an observation-based scheduler,
+             * so the best alpha-vector at a belief yields an achievable value. The other bound is represented by the values of the fully observable
+             * MDP at the corners of the belief simplex together with a set of belief points that are interpolated with the sawtooth approximation.
+             *
+             * Both bounds are improved by Bellman backups at beliefs that are visited by heuristic trials starting at the initial belief, where each
+             * trial follows the action that is optimal w.r.t. the outer bound and the successor with the largest weighted gap between the bounds.
+             */
+            template<typename PomdpModelType, typename BeliefValueType = typename PomdpModelType::ValueType>
+            class PointBasedPomdpModelChecker {
+            public:
+                typedef typename PomdpModelType::ValueType ValueType;
+                typedef storm::storage::BeliefManager<PomdpModelType, BeliefValueType> BeliefManagerType;
+                typedef typename BeliefManagerType::BeliefId BeliefId;
+                typedef typename BeliefManagerType::BeliefType BeliefType;
+                typedef PointBasedPomdpModelCheckerOptions<ValueType> Options;
+                typedef typename BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::Result Result;
+
+                PointBasedPomdpModelChecker(std::shared_ptr<PomdpModelType> pomdp, Options options = Options());
+
+                Result check(storm::logic::Formula const& formula);
+
+                void printStatisticsToStream(std::ostream& stream) const;
+
+            private:
+                /**
+                 * Returns the pomdp that is to be analyzed
+                 */
+                PomdpModelType const& pomdp() const;
+
+                /**
+                 * Sets up the alpha-vectors and the corner values from the given trivial bounds.
+                 */
+                void initialize(std::set<uint32_t> const& targetObservations, bool min, boost::optional<std::string> const& rewardModelName,
+                                TrivialPomdpValueBounds<ValueType> const& pomdpValueBounds);
+
+                /**
+                 * Performs a single trial starting at the initial belief. The trial only descends to successors whose weighted gap exceeds the given threshold.
+                 * @return true iff one of the bounds was improved at a belief on the trial.
+                 */
+                bool performTrial(ValueType const& gapThreshold);
+
+                /**
+                 * Performs a Bellman backup of both bounds at the given belief.
+                 * @return true iff one of the bounds was improved at the belief.
+                 */
+                bool update(BeliefId const& beliefId);
+
+                /**
+                 * Returns the action that is optimal w.r.t. the outer bound.
+                 */
+                uint64_t getOuterOptimalAction(BeliefId const& beliefId);
+
+                /**
+                 * Removes the alpha-vectors that are not optimal at any of the visited beliefs.
+                 */
+                void pruneAlphaVectors();
+
+                /**
+                 * Adds the given alpha-vector to the set of the given observation unless it is dominated by an existing one.
+                 * Existing alpha-vectors that are dominated by the new one are removed.
+                 */
+                void addAlphaVector(uint32_t observation, std::vector<ValueType>&& alphaVector);
+
+                ValueType computeDotProduct(BeliefId const& beliefId, std::vector<ValueType> const& alphaVector);
+
+                uint64_t getOptimalAlphaVectorIndex(BeliefId const& beliefId, ValueType& value);
+
+                ValueType getInnerValue(BeliefId const& beliefId);
+
+                ValueType getOuterValue(BeliefId const& beliefId);
+
+                ValueType getGap(BeliefId const& beliefId);
+
+                bool isTarget(BeliefId const& beliefId);
+
+                /**
+                 * Returns true iff the first value is better than the second one w.r.t. the optimization direction.
+                 */
+                bool isBetter(ValueType const& first, ValueType const& second) const;
+
+                struct BeliefPoint {
+                    BeliefId beliefId;
+                    ValueType value;
+                    ValueType cornerValue;
+                };
+
+                struct Statistics {
+                    Statistics();
+                    uint64_t trials;
+                    uint64_t backups;
+                    uint64_t prunedAlphaVectors;
+                    storm::utility::Stopwatch totalTime;
+                    storm::utility::Stopwatch initializationTime;
+                    bool aborted;
+                };
+                Statistics statistics;
+
+                std::shared_ptr<PomdpModelType> inputPomdp;
+                std::shared_ptr<PomdpModelType> preprocessedPomdp;
+                Options options;
+
+                // Information about the current computation
+                std::shared_ptr<BeliefManagerType> beliefManager;
+                bool minimize;
+                bool computeRewards;
+                storm::storage::BitVector targetObservations;
+                ValueType targetValue;
+                std::vector<ValueType> actionRewards;
+                std::vector<ValueType> cornerValues;
+                std::vector<std::vector<uint64_t>> observationStates;
+                std::vector<uint64_t> localStateIndices;
+                std::vector<std::vector<std::vector<ValueType>>> alphaVectors;
+                std::vector<std::vector<BeliefPoint>> beliefPoints;
+                std::unordered_map<BeliefId, uint64_t> beliefPointIndices;
+                std::vector<std::vector<BeliefId>> visitedBeliefs;
+                storm::storage::BitVector visitedBeliefIds;
+                std::vector<uint64_t> chosenAlphaVectors;
+            };
+
+        }
+    }
+}
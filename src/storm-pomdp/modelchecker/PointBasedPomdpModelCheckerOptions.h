@@ -0,0 +1,31 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include "storm/utility/constants.h"
+#include "storm/utility/NumberTraits.h"
+
+namespace storm {
+    namespace pomdp {
+        namespace modelchecker {
+            template<typename ValueType>
+            struct PointBasedPomdpModelCheckerOptions {
+                PointBasedPomdpModelCheckerOptions() {
+                    // Intentionally left empty
+                }
+
+                // The goal gap between the lower and the upper bound at the initial belief
+                ValueType precision = storm::utility::convertNumber<ValueType>(1e-4);
+                bool relativePrecision = false;
+                // The maximal number of trials and the time limit (in seconds) after which the computation stops
+                boost::optional<uint64_t> trialLimit;
+                boost::optional<uint64_t> timeLimit;
+                // The maximal number of beliefs that are visited in a single trial
+                uint64_t maxTrialDepth = 200;
+                // The number of trials after which alpha-vectors that are not optimal at any visited belief are removed (0 means never)
+                uint64_t pruneInterval = 16;
+
+                ValueType numericPrecision = storm::NumberTraits<ValueType>::IsExact ? storm::utility::zero<ValueType>() : storm::utility::convertNumber<ValueType>(1e-9); /// Used to decide whether two beliefs are equal
+            };
+        }
+    }
+}
@@ -1,9 +1,16 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <algorithm>
+#include <random>
+#include <type_traits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
 #include "storm/models/sparse/Pomdp.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 namespace storm {
     namespace storage {
@@ -29,21 +36,59 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
-            std::size_t seed = 0;
-            // Assumes that beliefs are ordered
-            for (auto const &entry : belief) {
-                boost::hash_combine(seed, entry.first);
-                boost::hash_combine(seed, entry.second);
+        BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefEntries::BeliefEntries(BeliefManager const &manager, BeliefId const &id)
+                : states(manager.supportStates), values(manager.beliefValues) {
+            uint64_t supportId = manager.beliefSupportIds[id];
+            stateOffset = manager.supportOffsets[supportId];
+            numberOfEntries = manager.supportOffsets[supportId + 1] - stateOffset;
+            valueOffset = manager.beliefValueOffsets[id];
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::SupportHash::operator()(uint64_t const &supportId) const {
+            return manager->supportHashes[supportId];
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::SupportEqual::operator()(uint64_t const &first, uint64_t const &second) const {
+            auto const &offsets = manager->supportOffsets;
+            if (offsets[first + 1] - offsets[first] != offsets[second + 1] - offsets[second]) {
+                return false;
             }
-            return seed;
+            auto statesIt = manager->supportStates.begin();
+            return std::equal(statesIt + offsets[first], statesIt + offsets[first + 1], statesIt + offsets[second]);
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(BeliefId const &beliefId) const {
+            return manager->beliefHashes[beliefId];
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefEqual::operator()(BeliefId const &first, BeliefId const &second) const {
+            // Beliefs with the same support have the same number of values. As before, values have to match exactly.
+            if (manager->beliefSupportIds[first] != manager->beliefSupportIds[second]) {
+                return false;
+            }
+            auto const &offsets = manager->beliefValueOffsets;
+            auto valuesIt = manager->beliefValues.begin();
+            return std::equal(valuesIt + offsets[first], valuesIt + offsets[first + 1], valuesIt + offsets[second]);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode)
-                : pomdp(pomdp), triangulationMode(triangulationMode) {
+                : pomdp(pomdp), supportOffsets({0}), supportIds(0, SupportHash{this}, SupportEqual{this}), beliefValueOffsets({0}),
+                  triangulationMode(triangulationMode) {
             cc = storm::utility::ConstantsComparator<ValueType>(precision, false);
-            beliefToIdMap.resize(pomdp.getNrObservations());
+            std::mt19937_64 generator(0);
+            stateHashKeys.reserve(pomdp.getNumberOfStates());
+            for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+                stateHashKeys.push_back(static_cast<std::size_t>(generator()));
+            }
+            beliefIds.reserve(pomdp.getNrObservations());
+            for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+                beliefIds.emplace_back(0, BeliefHash{this}, BeliefEqual{this});
+            }
             initialBeliefId = computeInitialBelief();
         }
 
@@ -92,7 +137,7 @@ namespace storm {
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType
         BeliefManager<PomdpType, BeliefValueType, StateType>::getWeightedSum(BeliefId const &beliefId, std::vector<ValueType> const &summands) {
             ValueType result = storm::utility::zero<ValueType>();
-            for (auto const &entry : getBelief(beliefId)) {
+            for (auto const &entry : getBeliefEntries(beliefId)) {
                 result += storm::utility::convertNumber<ValueType>(entry.second) * storm::utility::convertNumber<ValueType>(summands.at(entry.first));
             }
             return result;
@@ -106,7 +151,7 @@ namespace storm {
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType
         BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefActionReward(BeliefId const &beliefId, uint64_t const &localActionIndex) const {
-            auto const &belief = getBelief(beliefId);
+            auto belief = getBeliefEntries(beliefId);
             STORM_LOG_ASSERT(!pomdpActionRewardVector.empty(), "Requested a reward although no reward model was specified.");
             auto result = storm::utility::zero<ValueType>();
             auto const &choiceIndices = pomdp.getTransitionMatrix().getRowGroupIndices();
@@ -121,13 +166,12 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefId beliefId) {
-            return getBeliefObservation(getBelief(beliefId));
+            return pomdp.getObservation(getBeliefEntries(beliefId)[0].first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefNumberOfChoices(BeliefId beliefId) {
-            auto const &belief = getBelief(beliefId);
-            return pomdp.getNumberOfChoices(belief.begin()->first);
+            return pomdp.getNumberOfChoices(getBeliefEntries(beliefId)[0].first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -138,7 +182,7 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         template<typename DistributionType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const {
             auto insertionRes = distr.emplace(state, value);
             if (!insertionRes.second) {
                 insertionRes.first->second += value;
@@ -147,15 +191,14 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         void BeliefManager<PomdpType, BeliefValueType, StateType>::joinSupport(BeliefId const &beliefId, BeliefSupportType &support) {
-            auto const &belief = getBelief(beliefId);
-            for (auto const &entry : belief) {
+            for (auto const &entry : getBeliefEntries(beliefId)) {
                 support.insert(entry.first);
             }
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfBeliefIds() const {
-            return beliefs.size();
+            return beliefSupportIds.size();
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -172,19 +215,19 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
-            STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existend belief.");
-            STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-            return beliefs[id];
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
+            BeliefType belief;
+            for (auto const &entry : getBeliefEntries(id)) {
+                belief.emplace_hint(belief.end(), entry.first, entry.second);
+            }
+            return belief;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(BeliefType const &belief) const {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto idIt = beliefToIdMap[obs].find(belief);
-            STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-            return idIt->second;
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefEntries BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefEntries(BeliefId const &id) const {
+            STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existend belief.");
+            STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
+            return BeliefEntries(*this, id);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -264,12 +307,12 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, RawTriangulation const &triangulation) const {
             if (triangulation.weights.size() != triangulation.gridPoints.size()) {
                 STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
                 return false;
             }
-            if (triangulation.size() == 0) {
+            if (triangulation.weights.empty()) {
                 STORM_LOG_ERROR("Empty triangulation.");
                 return false;
             }
@@ -288,8 +331,7 @@ namespace storm {
                     STORM_LOG_ERROR("Weight greater than one in triangulation.");
                 }
                 weightSum += triangulation.weights[i];
-                BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
-                for (auto const &pointEntry : gridPoint) {
+                for (auto const &pointEntry : triangulation.gridPoints[i]) {
                     BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<ValueType>()).first->second;
                     triangulatedValue += triangulation.weights[i] * pointEntry.second;
                 }
@@ -309,14 +351,14 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType const &belief) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
             return pomdp.getObservation(belief.begin()->first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        void
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution,
+                                                                                                RawTriangulation &result) const {
             STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             StateType numEntries = belief.size();
@@ -365,14 +407,14 @@ namespace storm {
                             gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
                         }
                     }
-                    result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+                    result.gridPoints.push_back(std::move(gridPoint));
                 }
                 previousSortedDiff = currentSortedDiff++;
             }
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, RawTriangulation &result) const {
             // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is minimal
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             BeliefValueType finalResolution = resolution;
@@ -409,14 +451,14 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::RawTriangulation
+        BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulation(BeliefType const &belief, BeliefValueType const &resolution) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-            Triangulation result;
+            RawTriangulation result;
             // Quickly triangulate Dirac beliefs
             if (belief.size() == 1u) {
                 result.weights.push_back(storm::utility::one<BeliefValueType>());
-                result.gridPoints.push_back(getOrAddBeliefId(belief));
+                result.gridPoints.push_back(belief);
             } else {
                 auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
                 switch (triangulationMode) {
@@ -430,17 +472,29 @@ namespace storm {
                         STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
                 }
             }
-            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
+            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation of belief " << toString(belief) << ".");
             return result;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
-            std::vector<std::pair<BeliefId, ValueType>> destinations;
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+            RawTriangulation rawTriangulation = computeTriangulation(belief, resolution);
+            Triangulation result;
+            result.gridPoints.reserve(rawTriangulation.gridPoints.size());
+            for (auto const &gridPoint : rawTriangulation.gridPoints) {
+                result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            }
+            result.weights = std::move(rawTriangulation.weights);
+            return result;
+        }
 
-            BeliefType belief = getBelief(beliefId);
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::RawExpansion
+        BeliefManager<PomdpType, BeliefValueType, StateType>::computeExpansion(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                               boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const {
+            RawExpansion result;
+            auto belief = getBeliefEntries(beliefId);
 
             // Find the probability we go to each observation
             BeliefType successorObs; // This is actually not a belief but has the same type
@@ -454,6 +508,10 @@ namespace storm {
                 }
             }
 
+            if (observationTriangulationResolutions) {
+                result.observationResolutions.emplace();
+            }
+
             // Now for each successor observation we find and potentially triangulate the successor belief
             for (auto const &successor : successorObs) {
                 BeliefType successorBelief;
@@ -470,18 +528,106 @@ namespace storm {
 
                 // Insert the destination. We know that destinations have to be disjoined since they have different observations
                 if (observationTriangulationResolutions) {
-                    Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.get()[successor.first]);
-                    for (size_t j = 0; j < triangulation.size(); ++j) {
+                    BeliefValueType const &resolution = observationTriangulationResolutions.get()[successor.first];
+                    result.observationResolutions->emplace_back(successor.first, resolution);
+                    RawTriangulation triangulation = computeTriangulation(successorBelief, resolution);
+                    for (size_t j = 0; j < triangulation.weights.size(); ++j) {
                         // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                        destinations.emplace_back(triangulation.gridPoints[j], triangulation.weights[j] * successor.second);
+                        result.successors.emplace_back(std::move(triangulation.gridPoints[j]), triangulation.weights[j] * successor.second);
                     }
                 } else {
-                    destinations.emplace_back(getOrAddBeliefId(successorBelief), successor.second);
+                    result.successors.emplace_back(std::move(successorBelief), successor.second);
+                }
+            }
+            return result;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isValidExpansion(RawExpansion const &expansion,
+                                                                                    boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const {
+            if (!observationTriangulationResolutions) {
+                return !expansion.observationResolutions;
+            }
+            if (!expansion.observationResolutions) {
+                return false;
+            }
+            // The resolutions might have been refined since the successors were prefetched
+            for (auto const &observationResolution : expansion.observationResolutions.get()) {
+                if (observationTriangulationResolutions.get()[observationResolution.first] != observationResolution.second) {
+                    return false;
                 }
             }
+            return true;
+        }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
+            RawExpansion expansion;
+            auto prefetchedIt = prefetchedExpansions.find(std::make_pair(beliefId, actionIndex));
+            if (prefetchedIt != prefetchedExpansions.end() && isValidExpansion(prefetchedIt->second, observationTriangulationResolutions)) {
+                expansion = std::move(prefetchedIt->second);
+            } else {
+                expansion = computeExpansion(beliefId, actionIndex, observationTriangulationResolutions);
+            }
+            if (prefetchedIt != prefetchedExpansions.end()) {
+                prefetchedExpansions.erase(prefetchedIt);
+            }
+
+            // Ids are assigned in the order of the successors, which is independent of whether they were prefetched.
+            std::vector<std::pair<BeliefId, ValueType>> destinations;
+            destinations.reserve(expansion.successors.size());
+            for (auto const &successor : expansion.successors) {
+                destinations.emplace_back(getOrAddBeliefId(successor.first), successor.second);
+            }
             return destinations;
+        }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::prefetchSuccessors(std::vector<BeliefId> const &beliefIds,
+                                                                                      boost::optional<std::vector<BeliefValueType>> const &observationResolutions) {
+            std::vector<std::pair<BeliefId, uint64_t>> beliefActionPairs;
+            for (auto const &beliefId : beliefIds) {
+                if (beliefId == noId()) {
+                    continue;
+                }
+                for (uint64_t action = 0; action < getBeliefNumberOfChoices(beliefId); ++action) {
+                    if (prefetchedExpansions.count(std::make_pair(beliefId, action)) == 0) {
+                        beliefActionPairs.emplace_back(beliefId, action);
+                    }
+                }
+            }
+
+            // The expansions only read the POMDP and the stored beliefs, so they can be computed independently of each other.
+            std::vector<RawExpansion> expansions(beliefActionPairs.size());
+            bool computed = false;
+#ifdef STORM_HAVE_INTELTBB
+            // Arithmetic on rational numbers is not guaranteed to be thread-safe.
+            if (std::is_same<ValueType, double>::value && std::is_same<BeliefValueType, double>::value &&
+                storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, beliefActionPairs.size()), [&](tbb::blocked_range<uint64_t> const &range) {
+                    for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                        expansions[i] = computeExpansion(beliefActionPairs[i].first, beliefActionPairs[i].second, observationResolutions);
+                    }
+                });
+                computed = true;
+            }
+#endif
+            if (!computed) {
+                for (uint64_t i = 0; i < beliefActionPairs.size(); ++i) {
+                    expansions[i] = computeExpansion(beliefActionPairs[i].first, beliefActionPairs[i].second, observationResolutions);
+                }
+            }
+
+            for (uint64_t i = 0; i < beliefActionPairs.size(); ++i) {
+                prefetchedExpansions.emplace(beliefActionPairs[i], std::move(expansions[i]));
+            }
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::clearPrefetchedSuccessors() {
+            prefetchedExpansions.clear();
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -500,14 +646,41 @@ namespace storm {
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(BeliefType const &belief) {
             uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-            if (insertioRes.second) {
-                // There actually was an insertion, so add the new belief
-                beliefs.push_back(belief);
-            }
-            // Return the id
-            return insertioRes.first->second;
+            STORM_LOG_ASSERT(obs < beliefIds.size(), "Belief has unknown observation.");
+
+            // Tentatively append the support to the arena. It is removed again if the same support is already stored.
+            std::size_t supportHash = 0;
+            for (auto const &entry : belief) {
+                supportStates.push_back(entry.first);
+                supportHash ^= stateHashKeys[entry.first];
+            }
+            supportOffsets.push_back(supportStates.size());
+            supportHashes.push_back(supportHash);
+            auto supportInsertionRes = supportIds.insert(supportHashes.size() - 1);
+            if (!supportInsertionRes.second) {
+                supportOffsets.pop_back();
+                supportStates.resize(supportOffsets.back());
+                supportHashes.pop_back();
+            }
+            uint64_t supportId = *supportInsertionRes.first;
+
+            // Same for the values of the belief.
+            std::size_t beliefHash = supportHashes[supportId];
+            for (auto const &entry : belief) {
+                beliefValues.push_back(entry.second);
+                boost::hash_combine(beliefHash, entry.second);
+            }
+            beliefSupportIds.push_back(supportId);
+            beliefValueOffsets.push_back(beliefValues.size());
+            beliefHashes.push_back(beliefHash);
+            auto insertionRes = beliefIds[obs].insert(beliefSupportIds.size() - 1);
+            if (!insertionRes.second) {
+                beliefSupportIds.pop_back();
+                beliefValueOffsets.pop_back();
+                beliefValues.resize(beliefValueOffsets.back());
+                beliefHashes.pop_back();
+            }
+            return *insertionRes.first;
         }
 
         template class BeliefManager<storm::models::sparse::Pomdp<double>>;
@@ -2,7 +2,9 @@
 
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <boost/optional.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
 
@@ -26,6 +28,10 @@ namespace storm {
 
             BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode);
 
+            // The hash tables of the manager refer to the manager itself, so it must not be copied.
+            BeliefManager(BeliefManager const &other) = delete;
+            BeliefManager &operator=(BeliefManager const &other) = delete;
+
             void setRewardModel(boost::optional<std::string> rewardModelName = boost::none);
 
             void unsetRewardModel();
@@ -58,7 +64,7 @@ namespace storm {
             Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
             template<typename DistributionType>
-            void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+            void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
             void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
@@ -69,10 +75,82 @@ namespace storm {
 
             std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+            /*!
+             * Computes the successors of all actions of the given beliefs and keeps them until they are retrieved via expand
+             * (if no resolutions are given) or expandAndTriangulate (with the same resolutions for the successor observations).
+             * For double-valued beliefs, the successors are computed in parallel if Intel TBB is available.
+             * Ids are only assigned to the successors upon retrieval, so the ids do not depend on whether successors were prefetched.
+             */
+            void prefetchSuccessors(std::vector<BeliefId> const &beliefIds, boost::optional<std::vector<BeliefValueType>> const &observationResolutions = boost::none);
+
+            /*!
+             * Drops all prefetched successors that were not retrieved.
+             */
+            void clearPrefetchedSuccessors();
+
+            /*!
+             * A read-only view on the entries of a stored belief. The view refers to the arenas of the manager (and not
+             * to their contents), so it remains valid if further beliefs are added while iterating over it.
+             */
+            class BeliefEntries {
+            public:
+                struct Entry {
+                    StateType const &first;
+                    BeliefValueType const &second;
+                };
+
+                class const_iterator {
+                public:
+                    const_iterator(BeliefEntries const &entries, uint64_t position) : entries(entries), position(position) {}
+                    Entry operator*() const { return entries[position]; }
+                    const_iterator &operator++() { ++position; return *this; }
+                    bool operator!=(const_iterator const &other) const { return position != other.position; }
+                private:
+                    BeliefEntries const &entries;
+                    uint64_t position;
+                };
+
+                BeliefEntries(BeliefManager const &manager, BeliefId const &id);
+                uint64_t size() const { return numberOfEntries; }
+                Entry operator[](uint64_t position) const { return {states[stateOffset + position], values[valueOffset + position]}; }
+                const_iterator begin() const { return const_iterator(*this, 0); }
+                const_iterator end() const { return const_iterator(*this, numberOfEntries); }
+
+            private:
+                std::vector<StateType> const &states;
+                std::vector<BeliefValueType> const &values;
+                uint64_t stateOffset;
+                uint64_t valueOffset;
+                uint64_t numberOfEntries;
+            };
+
+            /*!
+             * Retrieves a read-only view on the entries of the belief with the given id without copying them.
+             * The entries are sorted by state.
+             */
+            BeliefEntries getBeliefEntries(BeliefId const &id) const;
+
         private:
 
+            // Hashing and comparing supports and beliefs by their index in the arenas.
+            struct SupportHash {
+                BeliefManager const *manager;
+                std::size_t operator()(uint64_t const &supportId) const;
+            };
+
+            struct SupportEqual {
+                BeliefManager const *manager;
+                bool operator()(uint64_t const &first, uint64_t const &second) const;
+            };
+
             struct BeliefHash {
-                std::size_t operator()(const BeliefType &belief) const;
+                BeliefManager const *manager;
+                std::size_t operator()(BeliefId const &beliefId) const;
+            };
+
+            struct BeliefEqual {
+                BeliefManager const *manager;
+                bool operator()(BeliefId const &first, BeliefId const &second) const;
             };
 
             struct FreudenthalDiff {
@@ -83,9 +161,20 @@ namespace storm {
                 bool operator>(FreudenthalDiff const &other) const;
             };
 
-            BeliefType const &getBelief(BeliefId const &id) const;
+            // A triangulation whose grid points were not assigned ids yet.
+            struct RawTriangulation {
+                std::vector<BeliefType> gridPoints;
+                std::vector<BeliefValueType> weights;
+            };
+
+            // The successors of a belief under an action that were not assigned ids yet.
+            struct RawExpansion {
+                std::vector<std::pair<BeliefType, ValueType>> successors;
+                // For triangulated successors, the resolution that was used for each successor observation.
+                boost::optional<std::vector<std::pair<uint32_t, BeliefValueType>>> observationResolutions;
+            };
 
-            BeliefId getId(BeliefType const &belief) const;
+            BeliefType getBelief(BeliefId const &id) const;
 
             std::string toString(BeliefType const &belief) const;
 
@@ -93,16 +182,23 @@ namespace storm {
 
             bool assertBelief(BeliefType const &belief) const;
 
-            bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+            bool assertTriangulation(BeliefType const &belief, RawTriangulation const &triangulation) const;
 
-            uint32_t getBeliefObservation(BeliefType belief) const;
+            uint32_t getBeliefObservation(BeliefType const &belief) const;
 
-            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, RawTriangulation &result) const;
 
-            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, RawTriangulation &result) const;
+
+            RawTriangulation computeTriangulation(BeliefType const &belief, BeliefValueType const &resolution) const;
 
             Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
 
+            // Does not modify the manager, so it may be called concurrently.
+            RawExpansion computeExpansion(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const;
+
+            bool isValidExpansion(RawExpansion const &expansion, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const;
+
             std::vector<std::pair<BeliefId, ValueType>>
             expandInternal(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = boost::none);
 
@@ -113,9 +209,23 @@ namespace storm {
             PomdpType const& pomdp;
             std::vector<ValueType> pomdpActionRewardVector;
             
-            std::vector<BeliefType> beliefs;
-            std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash>> beliefToIdMap;
+            // Every belief consists of a support, i.e. a sorted range of states in supportStates, and one value per state
+            // of its support, stored consecutively in beliefValues. Supports are shared by all beliefs with the same
+            // support. The hash of a support is the xor of random keys of its states (Zobrist hashing).
+            std::vector<StateType> supportStates;
+            std::vector<uint64_t> supportOffsets;
+            std::vector<std::size_t> supportHashes;
+            std::unordered_set<uint64_t, SupportHash, SupportEqual> supportIds;
+            std::vector<std::size_t> stateHashKeys;
+
+            std::vector<uint64_t> beliefSupportIds;
+            std::vector<BeliefValueType> beliefValues;
+            std::vector<uint64_t> beliefValueOffsets;
+            std::vector<std::size_t> beliefHashes;
+            std::vector<std::unordered_set<BeliefId, BeliefHash, BeliefEqual>> beliefIds;
             BeliefId initialBeliefId;
+
+            std::unordered_map<std::pair<BeliefId, uint64_t>, RawExpansion, boost::hash<std::pair<BeliefId, uint64_t>>> prefetchedExpansions;
             
             storm::utility::ConstantsComparator<ValueType> cc;
             
@@ -11,6 +11,9 @@
 #include "storm/storage/jani/Edge.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -71,6 +74,36 @@ std::set<storm::expressions::Variable> const& AutomatonAbstractor<DdType, ValueT
 
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> AutomatonAbstractor<DdType, ValueType>::abstract() {
+    // Only the edges whose relevant predicates changed in the last refinement step are re-abstracted, all others
+    // merely extend their cached abstraction by the identities of the new predicates.
+    uint64_t numberOfRecomputedEdges = 0;
+    for (auto const& edge : edges) {
+        if (edge.isRecomputationRequired()) {
+            ++numberOfRecomputedEdges;
+        }
+    }
+    STORM_LOG_DEBUG("Re-abstracting " << numberOfRecomputedEdges << " of " << edges.size() << " edges.");
+
+#ifdef STORM_HAVE_INTELTBB
+    // The SMT-based enumerations of the edges are independent of each other and do not involve DD operations, so
+    // they can be performed concurrently. The DD operations in between are performed sequentially.
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, edges.size()), [this](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                edges[index].enumerateGuardSolutions();
+            }
+        });
+        for (auto& edge : edges) {
+            edge.constrainToAbstractGuard();
+        }
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, edges.size()), [this](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                edges[index].enumerateTransitionSolutions();
+            }
+        });
+    }
+#endif
+
     // First, we retrieve the abstractions of all commands.
     std::vector<GameBddResult<DdType>> edgeDdsAndUsedOptionVariableCounts;
     uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
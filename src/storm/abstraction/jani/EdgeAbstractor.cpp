@@ -34,14 +34,16 @@ EdgeAbstractor<DdType, ValueType>::EdgeAbstractor(uint64_t edgeId, storm::jani::
       evaluator(abstractionInformation.getExpressionManager()),
       relevantPredicatesAndVariables(),
       cachedDd(abstractionInformation.getDdManager().getBddZero(), 0),
-      decisionVariables(),
       useDecomposition(useDecomposition),
       addPredicatesForValidBlocks(addPredicatesForValidBlocks),
       skipBottomStates(false),
       forceRecomputation(true),
       abstractGuard(abstractionInformation.getDdManager().getBddZero()),
       bottomStateAbstractor(abstractionInformation, {!edge.getGuard()}, smtSolverFactory),
-      debug(debug) {
+      debug(debug),
+      recomputationStage(RecomputationStage::None),
+      enumerateAbstractGuard(false),
+      abstractGuardSolutionsEnumerated(false) {
     // Make the second component of relevant predicates have the right size.
     relevantPredicatesAndVariables.second.resize(edge.getNumberOfDestinations());
 
@@ -116,14 +118,13 @@ void EdgeAbstractor<DdType, ValueType>::recomputeCachedBdd() {
     } else {
         recomputeCachedBddWithoutDecomposition();
     }
+    blockEnumerations.clear();
+    recomputationStage = RecomputationStage::None;
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
-void EdgeAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
-    STORM_LOG_TRACE("Recomputing BDD for edge with id " << edgeId << " and guard " << edge.get().getGuard() << " using the decomposition.");
-    auto start = std::chrono::high_resolution_clock::now();
-
-    // compute a decomposition of the command
+void EdgeAbstractor<DdType, ValueType>::computeDecomposition() {
+    // compute a decomposition of the edge
     //  * start with all relevant blocks: blocks of assignment variables and variables in the rhs of assignments
     //  * go through all assignments of all updates and merge relevant blocks that are related via an assignment
     //  * repeat this until nothing changes anymore
@@ -250,7 +251,7 @@ void EdgeAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
 
     // Check whether we need to enumerate the guard. This is the case if the blocks related by the guard
     // are not contained within a single block of our decomposition.
-    bool enumerateAbstractGuard = true;
+    enumerateAbstractGuard = true;
     std::set<uint64_t> guardBlocks = localExpressionInformation.getBlockIndicesOfVariables(variablesContainedInGuard);
     for (auto const& block : relevantBlockPartition) {
         bool allContained = true;
@@ -265,55 +266,23 @@ void EdgeAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
         }
     }
 
-    uint64_t numberOfSolutions = 0;
-    uint64_t numberOfTotalSolutions = 0;
-
-    // If we need to enumerate the guard, do it only once now.
+    // Collect the variables over which to enumerate the abstract guard.
+    guardVariablesAndPredicates.clear();
+    guardDecisionVariables.clear();
+    guardPredicates.clear();
     if (enumerateAbstractGuard) {
         std::set<uint64_t> relatedGuardPredicates = localExpressionInformation.getRelatedExpressions(variablesContainedInGuard);
-        std::vector<storm::expressions::Variable> guardDecisionVariables;
-        std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> guardVariablesAndPredicates;
         for (auto const& element : relevantPredicatesAndVariables.first) {
             if (relatedGuardPredicates.find(element.second) != relatedGuardPredicates.end()) {
                 guardDecisionVariables.push_back(element.first);
                 guardVariablesAndPredicates.push_back(element);
+                guardPredicates.push_back(element.second);
             }
         }
-        abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
-        smtSolver->allSat(guardDecisionVariables,
-                          [this, &guardVariablesAndPredicates, &numberOfSolutions](storm::solver::SmtSolver::ModelReference const& model) {
-                              abstractGuard |= getSourceStateBdd(model, guardVariablesAndPredicates);
-                              ++numberOfSolutions;
-                              return true;
-                          });
-        STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for abstract guard.");
-
-        // Now that we have the abstract guard, we can add it as an assertion to the solver before enumerating
-        // the other solutions.
-
-        // Create a new backtracking point before adding the guard.
-        smtSolver->push();
-
-        // Create the guard constraint.
-        std::pair<std::vector<storm::expressions::Expression>, std::unordered_map<uint_fast64_t, storm::expressions::Variable>> result =
-            abstractGuard.toExpression(this->getAbstractionInformation().getExpressionManager());
-
-        // Then add it to the solver.
-        for (auto const& expression : result.first) {
-            smtSolver->add(expression);
-        }
-
-        // Finally associate the level variables with the predicates.
-        for (auto const& indexVariablePair : result.second) {
-            smtSolver->add(
-                storm::expressions::iff(indexVariablePair.second, this->getAbstractionInformation().getPredicateForDdVariableIndex(indexVariablePair.first)));
-        }
     }
 
-    // Then enumerate the solutions for each of the blocks of the decomposition
-    uint64_t usedNondeterminismVariables = 0;
-    uint64_t blockCounter = 0;
-    std::vector<storm::dd::Bdd<DdType>> blockBdds;
+    // Collect the variables over which to enumerate the solutions of each of the blocks of the decomposition.
+    blockEnumerations.clear();
     for (auto const& block : relevantBlockPartition) {
         std::set<uint64_t> relevantPredicates;
         for (auto const& innerBlock : block) {
@@ -326,11 +295,9 @@ void EdgeAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
             continue;
         }
 
-        std::vector<storm::expressions::Variable> transitionDecisionVariables;
         std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> sourceVariablesAndPredicates;
         for (auto const& element : relevantPredicatesAndVariables.first) {
             if (relevantPredicates.find(element.second) != relevantPredicates.end()) {
-                transitionDecisionVariables.push_back(element.first);
                 sourceVariablesAndPredicates.push_back(element);
             }
         }
@@ -346,24 +313,177 @@ void EdgeAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
                     for (auto const& element : relevantPredicatesAndVariables.second[destinationIndex]) {
                         if (assignmentVariableBlock.find(element.second) != assignmentVariableBlock.end()) {
                             destinationVariablesAndPredicates.back().push_back(element);
-                            transitionDecisionVariables.push_back(element.first);
                         }
                     }
                 }
             }
         }
 
-        std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-        numberOfSolutions = 0;
-        smtSolver->allSat(transitionDecisionVariables, [&sourceToDistributionsMap, this, &numberOfSolutions, &sourceVariablesAndPredicates,
-                                                        &destinationVariablesAndPredicates](storm::solver::SmtSolver::ModelReference const& model) {
-            sourceToDistributionsMap[getSourceStateBdd(model, sourceVariablesAndPredicates)].push_back(
-                getDistributionBdd(model, destinationVariablesAndPredicates));
-            ++numberOfSolutions;
-            return true;
-        });
-        STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for block " << blockCounter << ".");
-        numberOfTotalSolutions += numberOfSolutions;
+        blockEnumerations.push_back(createBlockEnumeration(guardPredicates, sourceVariablesAndPredicates, destinationVariablesAndPredicates));
+    }
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+typename EdgeAbstractor<DdType, ValueType>::BlockEnumeration EdgeAbstractor<DdType, ValueType>::createBlockEnumeration(
+    std::vector<uint64_t> const& guardPredicateIndices, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& sourceVariablesAndPredicates,
+    std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& destinationVariablesAndPredicates) const {
+    BlockEnumeration result;
+    result.sourceVariablesAndPredicates = sourceVariablesAndPredicates;
+    result.destinationVariablesAndPredicates = destinationVariablesAndPredicates;
+
+    result.key.push_back(guardPredicateIndices);
+    result.key.emplace_back();
+    for (auto const& element : sourceVariablesAndPredicates) {
+        result.decisionVariables.push_back(element.first);
+        result.key.back().push_back(element.second);
+    }
+    for (auto const& variablesAndPredicatesOfDestination : destinationVariablesAndPredicates) {
+        result.key.emplace_back();
+        for (auto const& element : variablesAndPredicatesOfDestination) {
+            result.decisionVariables.push_back(element.first);
+            result.key.back().push_back(element.second);
+        }
+    }
+    return result;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::storage::BitVector EdgeAbstractor<DdType, ValueType>::getValuation(storm::solver::SmtSolver::ModelReference const& model,
+                                                                             std::vector<storm::expressions::Variable> const& variables) const {
+    storm::storage::BitVector result(variables.size());
+    for (uint64_t index = 0; index < variables.size(); ++index) {
+        if (model.getBooleanValue(variables[index])) {
+            result.set(index);
+        }
+    }
+    return result;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void EdgeAbstractor<DdType, ValueType>::enumerateGuardSolutions() {
+    if (!forceRecomputation || recomputationStage != RecomputationStage::None) {
+        return;
+    }
+
+    if (useDecomposition) {
+        computeDecomposition();
+
+        // The abstract guard only needs to be enumerated if the predicates related to the guard changed.
+        abstractGuardSolutionsEnumerated = false;
+        if (enumerateAbstractGuard && (!abstractGuardPredicates || abstractGuardPredicates.get() != guardPredicates)) {
+            guardSolutions.clear();
+            smtSolver->allSat(guardDecisionVariables, [this](storm::solver::SmtSolver::ModelReference const& model) {
+                guardSolutions.push_back(getValuation(model, guardDecisionVariables));
+                return true;
+            });
+            STORM_LOG_TRACE("Enumerated " << guardSolutions.size() << " solutions for abstract guard.");
+            abstractGuardSolutionsEnumerated = true;
+        }
+    } else {
+        blockEnumerations.clear();
+        blockEnumerations.push_back(createBlockEnumeration({}, relevantPredicatesAndVariables.first, relevantPredicatesAndVariables.second));
+    }
+    recomputationStage = RecomputationStage::GuardEnumerated;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void EdgeAbstractor<DdType, ValueType>::constrainToAbstractGuard() {
+    enumerateGuardSolutions();
+    if (recomputationStage != RecomputationStage::GuardEnumerated) {
+        return;
+    }
+
+    if (useDecomposition && enumerateAbstractGuard) {
+        if (abstractGuardSolutionsEnumerated) {
+            abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
+            for (auto const& solution : guardSolutions) {
+                abstractGuard |= getSourceStateBdd(solution, 0, guardVariablesAndPredicates);
+            }
+            guardSolutions.clear();
+            abstractGuardPredicates = guardPredicates;
+        } else {
+            STORM_LOG_TRACE("Reusing abstract guard, because its relevant predicates did not change.");
+        }
+
+        // Now that we have the abstract guard, we can add it as an assertion to the solver before enumerating
+        // the other solutions.
+
+        // Create a new backtracking point before adding the guard.
+        smtSolver->push();
+
+        // Create the guard constraint.
+        std::pair<std::vector<storm::expressions::Expression>, std::unordered_map<uint_fast64_t, storm::expressions::Variable>> result =
+            abstractGuard.toExpression(this->getAbstractionInformation().getExpressionManager());
+
+        // Then add it to the solver.
+        for (auto const& expression : result.first) {
+            smtSolver->add(expression);
+        }
+
+        // Finally associate the level variables with the predicates.
+        for (auto const& indexVariablePair : result.second) {
+            smtSolver->add(
+                storm::expressions::iff(indexVariablePair.second, this->getAbstractionInformation().getPredicateForDdVariableIndex(indexVariablePair.first)));
+        }
+    }
+    recomputationStage = RecomputationStage::GuardConstrained;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void EdgeAbstractor<DdType, ValueType>::enumerateTransitionSolutions() {
+    constrainToAbstractGuard();
+    if (recomputationStage != RecomputationStage::GuardConstrained) {
+        return;
+    }
+
+    uint64_t blockCounter = 0;
+    for (auto& block : blockEnumerations) {
+        // If the predicates of a block did not change since the last recomputation, its solutions did not change either.
+        if (useDecomposition && blockSolutionCache.find(block.key) != blockSolutionCache.end()) {
+            STORM_LOG_TRACE("Reusing solutions for block " << blockCounter << ".");
+            block.cached = true;
+        } else {
+            smtSolver->allSat(block.decisionVariables, [this, &block](storm::solver::SmtSolver::ModelReference const& model) {
+                block.solutions.push_back(getValuation(model, block.decisionVariables));
+                return true;
+            });
+            STORM_LOG_TRACE("Enumerated " << block.solutions.size() << " solutions for block " << blockCounter << ".");
+        }
+        ++blockCounter;
+    }
+
+    if (useDecomposition && enumerateAbstractGuard) {
+        smtSolver->pop();
+    }
+    recomputationStage = RecomputationStage::TransitionsEnumerated;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> EdgeAbstractor<DdType, ValueType>::getSourceToDistributionsMap(
+    BlockEnumeration const& block) const {
+    std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> result;
+    for (auto const& solution : block.solutions) {
+        result[getSourceStateBdd(solution, 0, block.sourceVariablesAndPredicates)].push_back(
+            getDistributionBdd(solution, block.sourceVariablesAndPredicates.size(), block.destinationVariablesAndPredicates));
+    }
+    return result;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void EdgeAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
+    STORM_LOG_TRACE("Recomputing BDD for edge with id " << edgeId << " and guard " << edge.get().getGuard() << " using the decomposition.");
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // Build the BDDs of the blocks from their solutions.
+    uint64_t numberOfTotalSolutions = 0;
+    uint64_t usedNondeterminismVariables = 0;
+    uint64_t blockCounter = 0;
+    std::vector<storm::dd::Bdd<DdType>> blockBdds;
+    std::map<std::vector<std::vector<uint64_t>>, std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>>> newBlockSolutionCache;
+    for (auto const& block : blockEnumerations) {
+        std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap =
+            block.cached ? blockSolutionCache.at(block.key) : getSourceToDistributionsMap(block);
+        numberOfTotalSolutions += block.solutions.size();
 
         // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
         // need to encode the nondeterminism.
@@ -400,12 +520,10 @@ void EdgeAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
         usedNondeterminismVariables += numberOfVariablesNeeded;
 
         blockBdds.push_back(resultBdd);
+        newBlockSolutionCache.emplace(block.key, std::move(sourceToDistributionsMap));
         ++blockCounter;
     }
-
-    if (enumerateAbstractGuard) {
-        smtSolver->pop();
-    }
+    blockSolutionCache = std::move(newBlockSolutionCache);
 
     // multiply the results
     storm::dd::Bdd<DdType> resultBdd = getAbstractionInformation().getDdManager().getBddOne();
@@ -428,6 +546,7 @@ void EdgeAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
                               resultBdd.getContainedMetaVariables().end(), std::inserter(variablesToAbstract, variablesToAbstract.begin()));
 
         abstractGuard = resultBdd.existsAbstract(variablesToAbstract);
+        abstractGuardPredicates = boost::none;
     } else {
         // Multiply the abstract guard as it can contain predicates that are not mentioned in the blocks.
         resultBdd &= abstractGuard;
@@ -455,14 +574,9 @@ void EdgeAbstractor<DdType, ValueType>::recomputeCachedBddWithoutDecomposition()
     auto start = std::chrono::high_resolution_clock::now();
 
     // Create a mapping from source state DDs to their distributions.
-    std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-    uint64_t numberOfSolutions = 0;
-    smtSolver->allSat(decisionVariables, [&sourceToDistributionsMap, this, &numberOfSolutions](storm::solver::SmtSolver::ModelReference const& model) {
-        sourceToDistributionsMap[getSourceStateBdd(model, relevantPredicatesAndVariables.first)].push_back(
-            getDistributionBdd(model, relevantPredicatesAndVariables.second));
-        ++numberOfSolutions;
-        return true;
-    });
+    std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap =
+        getSourceToDistributionsMap(blockEnumerations.front());
+    uint64_t numberOfSolutions = blockEnumerations.front().solutions.size();
 
     // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
     // need to encode the nondeterminism.
@@ -479,6 +593,7 @@ void EdgeAbstractor<DdType, ValueType>::recomputeCachedBddWithoutDecomposition()
     storm::dd::Bdd<DdType> resultBdd = this->getAbstractionInformation().getDdManager().getBddZero();
     if (!skipBottomStates) {
         abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
+        abstractGuardPredicates = boost::none;
     }
     for (auto const& sourceDistributionsPair : sourceToDistributionsMap) {
         if (!skipBottomStates) {
@@ -580,7 +695,6 @@ void EdgeAbstractor<DdType, ValueType>::addMissingPredicates(
     for (auto const& element : newSourceVariables) {
         allRelevantPredicates.insert(element.second);
         smtSolver->add(storm::expressions::iff(element.first, this->getAbstractionInformation().getPredicateByIndex(element.second)));
-        decisionVariables.push_back(element.first);
     }
 
     // Insert the new variables into the record of relevant source variables.
@@ -599,7 +713,6 @@ void EdgeAbstractor<DdType, ValueType>::addMissingPredicates(
             smtSolver->add(storm::expressions::iff(element.first, this->getAbstractionInformation()
                                                                       .getPredicateByIndex(element.second)
                                                                       .substitute(edge.get().getDestination(index).getAsVariableToExpressionMap())));
-            decisionVariables.push_back(element.first);
         }
 
         relevantPredicatesAndVariables.second[index].insert(relevantPredicatesAndVariables.second[index].end(), newSuccessorVariables.begin(),
@@ -612,16 +725,15 @@ void EdgeAbstractor<DdType, ValueType>::addMissingPredicates(
 
 template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::getSourceStateBdd(
-    storm::solver::SmtSolver::ModelReference const& model,
+    storm::storage::BitVector const& valuation, uint64_t offset,
     std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
     storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddOne();
-    for (auto variableIndexPairIt = variablePredicates.rbegin(), variableIndexPairIte = variablePredicates.rend(); variableIndexPairIt != variableIndexPairIte;
-         ++variableIndexPairIt) {
-        auto const& variableIndexPair = *variableIndexPairIt;
-        if (model.getBooleanValue(variableIndexPair.first)) {
-            result &= this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
+    for (uint64_t index = variablePredicates.size(); index > 0; --index) {
+        uint_fast64_t predicateIndex = variablePredicates[index - 1].second;
+        if (valuation.get(offset + index - 1)) {
+            result &= this->getAbstractionInformation().encodePredicateAsSource(predicateIndex);
         } else {
-            result &= !this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
+            result &= !this->getAbstractionInformation().encodePredicateAsSource(predicateIndex);
         }
     }
 
@@ -631,7 +743,7 @@ storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::getSourceStateBdd(
 
 template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::getDistributionBdd(
-    storm::solver::SmtSolver::ModelReference const& model,
+    storm::storage::BitVector const& valuation, uint64_t offset,
     std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const {
     storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddZero();
 
@@ -639,15 +751,15 @@ storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::getDistributionBdd(
         storm::dd::Bdd<DdType> updateBdd = this->getAbstractionInformation().getDdManager().getBddOne();
 
         // Translate block variables for this update into a successor block.
-        for (auto variableIndexPairIt = variablePredicates[destinationIndex].rbegin(), variableIndexPairIte = variablePredicates[destinationIndex].rend();
-             variableIndexPairIt != variableIndexPairIte; ++variableIndexPairIt) {
-            auto const& variableIndexPair = *variableIndexPairIt;
-            if (model.getBooleanValue(variableIndexPair.first)) {
-                updateBdd &= this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
+        for (uint64_t index = variablePredicates[destinationIndex].size(); index > 0; --index) {
+            uint_fast64_t predicateIndex = variablePredicates[destinationIndex][index - 1].second;
+            if (valuation.get(offset + index - 1)) {
+                updateBdd &= this->getAbstractionInformation().encodePredicateAsSuccessor(predicateIndex);
             } else {
-                updateBdd &= !this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
+                updateBdd &= !this->getAbstractionInformation().encodePredicateAsSuccessor(predicateIndex);
             }
         }
+        offset += variablePredicates[destinationIndex].size();
 
         updateBdd &= this->getAbstractionInformation().encodeAux(destinationIndex, 0, this->getAbstractionInformation().getAuxVariableCount());
         result |= updateBdd;
@@ -687,6 +799,8 @@ storm::dd::Bdd<DdType> EdgeAbstractor<DdType, ValueType>::computeMissingDestinat
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> EdgeAbstractor<DdType, ValueType>::abstract() {
     if (forceRecomputation) {
+        // Perform the stages of the enumeration that were not triggered before.
+        this->enumerateTransitionSolutions();
         this->recomputeCachedBdd();
     } else {
         cachedDd.bdd &= computeMissingDestinationIdentities();
@@ -802,6 +916,11 @@ void EdgeAbstractor<DdType, ValueType>::notifyGuardIsPredicate() {
     skipBottomStates = true;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+bool EdgeAbstractor<DdType, ValueType>::isRecomputationRequired() const {
+    return forceRecomputation;
+}
+
 template class EdgeAbstractor<storm::dd::DdType::CUDD, double>;
 template class EdgeAbstractor<storm::dd::DdType::Sylvan, double>;
 #ifdef STORM_HAVE_CARL
@@ -3,12 +3,17 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include "storm/abstraction/GameBddResult.h"
 #include "storm/abstraction/LocalExpressionInformation.h"
 #include "storm/abstraction/StateSetAbstractor.h"
 
+#include "storm/storage/BitVector.h"
+#include "storm/storage/dd/Bdd.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 
 #include "storm/storage/dd/DdType.h"
@@ -24,9 +29,6 @@ class SmtSolverFactory;
 }  // namespace utility
 
 namespace dd {
-template<storm::dd::DdType DdType>
-class Bdd;
-
 template<storm::dd::DdType DdType, typename ValueType>
 class Add;
 }  // namespace dd
@@ -91,7 +93,29 @@ class EdgeAbstractor {
     std::set<storm::expressions::Variable> const& getAssignedVariables() const;
 
     /*!
-     * Computes the abstraction of the edge wrt. to the current set of predicates.
+     * Enumerates the solutions of the abstract guard, if the abstraction needs to be recomputed and the guard is to be
+     * enumerated separately. As this only uses the SMT solver of this edge (and no DD operations), it may be called
+     * concurrently for different edges.
+     */
+    void enumerateGuardSolutions();
+
+    /*!
+     * Builds the abstract guard from its solutions (if they were enumerated) and restricts the SMT solver to it. As this
+     * performs DD operations, it must not be called concurrently.
+     */
+    void constrainToAbstractGuard();
+
+    /*!
+     * Enumerates the solutions that make up the transitions of the abstract edge, if the abstraction needs to be
+     * recomputed. As this only uses the SMT solver of this edge (and no DD operations), it may be called concurrently
+     * for different edges. Blocks of the decomposition whose relevant predicates did not change since the last
+     * recomputation are not enumerated again.
+     */
+    void enumerateTransitionSolutions();
+
+    /*!
+     * Computes the abstraction of the edge wrt. to the current set of predicates. Stages of the enumeration that were
+     * not triggered explicitly before are performed as part of this call.
      *
      * @return The abstraction of the edge in the form of a BDD together with the number of DD variables
      * used to encode the choices of player 2.
@@ -128,7 +152,54 @@ class EdgeAbstractor {
 
     void notifyGuardIsPredicate();
 
+    /*!
+     * Retrieves whether the abstraction of the edge needs to be recomputed, because its relevant predicates changed.
+     */
+    bool isRecomputationRequired() const;
+
    private:
+    // The stages of the recomputation of the cached BDD.
+    enum class RecomputationStage { None, GuardEnumerated, GuardConstrained, TransitionsEnumerated };
+
+    // The information needed to enumerate the solutions of one block of the decomposition (or of the whole edge if
+    // the decomposition is not used).
+    struct BlockEnumeration {
+        // The predicates of the abstract guard the enumeration is restricted to and the source and successor predicates
+        // of the block. Solutions of a previous recomputation can be reused if they agree on this key.
+        std::vector<std::vector<uint64_t>> key;
+
+        // The source and successor variables (and their predicates) of the block. The decision variables consist of
+        // the source variables followed by the successor variables of each destination.
+        std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> sourceVariablesAndPredicates;
+        std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> destinationVariablesAndPredicates;
+        std::vector<storm::expressions::Variable> decisionVariables;
+
+        // The valuations of the decision variables in the enumerated solutions.
+        std::vector<storm::storage::BitVector> solutions;
+
+        // A flag indicating whether the solutions are taken from the cache of the last recomputation.
+        bool cached = false;
+    };
+
+    /*!
+     * Computes the decomposition of the edge into blocks whose solutions can be enumerated separately.
+     */
+    void computeDecomposition();
+
+    /*!
+     * Creates the enumeration information for the given source and successor variables.
+     */
+    BlockEnumeration createBlockEnumeration(
+        std::vector<uint64_t> const& guardPredicateIndices,
+        std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& sourceVariablesAndPredicates,
+        std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& destinationVariablesAndPredicates) const;
+
+    /*!
+     * Retrieves the valuation of the given variables in the given model.
+     */
+    storm::storage::BitVector getValuation(storm::solver::SmtSolver::ModelReference const& model,
+                                           std::vector<storm::expressions::Variable> const& variables) const;
+
     /*!
      * Determines the relevant predicates for source as well as successor states wrt. to the given assignments
      * (that, for example, form an update).
@@ -163,23 +234,30 @@ class EdgeAbstractor {
     void addMissingPredicates(std::pair<std::set<uint_fast64_t>, std::vector<std::set<uint_fast64_t>>> const& newRelevantPredicates);
 
     /*!
-     * Translates the given model to a source state DD.
+     * Translates the given valuation to a source state DD.
      *
-     * @param model The model to translate.
+     * @param valuation The valuation to translate.
+     * @param offset The position of the value of the first variable in the valuation.
      * @return The source state encoded as a DD.
      */
-    storm::dd::Bdd<DdType> getSourceStateBdd(storm::solver::SmtSolver::ModelReference const& model,
+    storm::dd::Bdd<DdType> getSourceStateBdd(storm::storage::BitVector const& valuation, uint64_t offset,
                                              std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const;
 
     /*!
-     * Translates the given model to a distribution over successor states.
+     * Translates the given valuation to a distribution over successor states.
      *
-     * @param model The model to translate.
-     * @return The source state encoded as a DD.
+     * @param valuation The valuation to translate.
+     * @param offset The position of the value of the first variable of the first destination in the valuation.
+     * @return The distribution encoded as a DD.
      */
-    storm::dd::Bdd<DdType> getDistributionBdd(storm::solver::SmtSolver::ModelReference const& model,
+    storm::dd::Bdd<DdType> getDistributionBdd(storm::storage::BitVector const& valuation, uint64_t offset,
                                               std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const;
 
+    /*!
+     * Translates the solutions of the given block to a mapping from source states to their distributions.
+     */
+    std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> getSourceToDistributionsMap(BlockEnumeration const& block) const;
+
     /*!
      * Recomputes the cached BDD. This needs to be triggered if any relevant predicates change.
      */
@@ -250,9 +328,6 @@ class EdgeAbstractor {
     // predicates, this result may be reused.
     GameBddResult<DdType> cachedDd;
 
-    // All relevant decision variables over which to perform AllSat.
-    std::vector<storm::expressions::Variable> decisionVariables;
-
     // A flag indicating whether to use the decomposition when abstracting.
     bool useDecomposition;
 
@@ -275,6 +350,27 @@ class EdgeAbstractor {
 
     // A flag that indicates whether or not debug mode is enabled.
     bool debug;
+
+    // The stage of the ongoing recomputation of the cached BDD.
+    RecomputationStage recomputationStage;
+
+    // The blocks of the ongoing recomputation.
+    std::vector<BlockEnumeration> blockEnumerations;
+
+    // Whether the abstract guard is to be enumerated separately in the ongoing recomputation and the information needed
+    // for its enumeration.
+    bool enumerateAbstractGuard;
+    bool abstractGuardSolutionsEnumerated;
+    std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> guardVariablesAndPredicates;
+    std::vector<storm::expressions::Variable> guardDecisionVariables;
+    std::vector<uint64_t> guardPredicates;
+    std::vector<storm::storage::BitVector> guardSolutions;
+
+    // The predicates over which the current abstract guard was enumerated (if it was enumerated).
+    boost::optional<std::vector<uint64_t>> abstractGuardPredicates;
+
+    // The solutions of the blocks of the last recomputation (as a mapping from source states to distributions).
+    std::map<std::vector<std::vector<uint64_t>>, std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>>> blockSolutionCache;
 };
 }  // namespace jani
 }  // namespace abstraction
@@ -10,6 +10,9 @@
 #include "storm/storage/prism/Module.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -64,6 +67,36 @@ std::set<storm::expressions::Variable> const& ModuleAbstractor<DdType, ValueType
 
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> ModuleAbstractor<DdType, ValueType>::abstract() {
+    // Only the commands whose relevant predicates changed in the last refinement step are re-abstracted, all others
+    // merely extend their cached abstraction by the identities of the new predicates.
+    uint64_t numberOfRecomputedCommands = 0;
+    for (auto const& command : commands) {
+        if (command.isRecomputationRequired()) {
+            ++numberOfRecomputedCommands;
+        }
+    }
+    STORM_LOG_DEBUG("Re-abstracting " << numberOfRecomputedCommands << " of " << commands.size() << " commands.");
+
+#ifdef STORM_HAVE_INTELTBB
+    // The SMT-based enumerations of the commands are independent of each other and do not involve DD operations, so
+    // they can be performed concurrently. The DD operations in between are performed sequentially.
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, commands.size()), [this](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                commands[index].enumerateGuardSolutions();
+            }
+        });
+        for (auto& command : commands) {
+            command.constrainToAbstractGuard();
+        }
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, commands.size()), [this](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                commands[index].enumerateTransitionSolutions();
+            }
+        });
+    }
+#endif
+
     // First, we retrieve the abstractions of all commands.
     std::vector<GameBddResult<DdType>> commandDdsAndUsedOptionVariableCounts;
     uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
@@ -19,6 +19,7 @@
 
 #ifdef STORM_HAVE_INTELTBB
 #include "tbb/blocked_range.h"
+#include "tbb/parallel_invoke.h"
 #include "tbb/parallel_for.h"
 #include "tbb/tbb_stddef.h"
 #endif
@@ -24,11 +24,12 @@ void exportJaniModelAsDot(storm::jani::Model const& model, std::string const& fi
 
 template<typename ValueType>
 void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename,
-                            std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders = true) {
+                            std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders = true, bool formatInParallel = false) {
     std::ofstream stream;
     storm::utility::openFile(filename, stream);
     storm::exporter::DirectEncodingOptions options;
     options.allowPlaceholders = allowPlaceholders;
+    options.formatInParallel = formatInParallel;
     storm::exporter::explicitExportSparseModel(stream, model, parameterNames, options);
     storm::utility::closeFile(stream);
 }
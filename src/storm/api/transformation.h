@@ -101,25 +101,26 @@ std::shared_ptr<storm::logic::Formula const> checkAndTransformContinuousToDiscre
 }
 
 /*!
- * Transforms the given symbolic model to a sparse model.
+ * Transforms the given symbolic model to a sparse model whose states are numbered in the given order.
  */
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> transformSymbolicToSparseModel(
     std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& symbolicModel,
-    std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = std::vector<std::shared_ptr<storm::logic::Formula const>>()) {
+    std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = std::vector<std::shared_ptr<storm::logic::Formula const>>(),
+    storm::transformer::SparseStateOrder const& stateOrder = storm::transformer::SparseStateOrder::Odd) {
     switch (symbolicModel->getType()) {
         case storm::models::ModelType::Dtmc:
             return storm::transformer::SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>().translate(
-                *symbolicModel->template as<storm::models::symbolic::Dtmc<Type, ValueType>>(), formulas);
+                *symbolicModel->template as<storm::models::symbolic::Dtmc<Type, ValueType>>(), formulas, stateOrder);
         case storm::models::ModelType::Mdp:
             return storm::transformer::SymbolicMdpToSparseMdpTransformer<Type, ValueType>::translate(
-                *symbolicModel->template as<storm::models::symbolic::Mdp<Type, ValueType>>(), formulas);
+                *symbolicModel->template as<storm::models::symbolic::Mdp<Type, ValueType>>(), formulas, stateOrder);
         case storm::models::ModelType::Ctmc:
             return storm::transformer::SymbolicCtmcToSparseCtmcTransformer<Type, ValueType>::translate(
-                *symbolicModel->template as<storm::models::symbolic::Ctmc<Type, ValueType>>(), formulas);
+                *symbolicModel->template as<storm::models::symbolic::Ctmc<Type, ValueType>>(), formulas, stateOrder);
         case storm::models::ModelType::MarkovAutomaton:
             return storm::transformer::SymbolicMaToSparseMaTransformer<Type, ValueType>::translate(
-                *symbolicModel->template as<storm::models::symbolic::MarkovAutomaton<Type, ValueType>>(), formulas);
+                *symbolicModel->template as<storm::models::symbolic::MarkovAutomaton<Type, ValueType>>(), formulas, stateOrder);
         default:
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
                             "Transformation of symbolic " << symbolicModel->getType() << " to sparse model is not supported.");
@@ -412,6 +412,66 @@ std::unique_ptr<storm::modelchecker::CheckResult> computeExpectedVisitingTimesWi
     return result;
 }
 
+template<typename ValueType>
+storm::modelchecker::CheckTask<storm::logic::BoundedUntilFormula, ValueType> getTimeBoundedUntilTask(
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    storm::logic::Formula const& formula = task.getFormula();
+    STORM_LOG_THROW(formula.isProbabilityOperatorFormula() && formula.asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula(),
+                    storm::exceptions::NotSupportedException, "Computing values for multiple time points requires a formula of the form P=? [phi U<=t psi].");
+    return task.substituteFormula(formula.asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula());
+}
+
+template<typename ValueType>
+std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngineForTimePoints(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& timePoints) {
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+    return modelchecker.computeBoundedUntilProbabilitiesForTimePoints(env, getTimeBoundedUntilTask(task), timePoints);
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>>::type
+verifyWithSparseEngineForTimePoints(storm::Environment const& env, std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> const& ma,
+                                    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& timePoints) {
+    // Close the MA, if it is not already closed.
+    if (!ma->isClosed()) {
+        STORM_LOG_WARN("Closing Markov automaton. Consider closing the MA before verification.");
+        ma->close();
+    }
+
+    storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<ValueType>> modelchecker(*ma);
+    return modelchecker.computeBoundedUntilProbabilitiesForTimePoints(env, getTimeBoundedUntilTask(task), timePoints);
+}
+
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>>::type
+verifyWithSparseEngineForTimePoints(storm::Environment const&, std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> const&,
+                                    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&, std::vector<double> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sparse engine cannot verify MAs with this data type.");
+}
+
+/*!
+ * Computes the values of the given time-bounded until property for each of the given time points in a single pass over the time horizon.
+ * The upper time bound of the property is replaced by the respective time point.
+ *
+ * @return For each time point, the result of the property.
+ */
+template<typename ValueType>
+std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngineForTimePoints(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& timePoints) {
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> result;
+    if (model->getType() == storm::models::ModelType::Ctmc) {
+        result = verifyWithSparseEngineForTimePoints(env, model->template as<storm::models::sparse::Ctmc<ValueType>>(), task, timePoints);
+    } else if (model->getType() == storm::models::ModelType::MarkovAutomaton) {
+        result = verifyWithSparseEngineForTimePoints(env, model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>(), task, timePoints);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "Computing values for multiple time points for the model type " << model->getType() << " is not supported.");
+    }
+    return result;
+}
+
 //
 // Verifying with Hybrid engine
 //
@@ -4,6 +4,8 @@
 
 #include <boost/algorithm/string/join.hpp>
 
+#include "storm/builder/DdVariableOrdering.h"
+
 #include "storm/logic/Formulas.h"
 
 #include "storm/storage/jani/Automaton.h"
@@ -298,8 +300,9 @@ struct CompositionVariables {
 template<storm::dd::DdType Type, typename ValueType>
 class CompositionVariableCreator : public storm::jani::CompositionVisitor {
    public:
-    CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation)
-        : model(model), automata(), actionInformation(actionInformation) {
+    CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation,
+                               storm::builder::DdVariableOrderingHeuristic const& variableOrderingHeuristic)
+        : model(model), automata(), actionInformation(actionInformation), variableOrderingHeuristic(variableOrderingHeuristic) {
         // Intentionally left empty.
     }
 
@@ -376,13 +379,16 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
             result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
         }
 
+        // Create the meta variables for the locations and the non-transient variables in the order given by the chosen heuristic.
+        std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> variableToMetaVariablesMap =
+            createMetaVariables(result);
+
         for (auto const& automatonName : this->automata) {
             storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
 
             // Start by creating a meta variable for the location of the automaton.
             storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = variableToMetaVariablesMap.at(locationExpressionVariable);
             result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
             result.rowColumnMetaVariablePairs.push_back(variablePair);
 
@@ -406,7 +412,7 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
                 continue;
             }
 
-            createVariable(variable, result);
+            createVariable(variable, variableToMetaVariablesMap.at(variable.getExpressionVariable()), result);
             globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
         }
         result.globalVariableRanges = globalVariableRanges.template toAdd<ValueType>();
@@ -430,7 +436,7 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
                     continue;
                 }
 
-                createVariable(variable, result);
+                createVariable(variable, variableToMetaVariablesMap.at(variable.getExpressionVariable()), result);
                 identity &= result.variableToIdentityMap.at(variable.getExpressionVariable()).toBdd();
                 range &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
             }
@@ -448,29 +454,72 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         return result;
     }
 
-    void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
+    // Creates the row and column meta variables of the locations of the automata in the composition and of all non-transient variables.
+    // The variables are created in the order determined by the variable ordering heuristic, so they appear in this order in the DDs.
+    std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> createMetaVariables(
+        CompositionVariables<Type, ValueType>& result) {
+        std::map<storm::expressions::Variable, storm::jani::Automaton const*> locationVariableToAutomatonMap;
+        std::map<storm::expressions::Variable, storm::jani::Variable const*> expressionVariableToVariableMap;
+        for (auto const& automatonName : this->automata) {
+            storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+            locationVariableToAutomatonMap.emplace(automaton.getLocationExpressionVariable(), &automaton);
+        }
+        for (auto const& variable : this->model.getGlobalVariables()) {
+            expressionVariableToVariableMap.emplace(variable.getExpressionVariable(), &variable);
+        }
+        for (auto const& automaton : this->model.getAutomata()) {
+            for (auto const& variable : automaton.getVariables()) {
+                expressionVariableToVariableMap.emplace(variable.getExpressionVariable(), &variable);
+            }
+        }
+
+        std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> variableToMetaVariablesMap;
+        for (auto const& variable : storm::builder::computeDdVariableOrder(this->model, this->automata, variableOrderingHeuristic)) {
+            auto automatonIt = locationVariableToAutomatonMap.find(variable);
+            if (automatonIt != locationVariableToAutomatonMap.end()) {
+                storm::jani::Automaton const& automaton = *automatonIt->second;
+                variableToMetaVariablesMap.emplace(variable,
+                                                   result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1));
+            } else {
+                variableToMetaVariablesMap.emplace(variable, createMetaVariables(*expressionVariableToVariableMap.at(variable), result));
+            }
+        }
+        return variableToMetaVariablesMap;
+    }
+
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> createMetaVariables(storm::jani::Variable const& variable,
+                                                                                              CompositionVariables<Type, ValueType>& result) {
+        auto const& type = variable.getType();
+        if (type.isBasicType() && type.asBasicType().isBooleanType()) {
+            return result.manager->addMetaVariable(variable.getExpressionVariable().getName());
+        } else if (type.isBoundedType() && type.asBoundedType().isIntegerType()) {
+            auto const& boundedType = type.asBoundedType();
+            STORM_LOG_THROW(boundedType.hasLowerBound(), storm::exceptions::NotSupportedException,
+                            "DdJaniModelBuilder only supports bounded variables. Variable " << variable.getName() << " has no lower bound.");
+            STORM_LOG_THROW(boundedType.hasUpperBound(), storm::exceptions::NotSupportedException,
+                            "DdJaniModelBuilder only supports bounded variables. Variable " << variable.getName() << " has no upper bound.");
+            int_fast64_t low = boundedType.getLowerBound().evaluateAsInt();
+            int_fast64_t high = boundedType.getUpperBound().evaluateAsInt();
+            return result.manager->addMetaVariable(variable.getExpressionVariable().getName(), low, high);
+        }
+        STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Invalid type of variable in JANI model.");
+    }
+
+    void createVariable(storm::jani::Variable const& variable, std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair,
+                        CompositionVariables<Type, ValueType>& result) {
         auto const& type = variable.getType();
         if (type.isBasicType() && type.asBasicType().isBooleanType()) {
-            createBooleanVariable(variable, result);
+            createBooleanVariable(variable, variablePair, result);
         } else if (type.isBoundedType() && type.asBoundedType().isIntegerType()) {
-            createBoundedIntegerVariable(variable, result);
+            createBoundedIntegerVariable(variable, variablePair, result);
         } else {
             STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Invalid type of variable in JANI model.");
         }
     }
 
-    void createBoundedIntegerVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
-        auto const& type = variable.getType().asBoundedType();
-        STORM_LOG_THROW(type.hasLowerBound(), storm::exceptions::NotSupportedException,
-                        "DdJaniModelBuilder only supports bounded variables. Variable " << variable.getName() << " has no lower bound.");
-        STORM_LOG_THROW(type.hasUpperBound(), storm::exceptions::NotSupportedException,
-                        "DdJaniModelBuilder only supports bounded variables. Variable " << variable.getName() << " has no upper bound.");
-        int_fast64_t low = type.getLowerBound().evaluateAsInt();
-        int_fast64_t high = type.getUpperBound().evaluateAsInt();
-
-        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-            result.manager->addMetaVariable(variable.getExpressionVariable().getName(), low, high);
-
+    void createBoundedIntegerVariable(storm::jani::Variable const& variable,
+                                      std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair,
+                                      CompositionVariables<Type, ValueType>& result) {
         STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << " and " << variablePair.second.getName()
                                                                                << ".");
 
@@ -489,10 +538,8 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         result.allGlobalVariables.insert(variable.getExpressionVariable());
     }
 
-    void createBooleanVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
-        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-            result.manager->addMetaVariable(variable.getExpressionVariable().getName());
-
+    void createBooleanVariable(storm::jani::Variable const& variable, std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair,
+                               CompositionVariables<Type, ValueType>& result) {
         STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << " and " << variablePair.second.getName()
                                                                                << ".");
 
@@ -515,6 +562,7 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
     storm::jani::Model const& model;
     std::set<std::string> automata;
     storm::jani::CompositionInformation actionInformation;
+    storm::builder::DdVariableOrderingHeuristic variableOrderingHeuristic;
 };
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -2386,7 +2434,10 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdJaniModelBuil
     storm::jani::CompositionInformation actionInformation = visitor.getInformation();
 
     // Create all necessary variables.
-    CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation);
+    storm::builder::DdVariableOrderingHeuristic variableOrderingHeuristic =
+        options.variableOrderingHeuristic ? options.variableOrderingHeuristic.get()
+                                          : storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrderingHeuristic();
+    CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation, variableOrderingHeuristic);
     CompositionVariables<Type, ValueType> variables = variableCreator.create();
 
     // Determine which transient assignments need to be considered in the building process.
@@ -2396,6 +2447,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdJaniModelBuil
     bool applyMaximumProgress = options.applyMaximumProgressAssumption && model.getModelType() == storm::jani::ModelType::MA;
     CombinedEdgesSystemComposer<Type, ValueType> composer(preparedModel, actionInformation, variables, rewardVariables, applyMaximumProgress);
     ComposerResult<Type, ValueType> system = composer.compose();
+    variables.manager->finishPhase("composition");
 
     // Postprocess the variables in place.
     postprocessVariables(preparedModel.getModelType(), system, variables);
@@ -2421,9 +2473,29 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdJaniModelBuil
         preparedModel.getModelType() == storm::jani::ModelType::MA) {
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(variables.allNondeterminismVariables);
     }
-    modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables,
-                                                                                 variables.columnMetaVariables)
-                                          .first;
+    storm::builder::DdReachabilityMethod reachabilityMethod =
+        options.reachabilityMethod ? options.reachabilityMethod.get()
+                                   : storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdReachabilityMethod();
+    if (reachabilityMethod == storm::builder::DdReachabilityMethod::Bfs) {
+        modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd,
+                                                                                     variables.rowMetaVariables, variables.columnMetaVariables)
+                                              .first;
+    } else {
+        // Partition the transition relation along the variables encoding the nondeterminism (in particular the actions). For deterministic models, the
+        // relation is not split, but variables untouched by all transitions are still removed from it.
+        std::vector<storm::dd::Bdd<Type>> relations;
+        if (variables.allNondeterminismVariables.empty()) {
+            relations.push_back(transitionMatrixBdd);
+        } else {
+            uint64_t const maximalNumberOfParts = 64;
+            relations = storm::utility::dd::splitTransitionRelation(system.transitions.notZero(), variables.allNondeterminismVariables, maximalNumberOfParts);
+        }
+        modelComponents.reachableStates =
+            storm::utility::dd::computeReachableStates(
+                modelComponents.initialStates, storm::utility::dd::createTransitionRelationPartitions(relations, variables.rowColumnMetaVariablePairs),
+                reachabilityMethod)
+                .first;
+    }
 
     // Check that the reachable fragment does not overlap with the illegal fragment.
     storm::dd::Bdd<Type> reachableIllegalFragment = modelComponents.reachableStates && system.illegalFragment;
@@ -2433,6 +2505,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdJaniModelBuil
     // Cut transitions to reachable states.
     storm::dd::Add<Type, ValueType> reachableStatesAdd = modelComponents.reachableStates.template toAdd<ValueType>();
     modelComponents.transitionMatrix = system.transitions * reachableStatesAdd;
+    variables.manager->finishPhase("reachability");
 
     // Fix deadlocks if existing.
     modelComponents.deadlockStates =
@@ -2444,6 +2517,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdJaniModelBuil
     // Build the reward models.
     modelComponents.rewardModels =
         buildRewardModels(reachableStatesAdd, modelComponents.transitionMatrix, preparedModel.getModelType(), variables, system, rewardVariables);
+    variables.manager->finishPhase("rewards");
 
     // Finally, create the model.
     return createModel(preparedModel.getModelType(), variables, modelComponents);
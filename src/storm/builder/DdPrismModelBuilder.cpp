@@ -2,6 +2,8 @@
 
 #include <boost/algorithm/string/join.hpp>
 
+#include "storm/builder/DdVariableOrdering.h"
+
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
@@ -93,8 +95,9 @@ class ParameterCreator<Type, storm::RationalFunction> {
 template<storm::dd::DdType Type, typename ValueType>
 class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
    public:
-    GenerationInformation(storm::prism::Program const& program)
+    GenerationInformation(storm::prism::Program const& program, storm::builder::DdVariableOrderingHeuristic const& variableOrderingHeuristic)
         : program(program),
+          variableOrderingHeuristic(variableOrderingHeuristic),
           manager(std::make_shared<storm::dd::DdManager<Type>>()),
           rowMetaVariables(),
           variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()),
@@ -121,6 +124,9 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
     // The program that is currently translated.
     storm::prism::Program const& program;
 
+    // The heuristic used to order the DD variables.
+    storm::builder::DdVariableOrderingHeuristic variableOrderingHeuristic;
+
     // The manager used to build the decision diagrams.
     std::shared_ptr<storm::dd::DdManager<Type>> manager;
 
@@ -164,6 +170,9 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
     // The parameters appearing in the model.
     std::set<storm::RationalFunctionVariable> parameters;
 
+    // The transitions of the independent actions of the individual modules (before they are composed).
+    std::vector<storm::dd::Add<Type, ValueType>> moduleIndependentActionTransitions;
+
    private:
     /*!
      * Creates the required meta variables and variable/module identities.
@@ -188,11 +197,14 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             allNondeterminismVariables.insert(variablePair.first);
         }
 
+        // Create the meta variables for all program variables in the order given by the chosen heuristic.
+        std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> variableToMetaVariablesMap =
+            createProgramMetaVariables();
+
         // Create meta variables for global program variables.
         for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-            int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-            int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
+                variableToMetaVariablesMap.at(integerVariable.getExpressionVariable());
 
             STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
                                                                                    << "] and " << variablePair.second.getName() << "["
@@ -211,7 +223,8 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             allGlobalVariables.insert(integerVariable.getExpressionVariable());
         }
         for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
+                variableToMetaVariablesMap.at(booleanVariable.getExpressionVariable());
 
             STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
                                                                                    << "] and " << variablePair.second.getName() << "["
@@ -236,10 +249,8 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
 
             for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
                 std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                    manager->addMetaVariable(integerVariable.getName(), low, high);
+                    variableToMetaVariablesMap.at(integerVariable.getExpressionVariable());
                 STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
                                                                                 << "] and " << variablePair.second.getName() << "["
                                                                                 << variablePair.second.getIndex() << "]");
@@ -258,7 +269,8 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
                 rowColumnMetaVariablePairs.push_back(variablePair);
             }
             for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
+                    variableToMetaVariablesMap.at(booleanVariable.getExpressionVariable());
                 STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
                                                                                 << "] and " << variablePair.second.getName() << "["
                                                                                 << variablePair.second.getIndex() << "]");
@@ -280,6 +292,37 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
         }
     }
+
+    /*!
+     * Creates the row and column meta variables of all program variables. The variables are created in the order
+     * determined by the variable ordering heuristic, so they appear in this order in the DDs.
+     */
+    std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> createProgramMetaVariables() {
+        std::map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> integerVariableToBoundsMap;
+        for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
+            integerVariableToBoundsMap.emplace(integerVariable.getExpressionVariable(),
+                                               std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(),
+                                                              integerVariable.getUpperBoundExpression().evaluateAsInt()));
+        }
+        for (storm::prism::Module const& module : program.getModules()) {
+            for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                integerVariableToBoundsMap.emplace(integerVariable.getExpressionVariable(),
+                                                   std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(),
+                                                                  integerVariable.getUpperBoundExpression().evaluateAsInt()));
+            }
+        }
+
+        std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> result;
+        for (auto const& variable : storm::builder::computeDdVariableOrder(program, variableOrderingHeuristic)) {
+            auto boundsIt = integerVariableToBoundsMap.find(variable);
+            if (boundsIt != integerVariableToBoundsMap.end()) {
+                result.emplace(variable, manager->addMetaVariable(variable.getName(), boundsIt->second.first, boundsIt->second.second));
+            } else {
+                result.emplace(variable, manager->addMetaVariable(variable.getName()));
+            }
+        }
+        return result;
+    }
 };
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -317,6 +360,7 @@ class ModuleComposer : public storm::prism::CompositionVisitor {
 
         typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram result = DdPrismModelBuilder<Type, ValueType>::createModuleDecisionDiagram(
             generationInfo, generationInfo.program.getModule(composition.getModuleName()), synchronizingActionToOffsetMap);
+        generationInfo.moduleIndependentActionTransitions.push_back(result.independentAction.transitionsDd);
 
         return result;
     }
@@ -1442,10 +1486,14 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
 
     // Start by initializing the structure used for storing all information needed during the model generation.
     // In particular, this creates the meta variables used to encode the model.
-    GenerationInformation generationInfo(program);
+    storm::builder::DdVariableOrderingHeuristic variableOrderingHeuristic =
+        options.variableOrderingHeuristic ? options.variableOrderingHeuristic.get()
+                                          : storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrderingHeuristic();
+    GenerationInformation generationInfo(program, variableOrderingHeuristic);
 
     SystemResult system = createSystemDecisionDiagram(generationInfo);
     storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
+    generationInfo.manager->finishPhase("composition");
 
     ModuleDecisionDiagram const& globalModule = system.globalModule;
 
@@ -1475,14 +1523,45 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
     }
 
-    storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
-                                                                                            generationInfo.columnMetaVariables)
-                                               .first;
+    storm::builder::DdReachabilityMethod reachabilityMethod =
+        options.reachabilityMethod ? options.reachabilityMethod.get()
+                                   : storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdReachabilityMethod();
+    storm::dd::Bdd<Type> reachableStates;
+    if (reachabilityMethod == storm::builder::DdReachabilityMethod::Bfs) {
+        reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
+                                                                           generationInfo.columnMetaVariables)
+                              .first;
+    } else {
+        // Partition the transition relation. Without a custom system composition, the independent actions of the modules are interleaved, so we can
+        // consider them separately. Otherwise, we take the independent action of the composed system as a whole.
+        std::vector<storm::dd::Bdd<Type>> relations;
+        if (program.specifiesSystemComposition()) {
+            relations.push_back(globalModule.independentAction.transitionsDd.notZero());
+        } else {
+            for (auto const& moduleTransitions : generationInfo.moduleIndependentActionTransitions) {
+                relations.push_back(moduleTransitions.notZero());
+            }
+        }
+        for (auto const& synchronizingAction : globalModule.synchronizingActionToDecisionDiagramMap) {
+            relations.push_back(synchronizingAction.second.transitionsDd.notZero());
+        }
+        for (auto& relation : relations) {
+            relation &= !terminalStatesBdd;
+            if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
+                relation = relation.existsAbstract(generationInfo.allNondeterminismVariables);
+            }
+        }
+        reachableStates = storm::utility::dd::computeReachableStates<Type>(
+                              initialStates, storm::utility::dd::createTransitionRelationPartitions(relations, generationInfo.rowColumnMetaVariablePairs),
+                              reachabilityMethod)
+                              .first;
+    }
     storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
     transitionMatrix *= reachableStatesAdd;
     if (system.stateActionDd) {
         system.stateActionDd.get() *= reachableStatesAdd;
     }
+    generationInfo.manager->finishPhase("reachability");
 
     // Detect deadlocks and 1) fix them if requested 2) throw an error otherwise.
     storm::dd::Bdd<Type> statesWithTransition = transitionMatrixBdd.existsAbstract(generationInfo.columnMetaVariables);
@@ -1556,6 +1635,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
 
     std::unordered_map<std::string, storm::models::symbolic::StandardRewardModel<Type, ValueType>> rewardModels =
         createRewardModelDecisionDiagrams(selectedRewardModels, system, generationInfo, globalModule, reachableStatesAdd, transitionMatrix);
+    generationInfo.manager->finishPhase("rewards");
 
     // Build the labels that can be accessed as a shortcut.
     std::map<std::string, storm::expressions::Expression> labelToExpressionMapping;
@@ -7,6 +7,8 @@
 
 #include "storm/storage/prism/Program.h"
 
+#include "storm/builder/DdReachabilityMethod.h"
+#include "storm/builder/DdVariableOrderingHeuristic.h"
 #include "storm/builder/TerminalStatesGetter.h"
 
 #include "storm/adapters/AddExpressionAdapter.h"
@@ -94,6 +96,12 @@ class DdPrismModelBuilder {
         // An optional set of expression or labels that characterizes (a subset of) the terminal states of the model.
         // If this is set, the outgoing transitions of these states are replaced with a self-loop.
         storm::builder::TerminalStates terminalStates;
+
+        // An optional heuristic for the order of the DD variables. If it is not given, the heuristic is taken from the settings.
+        boost::optional<storm::builder::DdVariableOrderingHeuristic> variableOrderingHeuristic;
+
+        // An optional method to compute the reachable states. If it is not given, the method is taken from the settings.
+        boost::optional<storm::builder::DdReachabilityMethod> reachabilityMethod;
     };
 
     /*!
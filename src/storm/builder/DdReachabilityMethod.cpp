@@ -0,0 +1,25 @@
+#include "storm/builder/DdReachabilityMethod.h"
+
+namespace storm {
+namespace builder {
+
+std::ostream& operator<<(std::ostream& out, DdReachabilityMethod const& method) {
+    switch (method) {
+        case DdReachabilityMethod::Bfs:
+            out << "breadth-first";
+            break;
+        case DdReachabilityMethod::Chaining:
+            out << "chaining";
+            break;
+        case DdReachabilityMethod::ChainingWithRestart:
+            out << "chaining with restart";
+            break;
+        default:
+            out << "undefined";
+            break;
+    }
+    return out;
+}
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <ostream>
+
+namespace storm {
+namespace builder {
+
+// An enum that contains all methods to compute the reachable states of symbolically represented models.
+enum class DdReachabilityMethod { Bfs, Chaining, ChainingWithRestart };
+
+std::ostream& operator<<(std::ostream& out, DdReachabilityMethod const& method);
+
+}  // namespace builder
+}  // namespace storm
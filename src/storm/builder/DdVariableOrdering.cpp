@@ -0,0 +1,230 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+#include "storm/storage/jani/Automaton.h"
+#include "storm/storage/jani/Edge.h"
+#include "storm/storage/jani/EdgeDestination.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace {
+// The maximal number of iterations of the FORCE heuristic.
+const uint64_t maximalNumberOfForceIterations = 100;
+
+uint64_t computeTotalSpan(std::vector<uint64_t> const& positions, std::vector<std::vector<uint64_t>> const& hyperedges) {
+    uint64_t result = 0;
+    for (auto const& hyperedge : hyperedges) {
+        uint64_t minimalPosition = positions[hyperedge.front()];
+        uint64_t maximalPosition = minimalPosition;
+        for (auto const& variable : hyperedge) {
+            minimalPosition = std::min(minimalPosition, positions[variable]);
+            maximalPosition = std::max(maximalPosition, positions[variable]);
+        }
+        result += maximalPosition - minimalPosition;
+    }
+    return result;
+}
+
+void addVariables(std::set<storm::expressions::Variable>& hyperedge, storm::expressions::Expression const& expression) {
+    if (expression.isInitialized()) {
+        std::set<storm::expressions::Variable> variables = expression.getVariables();
+        hyperedge.insert(variables.begin(), variables.end());
+    }
+}
+}  // namespace
+
+std::vector<storm::expressions::Variable> computeDdVariableOrder(std::vector<storm::expressions::Variable> const& variables,
+                                                                 std::vector<std::set<storm::expressions::Variable>> const& hyperedges,
+                                                                 DdVariableOrderingHeuristic const& heuristic) {
+    if (heuristic == DdVariableOrderingHeuristic::Declaration || variables.size() <= 2) {
+        return variables;
+    }
+
+    std::map<storm::expressions::Variable, uint64_t> variableToIndex;
+    for (uint64_t index = 0; index < variables.size(); ++index) {
+        variableToIndex[variables[index]] = index;
+    }
+
+    // Translate the hyperedges to variable indices. Other variables (e.g. transient ones) are dropped, because they
+    // are not ordered, and so are hyperedges with a single variable, because they do not impose any constraint.
+    std::vector<std::vector<uint64_t>> indexHyperedges;
+    std::vector<std::vector<uint64_t>> variableToHyperedges(variables.size());
+    for (auto const& hyperedge : hyperedges) {
+        std::vector<uint64_t> indexHyperedge;
+        for (auto const& variable : hyperedge) {
+            auto it = variableToIndex.find(variable);
+            if (it != variableToIndex.end()) {
+                indexHyperedge.push_back(it->second);
+            }
+        }
+        if (indexHyperedge.size() > 1) {
+            for (auto const& index : indexHyperedge) {
+                variableToHyperedges[index].push_back(indexHyperedges.size());
+            }
+            indexHyperedges.push_back(std::move(indexHyperedge));
+        }
+    }
+
+    // The order lists the variable indices and the positions map the variable indices to their position in the order.
+    std::vector<uint64_t> order(variables.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<uint64_t> positions = order;
+    std::vector<uint64_t> bestOrder = order;
+    uint64_t initialSpan = computeTotalSpan(positions, indexHyperedges);
+    uint64_t bestSpan = initialSpan;
+
+    std::vector<double> centersOfGravity(indexHyperedges.size());
+    std::vector<double> newPositions(variables.size());
+    for (uint64_t iteration = 0; iteration < maximalNumberOfForceIterations && bestSpan > 0; ++iteration) {
+        for (uint64_t hyperedge = 0; hyperedge < indexHyperedges.size(); ++hyperedge) {
+            double sum = 0;
+            for (auto const& variable : indexHyperedges[hyperedge]) {
+                sum += positions[variable];
+            }
+            centersOfGravity[hyperedge] = sum / indexHyperedges[hyperedge].size();
+        }
+        for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+            if (variableToHyperedges[variable].empty()) {
+                newPositions[variable] = positions[variable];
+            } else {
+                double sum = 0;
+                for (auto const& hyperedge : variableToHyperedges[variable]) {
+                    sum += centersOfGravity[hyperedge];
+                }
+                newPositions[variable] = sum / variableToHyperedges[variable].size();
+            }
+        }
+
+        // Ties are broken by the current position, so the order is only changed where the heuristic demands it.
+        std::sort(order.begin(), order.end(), [&newPositions, &positions](uint64_t const& first, uint64_t const& second) {
+            return newPositions[first] < newPositions[second] || (newPositions[first] == newPositions[second] && positions[first] < positions[second]);
+        });
+        for (uint64_t position = 0; position < order.size(); ++position) {
+            positions[order[position]] = position;
+        }
+
+        uint64_t span = computeTotalSpan(positions, indexHyperedges);
+        if (span >= bestSpan) {
+            break;
+        }
+        bestSpan = span;
+        bestOrder = order;
+    }
+    STORM_LOG_DEBUG("Static variable ordering reduced the total span of the variable interactions from " << initialSpan << " to " << bestSpan << ".");
+
+    std::vector<storm::expressions::Variable> result;
+    result.reserve(variables.size());
+    for (auto const& index : bestOrder) {
+        result.push_back(variables[index]);
+    }
+    return result;
+}
+
+std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::prism::Program const& program, DdVariableOrderingHeuristic const& heuristic) {
+    std::vector<storm::expressions::Variable> variables;
+    for (auto const& variable : program.getGlobalIntegerVariables()) {
+        variables.push_back(variable.getExpressionVariable());
+    }
+    for (auto const& variable : program.getGlobalBooleanVariables()) {
+        variables.push_back(variable.getExpressionVariable());
+    }
+    for (auto const& module : program.getModules()) {
+        for (auto const& variable : module.getIntegerVariables()) {
+            variables.push_back(variable.getExpressionVariable());
+        }
+        for (auto const& variable : module.getBooleanVariables()) {
+            variables.push_back(variable.getExpressionVariable());
+        }
+    }
+
+    if (heuristic == DdVariableOrderingHeuristic::Declaration) {
+        return variables;
+    }
+
+    std::vector<std::set<storm::expressions::Variable>> hyperedges;
+    std::map<uint64_t, std::set<storm::expressions::Variable>> actionIndexToVariables;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            std::set<storm::expressions::Variable> hyperedge;
+            addVariables(hyperedge, command.getGuardExpression());
+            for (auto const& update : command.getUpdates()) {
+                addVariables(hyperedge, update.getLikelihoodExpression());
+                for (auto const& assignment : update.getAssignments()) {
+                    hyperedge.insert(assignment.getVariable());
+                    addVariables(hyperedge, assignment.getExpression());
+                }
+            }
+
+            if (command.isLabeled()) {
+                actionIndexToVariables[command.getActionIndex()].insert(hyperedge.begin(), hyperedge.end());
+            }
+            hyperedges.push_back(std::move(hyperedge));
+        }
+    }
+    for (auto& actionVariables : actionIndexToVariables) {
+        hyperedges.push_back(std::move(actionVariables.second));
+    }
+
+    return computeDdVariableOrder(variables, hyperedges, heuristic);
+}
+
+std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::jani::Model const& model, std::set<std::string> const& automata,
+                                                                 DdVariableOrderingHeuristic const& heuristic) {
+    std::vector<storm::expressions::Variable> variables;
+    for (auto const& automatonName : automata) {
+        variables.push_back(model.getAutomaton(automatonName).getLocationExpressionVariable());
+    }
+    for (auto const& variable : model.getGlobalVariables()) {
+        if (!variable.isTransient()) {
+            variables.push_back(variable.getExpressionVariable());
+        }
+    }
+    for (auto const& automaton : model.getAutomata()) {
+        for (auto const& variable : automaton.getVariables()) {
+            if (!variable.isTransient()) {
+                variables.push_back(variable.getExpressionVariable());
+            }
+        }
+    }
+
+    if (heuristic == DdVariableOrderingHeuristic::Declaration) {
+        return variables;
+    }
+
+    std::vector<std::set<storm::expressions::Variable>> hyperedges;
+    std::map<uint64_t, std::set<storm::expressions::Variable>> actionIndexToVariables;
+    for (auto const& automatonName : automata) {
+        storm::jani::Automaton const& automaton = model.getAutomaton(automatonName);
+        for (auto const& edge : automaton.getEdges()) {
+            std::set<storm::expressions::Variable> hyperedge = {automaton.getLocationExpressionVariable()};
+            addVariables(hyperedge, edge.getGuard());
+            for (auto const& destination : edge.getDestinations()) {
+                addVariables(hyperedge, destination.getProbability());
+                for (auto const& assignment : destination.getOrderedAssignments()) {
+                    hyperedge.insert(assignment.getExpressionVariable());
+                    addVariables(hyperedge, assignment.getAssignedExpression());
+                }
+            }
+
+            if (!edge.hasSilentAction()) {
+                actionIndexToVariables[edge.getActionIndex()].insert(hyperedge.begin(), hyperedge.end());
+            }
+            hyperedges.push_back(std::move(hyperedge));
+        }
+    }
+    for (auto& actionVariables : actionIndexToVariables) {
+        hyperedges.push_back(std::move(actionVariables.second));
+    }
+
+    return computeDdVariableOrder(variables, hyperedges, heuristic);
+}
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "storm/builder/DdVariableOrderingHeuristic.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+
+namespace jani {
+class Model;
+}
+
+namespace builder {
+
+/*!
+ * Computes a static order of the given variables. Variables that interact, i.e. that appear together in one of the
+ * given hyperedges, are placed close to each other by the FORCE heuristic, which iteratively moves every variable
+ * to the average center of gravity of its hyperedges. Among all orders encountered, the one with the minimal total
+ * span of the hyperedges is returned.
+ *
+ * @param variables The variables in their order of declaration.
+ * @param hyperedges The sets of interacting variables.
+ * @param heuristic The heuristic to use.
+ * @return The variables in the order in which the DD variables are to be created.
+ */
+std::vector<storm::expressions::Variable> computeDdVariableOrder(std::vector<storm::expressions::Variable> const& variables,
+                                                                 std::vector<std::set<storm::expressions::Variable>> const& hyperedges,
+                                                                 DdVariableOrderingHeuristic const& heuristic);
+
+/*!
+ * Computes a static order of the (global and module) variables of the given program. The hyperedges are given by
+ * the commands of the program and by the sets of commands that synchronize on the same action.
+ *
+ * @param program The program whose variables to order.
+ * @param heuristic The heuristic to use.
+ * @return The variables in the order in which the DD variables are to be created.
+ */
+std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::prism::Program const& program, DdVariableOrderingHeuristic const& heuristic);
+
+/*!
+ * Computes a static order of the non-transient variables of the given model and the location variables of the given
+ * automata. The declaration order lists the locations of the given automata (in the given order), then the global
+ * and then the local variables. The hyperedges are given by the edges of the given automata and by the sets of edges
+ * that synchronize on the same action.
+ *
+ * @param model The model whose variables to order.
+ * @param automata The names of the automata that appear in the system composition.
+ * @param heuristic The heuristic to use.
+ * @return The variables in the order in which the DD variables are to be created.
+ */
+std::vector<storm::expressions::Variable> computeDdVariableOrder(storm::jani::Model const& model, std::set<std::string> const& automata,
+                                                                 DdVariableOrderingHeuristic const& heuristic);
+
+}  // namespace builder
+}  // namespace storm
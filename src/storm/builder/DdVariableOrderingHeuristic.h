@@ -0,0 +1,14 @@
+#pragma once
+
+#include <ostream>
+
+namespace storm {
+namespace builder {
+
+// An enum that contains all heuristics to statically order the variables of symbolically represented models.
+enum class DdVariableOrderingHeuristic { Declaration, Force };
+
+std::ostream& operator<<(std::ostream& out, DdVariableOrderingHeuristic const& heuristic);
+
+}  // namespace builder
+}  // namespace storm
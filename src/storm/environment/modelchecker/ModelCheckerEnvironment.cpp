@@ -16,6 +16,7 @@ ModelCheckerEnvironment::ModelCheckerEnvironment() {
     if (mcSettings.isLtl2daToolSet()) {
         ltl2daTool = mcSettings.getLtl2daTool();
     }
+    hybridSccDecomposition = mcSettings.isHybridSccDecompositionSet();
 }
 
 ModelCheckerEnvironment::~ModelCheckerEnvironment() {
@@ -46,4 +47,12 @@ void ModelCheckerEnvironment::unsetLtl2daTool() {
     ltl2daTool = boost::none;
 }
 
+bool ModelCheckerEnvironment::isHybridSccDecompositionSet() const {
+    return hybridSccDecomposition;
+}
+
+void ModelCheckerEnvironment::setHybridSccDecomposition(bool value) {
+    hybridSccDecomposition = value;
+}
+
 }  // namespace storm
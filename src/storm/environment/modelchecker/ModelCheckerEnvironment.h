@@ -25,8 +25,12 @@ class ModelCheckerEnvironment {
     void setLtl2daTool(std::string const& value);
     void unsetLtl2daTool();
 
+    bool isHybridSccDecompositionSet() const;
+    void setHybridSccDecomposition(bool value);
+
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
+    bool hybridSccDecomposition;
 };
 }  // namespace storm
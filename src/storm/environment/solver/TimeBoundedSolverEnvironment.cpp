@@ -5,6 +5,8 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
+
 namespace storm {
 
 TimeBoundedSolverEnvironment::TimeBoundedSolverEnvironment() {
@@ -14,6 +16,10 @@ TimeBoundedSolverEnvironment::TimeBoundedSolverEnvironment() {
     precision = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getPrecision());
     relative = tbSettings.isRelativePrecision();
     unifPlusKappa = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getUnifPlusKappa());
+    ctmcMethod = tbSettings.getCtmcMethod();
+    adaptiveUniformizationSteps = tbSettings.getAdaptiveUniformizationSteps();
+    steadyStateDetection = tbSettings.isSteadyStateDetectionSet();
+    restrictToActiveSupport = tbSettings.isRestrictToActiveSupportSet();
 }
 
 TimeBoundedSolverEnvironment::~TimeBoundedSolverEnvironment() {
@@ -57,4 +63,37 @@ void TimeBoundedSolverEnvironment::setUnifPlusKappa(storm::RationalNumber value)
     unifPlusKappa = value;
 }
 
+storm::solver::CtmcTransientMethod const& TimeBoundedSolverEnvironment::getCtmcMethod() const {
+    return ctmcMethod;
+}
+
+void TimeBoundedSolverEnvironment::setCtmcMethod(storm::solver::CtmcTransientMethod value) {
+    ctmcMethod = value;
+}
+
+uint64_t const& TimeBoundedSolverEnvironment::getAdaptiveUniformizationSteps() const {
+    return adaptiveUniformizationSteps;
+}
+
+void TimeBoundedSolverEnvironment::setAdaptiveUniformizationSteps(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "Adaptive uniformization requires at least one time step.");
+    adaptiveUniformizationSteps = value;
+}
+
+bool TimeBoundedSolverEnvironment::isSteadyStateDetectionSet() const {
+    return steadyStateDetection;
+}
+
+void TimeBoundedSolverEnvironment::setSteadyStateDetection(bool value) {
+    steadyStateDetection = value;
+}
+
+bool TimeBoundedSolverEnvironment::isRestrictToActiveSupportSet() const {
+    return restrictToActiveSupport;
+}
+
+void TimeBoundedSolverEnvironment::setRestrictToActiveSupport(bool value) {
+    restrictToActiveSupport = value;
+}
+
 }  // namespace storm
@@ -22,6 +22,15 @@ class TimeBoundedSolverEnvironment {
     storm::RationalNumber const& getUnifPlusKappa() const;
     void setUnifPlusKappa(storm::RationalNumber value);
 
+    storm::solver::CtmcTransientMethod const& getCtmcMethod() const;
+    void setCtmcMethod(storm::solver::CtmcTransientMethod value);
+    uint64_t const& getAdaptiveUniformizationSteps() const;
+    void setAdaptiveUniformizationSteps(uint64_t value);
+    bool isSteadyStateDetectionSet() const;
+    void setSteadyStateDetection(bool value);
+    bool isRestrictToActiveSupportSet() const;
+    void setRestrictToActiveSupport(bool value);
+
    private:
     storm::solver::MaBoundedReachabilityMethod maMethod;
     bool maMethodSetFromDefault;
@@ -30,5 +39,10 @@ class TimeBoundedSolverEnvironment {
     bool relative;
 
     storm::RationalNumber unifPlusKappa;
+
+    storm::solver::CtmcTransientMethod ctmcMethod;
+    uint64_t adaptiveUniformizationSteps;
+    bool steadyStateDetection;
+    bool restrictToActiveSupport;
 };
 }  // namespace storm
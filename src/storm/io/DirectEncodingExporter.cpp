@@ -1,7 +1,12 @@
 #include "storm/io/DirectEncodingExporter.h"
 #include <storm/exceptions/NotSupportedException.h>
 
+#include <array>
+#include <charconv>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
@@ -68,10 +73,60 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
     os << "@nr_choices\n" << sparseModel->getNumberOfChoices() << '\n';
     os << "@model\n";
 
-    storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
+    // The states are formatted in chunks which are then written to the output stream as a whole.
+    STORM_LOG_THROW(options.statesPerChunk > 0, storm::exceptions::InvalidArgumentException, "The number of states per chunk must be positive.");
+    uint64_t const numberOfStates = sparseModel->getNumberOfStates();
+    uint64_t const numberOfChunks = (numberOfStates + options.statesPerChunk - 1) / options.statesPerChunk;
+    auto formatChunk = [&](uint64_t chunk) {
+        std::ostringstream chunkStream;
+        chunkStream.copyfmt(os);
+        uint64_t firstState = chunk * options.statesPerChunk;
+        writeStates(chunkStream, *sparseModel, exitRates, placeholders, firstState, std::min(firstState + options.statesPerChunk, numberOfStates));
+        return chunkStream.str();
+    };
+
+    // Only doubles are formatted in parallel. The output of exact numbers and rational functions is not guaranteed to be thread-safe.
+    bool formatInParallel = options.formatInParallel && std::is_same<ValueType, double>::value;
+#ifdef STORM_HAVE_INTELTBB
+    if (formatInParallel) {
+        // Format a batch of chunks in parallel and write them in order. The batches bound the memory needed for the formatted output.
+        uint64_t const chunksPerBatch = 64;
+        std::vector<std::string> formattedChunks(chunksPerBatch);
+        for (uint64_t batchStart = 0; batchStart < numberOfChunks; batchStart += chunksPerBatch) {
+            uint64_t batchEnd = std::min(batchStart + chunksPerBatch, numberOfChunks);
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(batchStart, batchEnd), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t chunk = range.begin(); chunk < range.end(); ++chunk) {
+                    formattedChunks[chunk - batchStart] = formatChunk(chunk);
+                }
+            });
+            for (uint64_t chunk = batchStart; chunk < batchEnd; ++chunk) {
+                std::string& formattedChunk = formattedChunks[chunk - batchStart];
+                os.write(formattedChunk.data(), formattedChunk.size());
+                formattedChunk.clear();
+            }
+        }
+        return;
+    }
+#else
+    STORM_LOG_WARN_COND(!formatInParallel, "Parallel export of DRN files requires Intel TBB. Falling back to sequential export.");
+#endif
+    for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+        std::string formattedChunk = formatChunk(chunk);
+        os.write(formattedChunk.data(), formattedChunk.size());
+    }
+}
+
+template<typename ValueType>
+void writeStates(std::ostream& os, storm::models::sparse::Model<ValueType> const& sparseModel, std::vector<ValueType> const& exitRates,
+                 std::unordered_map<ValueType, std::string> const& placeholders, uint64_t firstState, uint64_t endState) {
+    storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel.getTransitionMatrix();
+    std::shared_ptr<storm::models::sparse::Pomdp<ValueType> const> pomdp;
+    if (sparseModel.getType() == storm::models::ModelType::Pomdp) {
+        pomdp = sparseModel.template as<storm::models::sparse::Pomdp<ValueType>>();
+    }
 
     // Iterate over states and export state information and outgoing transitions
-    for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
+    for (typename storm::storage::SparseMatrix<ValueType>::index_type group = firstState; group < endState; ++group) {
         os << "state " << group;
 
         // Write exit rates for CTMCs and MAs
@@ -80,13 +135,13 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
             writeValue(os, exitRates.at(group), placeholders);
         }
 
-        if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
-            os << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
+        if (pomdp) {
+            os << " {" << pomdp->getObservation(group) << "}";
         }
 
         // Write state rewards
         bool first = true;
-        for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
+        for (auto const& rewardModelEntry : sparseModel.getRewardModels()) {
             if (first) {
                 os << " [";
                 first = false;
@@ -106,7 +161,7 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
         }
 
         // Write labels. Only labels with a whitespace are put in (double) quotation marks.
-        for (auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
+        for (auto const& label : sparseModel.getStateLabeling().getLabelsOfState(group)) {
             STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
                             "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
             // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
@@ -118,8 +173,8 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
         }
         os << '\n';
         // Write state valuations as comments
-        if (sparseModel->hasStateValuations()) {
-            os << "//" << sparseModel->getStateValuations().getStateInfo(group) << '\n';
+        if (sparseModel.hasStateValuations()) {
+            os << "//" << sparseModel.getStateValuations().getStateInfo(group) << '\n';
         }
 
         // Write probabilities
@@ -129,13 +184,13 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
         // Iterate over all actions
         for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
             // Write choice
-            if (sparseModel->hasChoiceLabeling()) {
+            if (sparseModel.hasChoiceLabeling()) {
                 os << "\taction ";
                 bool lfirst = true;
-                if (sparseModel->getChoiceLabeling().getLabelsOfChoice(row).empty()) {
+                if (sparseModel.getChoiceLabeling().getLabelsOfChoice(row).empty()) {
                     os << "__NOLABEL__";
                 }
-                for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
+                for (auto const& label : sparseModel.getChoiceLabeling().getLabelsOfChoice(row)) {
                     if (!lfirst) {
                         os << "_";
                         lfirst = false;
@@ -148,7 +203,7 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
 
             // Write action rewards
             bool first = true;
-            for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
+            for (auto const& rewardModelEntry : sparseModel.getRewardModels()) {
                 if (first) {
                     os << " [";
                     first = false;
@@ -169,9 +224,8 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
 
             // Write transitions
             for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
-                ValueType prob = it->getValue();
                 os << "\t\t" << it->getColumn() << " : ";
-                writeValue(os, prob, placeholders);
+                writeValue(os, it->getValue(), placeholders);
                 os << '\n';
             }
         }
@@ -253,20 +307,40 @@ std::unordered_map<storm::RationalFunction, std::string> generatePlaceholders(
     return placeholders;
 }
 
-template<typename ValueType>
-void writeValue(std::ostream& os, ValueType value, std::unordered_map<ValueType, std::string> const& placeholders) {
-    if (storm::utility::isConstant(value)) {
-        os << value;
-        return;
+void writeDouble(std::ostream& os, double value) {
+#ifdef __cpp_lib_to_chars
+    // std::to_chars in the general format yields the same output as the stream as long as no other floating-point format is requested.
+    std::ios_base::fmtflags const flags = os.flags();
+    if ((flags & (std::ios_base::floatfield | std::ios_base::showpoint | std::ios_base::showpos | std::ios_base::uppercase)) == std::ios_base::fmtflags()) {
+        std::array<char, 64> buffer;
+        auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, std::chars_format::general, static_cast<int>(os.precision()));
+        if (result.ec == std::errc()) {
+            os.write(buffer.data(), result.ptr - buffer.data());
+            return;
+        }
     }
+#endif
+    os << value;
+}
 
-    // Try to use placeholder
-    auto it = placeholders.find(value);
-    if (it != placeholders.end()) {
-        // Use placeholder
-        os << "$" << it->second;
+template<typename ValueType>
+void writeValue(std::ostream& os, ValueType const& value, std::unordered_map<ValueType, std::string> const& placeholders) {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        writeDouble(os, value);
     } else {
-        os << value;
+        if (storm::utility::isConstant(value)) {
+            os << value;
+            return;
+        }
+
+        // Try to use placeholder
+        auto it = placeholders.find(value);
+        if (it != placeholders.end()) {
+            // Use placeholder
+            os << "$" << it->second;
+        } else {
+            os << value;
+        }
     }
 }
 
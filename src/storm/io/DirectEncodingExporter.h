@@ -10,6 +10,10 @@ namespace exporter {
 
 struct DirectEncodingOptions {
     bool allowPlaceholders = true;
+    // The states are formatted in chunks of the given size which are written to the stream as a whole.
+    uint64_t statesPerChunk = 4096;
+    // If set, multiple chunks are formatted in parallel (requires Intel TBB and double values). The chunks are still written in order.
+    bool formatInParallel = false;
 };
 /*!
  * Exports a sparse model into the explicit DRN format.
@@ -42,6 +46,28 @@ template<typename ValueType>
 std::unordered_map<ValueType, std::string> generatePlaceholders(std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel,
                                                                 std::vector<ValueType> exitRates);
 
+/*!
+ * Write the states in the given range (including their choices and transitions) to the stream.
+ *
+ * @param os Output stream.
+ * @param sparseModel Model.
+ * @param exitRates Exit rates (only for CTMCs and MAs).
+ * @param placeholders Placeholders.
+ * @param firstState The first state to write.
+ * @param endState The state after the last state to write.
+ */
+template<typename ValueType>
+void writeStates(std::ostream& os, storm::models::sparse::Model<ValueType> const& sparseModel, std::vector<ValueType> const& exitRates,
+                 std::unordered_map<ValueType, std::string> const& placeholders, uint64_t firstState, uint64_t endState);
+
+/*!
+ * Write the given double to the stream. If possible, the value is formatted with std::to_chars, which yields the same output as the stream but avoids
+ * its locale handling.
+ * @param os Output stream.
+ * @param value Value.
+ */
+void writeDouble(std::ostream& os, double value);
+
 /*!
  * Write value to stream while using the placeholders.
  * @param os Output stream.
@@ -49,6 +75,6 @@ std::unordered_map<ValueType, std::string> generatePlaceholders(std::shared_ptr<
  * @param placeholders Placeholders.
  */
 template<typename ValueType>
-void writeValue(std::ostream& os, ValueType value, std::unordered_map<ValueType, std::string> const& placeholders);
+void writeValue(std::ostream& os, ValueType const& value, std::unordered_map<ValueType, std::string> const& placeholders);
 }  // namespace exporter
 }  // namespace storm
@@ -1421,6 +1421,13 @@ std::unique_ptr<CheckResult> GameBasedMdpModelChecker<Type, ModelType>::performE
     ExplicitQualitativeGameResultMinMax qualitativeResult =
         computeProb01States(previousResult, odd, player1Direction, transitionMatrix, player1Groups, player1BackwardTransitions, player2BackwardTransitions,
                             constraintStates, targetStates, minStrategyPair, maxStrategyPair);
+    if (this->reuseQualitativeResults) {
+        if (!previousResult) {
+            previousResult = PreviousExplicitResult<ValueType>();
+        }
+        previousResult.get().prob1MaxStates = qualitativeResult.prob1Max.getPlayer1States();
+        previousResult.get().qualitativeOdd = odd;
+    }
     qualitativeWatch.stop();
     totalSolutionWatch.add(qualitativeWatch);
     STORM_LOG_INFO("Qualitative computation completed in " << qualitativeWatch.getTimeInMilliseconds() << "ms.");
@@ -1473,7 +1480,9 @@ std::unique_ptr<CheckResult> GameBasedMdpModelChecker<Type, ModelType>::performE
         storm::utility::Stopwatch quantitativeWatch(true);
         quantitativeResult.setMin(computeQuantitativeResult<ValueType>(env, player1Direction, storm::OptimizationDirection::Minimize, transitionMatrix,
                                                                        player1Groups, qualitativeResult, maybeMin, minStrategyPair, odd, nullptr, nullptr,
-                                                                       this->reuseQuantitativeResults ? previousResult : boost::none));
+                                                                       this->reuseQuantitativeResults && previousResult && previousResult.get().hasValues()
+                                                                           ? previousResult
+                                                                           : boost::none));
 
         // Dispose of previous result as we now reused it.
         if (previousResult) {
@@ -1553,10 +1562,11 @@ std::unique_ptr<CheckResult> GameBasedMdpModelChecker<Type, ModelType>::performE
         STORM_LOG_INFO("Quantitative refinement completed in " << refinementWatch.getTimeInMilliseconds() << "ms.");
 
         if (this->reuseQuantitativeResults) {
-            PreviousExplicitResult<ValueType> nextPreviousResult;
-            nextPreviousResult.values = std::move(quantitativeResult.getMin());
-            nextPreviousResult.odd = odd;
-            previousResult = std::move(nextPreviousResult);
+            if (!previousResult) {
+                previousResult = PreviousExplicitResult<ValueType>();
+            }
+            previousResult.get().values = std::move(quantitativeResult.getMin());
+            previousResult.get().odd = odd;
             STORM_LOG_TRACE("Prepared next previous result to reuse values.");
         }
     }
@@ -1648,9 +1658,24 @@ ExplicitQualitativeGameResultMinMax GameBasedMdpModelChecker<Type, ModelType>::c
     result.prob0Max =
         storm::utility::graph::performProb0(transitionMatrix, player1Groups, player1BackwardTransitions, player2BackwardTransitions, constraintStates,
                                             targetStates, player1Direction, storm::OptimizationDirection::Maximize, &maxStrategyPair);
+
+    // We know that only previous prob1 states can now be prob 1 states again, because the upper bound values can only
+    // decrease over iterations. States that do not stem from a state of the previous game remain candidates.
+    boost::optional<storm::storage::BitVector> prob1MaxCandidates;
+    if (reuseQualitativeResults && previousResult && previousResult.get().hasQualitativeResult() &&
+        previousResult.get().qualitativeOdd.getHeight() < odd.getHeight()) {
+        storm::storage::BitVector candidates(odd.getTotalOffset(), true);
+        storm::storage::BitVector const& previousProb1MaxStates = previousResult.get().prob1MaxStates;
+        previousResult.get().qualitativeOdd.oldToNewIndex(odd, [&candidates, &previousProb1MaxStates](uint64_t oldOffset, uint64_t newOffset) {
+            if (!previousProb1MaxStates.get(oldOffset)) {
+                candidates.set(newOffset, false);
+            }
+        });
+        prob1MaxCandidates = std::move(candidates);
+    }
     result.prob1Max =
         storm::utility::graph::performProb1(transitionMatrix, player1Groups, player1BackwardTransitions, player2BackwardTransitions, constraintStates,
-                                            targetStates, player1Direction, storm::OptimizationDirection::Maximize, &maxStrategyPair);
+                                            targetStates, player1Direction, storm::OptimizationDirection::Maximize, &maxStrategyPair, prob1MaxCandidates);
 
     STORM_LOG_INFO("[" << player1Direction << ", " << storm::OptimizationDirection::Minimize << "]: " << result.prob0Min.player1States.getNumberOfSetBits()
                        << " 'no', " << result.prob1Min.player1States.getNumberOfSetBits() << " 'yes'.");
@@ -72,6 +72,18 @@ struct PreviousExplicitResult {
     ExplicitQuantitativeResult<ValueType> values;
     storm::dd::Odd odd;
 
+    // The player 1 states with probability 1 if player 2 maximizes and the ODD of the game they were computed for.
+    storm::storage::BitVector prob1MaxStates;
+    storm::dd::Odd qualitativeOdd;
+
+    bool hasValues() const {
+        return !values.getValues().empty();
+    }
+
+    bool hasQualitativeResult() const {
+        return qualitativeOdd.getTotalOffset() > 0;
+    }
+
     void clear() {
         odd = storm::dd::Odd();
         values = ExplicitQuantitativeResult<ValueType>();
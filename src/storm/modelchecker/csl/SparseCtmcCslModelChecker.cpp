@@ -85,6 +85,31 @@ std::unique_ptr<CheckResult> SparseCtmcCslModelChecker<SparseCtmcModelType>::com
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
 }
 
+template<typename SparseCtmcModelType>
+std::vector<std::unique_ptr<CheckResult>> SparseCtmcCslModelChecker<SparseCtmcModelType>::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask, std::vector<double> const& timePoints) {
+    storm::logic::BoundedUntilFormula const& pathFormula = checkTask.getFormula();
+    STORM_LOG_THROW(pathFormula.getTimeBoundReference().isTimeBound(), storm::exceptions::NotImplementedException,
+                    "Currently step-bounded or reward-bounded properties on CTMCs are not supported.");
+    STORM_LOG_THROW(!pathFormula.hasLowerBound() || storm::utility::isZero(pathFormula.getLowerBound<double>()), storm::exceptions::NotImplementedException,
+                    "Computing probabilities for multiple time points requires a formula without lower time bound.");
+    std::unique_ptr<CheckResult> leftResultPointer = this->check(env, pathFormula.getLeftSubformula());
+    std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
+    ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
+    ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+
+    std::vector<std::vector<ValueType>> numericResults = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+        env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+        this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), this->getModel().getExitRateVector(),
+        timePoints);
+    std::vector<std::unique_ptr<CheckResult>> result;
+    result.reserve(numericResults.size());
+    for (auto& numericResult : numericResults) {
+        result.emplace_back(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
+    }
+    return result;
+}
+
 template<typename SparseCtmcModelType>
 std::unique_ptr<CheckResult> SparseCtmcCslModelChecker<SparseCtmcModelType>::computeNextProbabilities(
     Environment const& env, CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) {
@@ -56,6 +56,13 @@ class SparseCtmcCslModelChecker : public SparsePropositionalModelChecker<SparseC
     virtual std::unique_ptr<CheckResult> computeTotalRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
                                                              CheckTask<storm::logic::TotalRewardFormula, ValueType> const& checkTask) override;
 
+    /*!
+     * Computes the probabilities of the given time-bounded until formula for each of the given time points, i.e., the upper time bound of
+     * the formula is replaced by the respective time point. The formula must not have a lower time bound.
+     */
+    std::vector<std::unique_ptr<CheckResult>> computeBoundedUntilProbabilitiesForTimePoints(
+        Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask, std::vector<double> const& timePoints);
+
     /*!
      * Compute transient probabilities for all states.
      */
@@ -103,6 +103,35 @@ std::unique_ptr<CheckResult> SparseMarkovAutomatonCslModelChecker<SparseMarkovAu
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(result)));
 }
 
+template<typename SparseMarkovAutomatonModelType>
+std::vector<std::unique_ptr<CheckResult>> SparseMarkovAutomatonCslModelChecker<SparseMarkovAutomatonModelType>::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask, std::vector<double> const& timePoints) {
+    storm::logic::BoundedUntilFormula const& pathFormula = checkTask.getFormula();
+    STORM_LOG_THROW(checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException,
+                    "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
+    STORM_LOG_THROW(this->getModel().isClosed(), storm::exceptions::InvalidPropertyException,
+                    "Unable to compute time-bounded reachability probabilities in non-closed Markov automaton.");
+    STORM_LOG_THROW(pathFormula.getTimeBoundReference().isTimeBound(), storm::exceptions::NotImplementedException,
+                    "Currently step-bounded and reward-bounded properties on MAs are not supported.");
+    STORM_LOG_THROW(!pathFormula.hasLowerBound() || storm::utility::isZero(pathFormula.getLowerBound<double>()), storm::exceptions::NotImplementedException,
+                    "Computing probabilities for multiple time points requires a formula without lower time bound.");
+    std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
+    ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+    std::unique_ptr<CheckResult> leftResultPointer = this->check(env, pathFormula.getLeftSubformula());
+    ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
+
+    std::vector<std::vector<ValueType>> numericResults =
+        storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+            env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(), this->getModel().getExitRates(),
+            this->getModel().getMarkovianStates(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), timePoints);
+    std::vector<std::unique_ptr<CheckResult>> result;
+    result.reserve(numericResults.size());
+    for (auto& numericResult : numericResults) {
+        result.emplace_back(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
+    }
+    return result;
+}
+
 template<typename SparseMarkovAutomatonModelType>
 std::unique_ptr<CheckResult> SparseMarkovAutomatonCslModelChecker<SparseMarkovAutomatonModelType>::computeNextProbabilities(
     Environment const& env, CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) {
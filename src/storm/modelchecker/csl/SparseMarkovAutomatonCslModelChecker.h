@@ -52,6 +52,13 @@ class SparseMarkovAutomatonCslModelChecker : public SparsePropositionalModelChec
                                                                   CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> checkMultiObjectiveFormula(Environment const& env,
                                                                     CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) override;
+
+    /*!
+     * Computes the probabilities of the given time-bounded until formula for each of the given time points, i.e., the upper time bound of
+     * the formula is replaced by the respective time point. The formula must not have a lower time bound.
+     */
+    std::vector<std::unique_ptr<CheckResult>> computeBoundedUntilProbabilitiesForTimePoints(
+        Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask, std::vector<double> const& timePoints);
 };
 }  // namespace modelchecker
 }  // namespace storm
@@ -24,7 +24,9 @@
 #include "storm/utility/numerical.h"
 #include "storm/utility/vector.h"
 
+#include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/FormatUnsupportedBySolverException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -35,6 +37,51 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+namespace {
+/*!
+ * Orders the rows of the given matrix according to the number of matrix-vector multiplications after which their value can become non-zero
+ * when starting from a vector whose non-zero entries are contained in the given support. Rows whose value remains zero are omitted.
+ *
+ * @param transposedMatrix The transposed matrix, i.e., row i contains the rows of the original matrix that have an entry in column i.
+ * @param support The rows whose values are initially non-zero.
+ * @param levelBoundaries Is filled such that levelBoundaries[k] is the number of (ordered) rows whose value can be non-zero after k multiplications.
+ * @param maximalLevel The number of multiplications after which the exploration is stopped.
+ * @return The rows ordered by the number of multiplications after which their value can become non-zero.
+ */
+template<typename ValueType>
+std::vector<uint64_t> orderRowsByDistanceToSupport(storm::storage::SparseMatrix<ValueType> const& transposedMatrix, storm::storage::BitVector const& support,
+                                                   std::vector<uint64_t>& levelBoundaries,
+                                                   uint64_t maximalLevel = std::numeric_limits<uint64_t>::max()) {
+    std::vector<uint64_t> orderedRows;
+    orderedRows.reserve(support.getNumberOfSetBits());
+    for (auto row : support) {
+        orderedRows.push_back(row);
+    }
+    storm::storage::BitVector reachedRows = support;
+    levelBoundaries.clear();
+    levelBoundaries.push_back(orderedRows.size());
+    uint64_t levelStart = 0;
+    while (levelBoundaries.size() <= maximalLevel) {
+        uint64_t levelEnd = orderedRows.size();
+        for (uint64_t index = levelStart; index < levelEnd; ++index) {
+            for (auto const& entry : transposedMatrix.getRow(orderedRows[index])) {
+                if (!reachedRows.get(entry.getColumn())) {
+                    reachedRows.set(entry.getColumn());
+                    orderedRows.push_back(entry.getColumn());
+                }
+            }
+        }
+        if (orderedRows.size() == levelEnd) {
+            // No new rows were reached, so the remaining levels would all be the same.
+            break;
+        }
+        levelBoundaries.push_back(orderedRows.size());
+        levelStart = levelEnd;
+    }
+    return orderedRows;
+}
+}  // namespace
+
 template<typename ValueType>
 bool SparseCtmcCslHelper::checkAndUpdateTransientProbabilityEpsilon(storm::Environment const& env, ValueType& epsilon,
                                                                     std::vector<ValueType> const& resultVector,
@@ -123,28 +170,13 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
                     result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
                     storm::utility::vector::setVectorValues<ValueType>(result, psiStates, storm::utility::one<ValueType>());
                     if (!statesWithProbabilityGreater0NonPsi.empty()) {
-                        // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
-                        ValueType uniformizationRate = 0;
-                        for (auto state : statesWithProbabilityGreater0NonPsi) {
-                            uniformizationRate = std::max(uniformizationRate, exitRates[state]);
-                        }
-                        uniformizationRate *= 1.02;
-                        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
-
-                        // Compute the uniformized matrix.
-                        storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
-                            computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
-
-                        // Compute the vector that is to be added as a compensation for removing the absorbing states.
+                        // Compute the rates that are to be added as a compensation for removing the absorbing states.
                         std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
-                        for (auto& element : b) {
-                            element /= uniformizationRate;
-                        }
 
                         // Finally compute the transient probabilities.
                         std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
-                        std::vector<ValueType> subresult =
-                            computeTransientProbabilities(env, uniformizedMatrix, &b, upperBound, uniformizationRate, values, epsilon);
+                        std::vector<ValueType> subresult = computeTransientProbabilitiesOfSubsystem<ValueType>(
+                            env, rateMatrix, statesWithProbabilityGreater0NonPsi, exitRates, &b, upperBound, values, epsilon);
                         storm::utility::vector::setVectorValues(result, statesWithProbabilityGreater0NonPsi, subresult);
                     }
                 } else if (upperBound == storm::utility::infinity<ValueType>()) {
@@ -160,19 +192,9 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
                     std::vector<ValueType> subResult(relevantStates.getNumberOfSetBits());
                     storm::utility::vector::selectVectorValues(subResult, relevantStates, result);
 
-                    ValueType uniformizationRate = 0;
-                    for (auto state : relevantStates) {
-                        uniformizationRate = std::max(uniformizationRate, exitRates[state]);
-                    }
-                    uniformizationRate *= 1.02;
-                    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
-
-                    // Compute the uniformized matrix.
-                    storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
-                        computeUniformizedMatrix(rateMatrix, relevantStates, uniformizationRate, exitRates);
-
                     // Compute the transient probabilities.
-                    subResult = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, lowerBound, uniformizationRate, subResult, epsilon);
+                    subResult = computeTransientProbabilitiesOfSubsystem<ValueType>(env, rateMatrix, relevantStates, exitRates, nullptr, lowerBound, subResult,
+                                                                                    epsilon);
 
                     // Fill in the correct values.
                     storm::utility::vector::setVectorValues(result, ~relevantStates, storm::utility::zero<ValueType>());
@@ -187,47 +209,22 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
                         std::vector<ValueType> newSubresult(relevantStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
                         storm::utility::vector::setVectorValues(newSubresult, psiStates % relevantStates, storm::utility::one<ValueType>());
                         if (!statesWithProbabilityGreater0NonPsi.empty()) {
-                            // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
-                            ValueType uniformizationRate = storm::utility::zero<ValueType>();
-                            for (auto state : statesWithProbabilityGreater0NonPsi) {
-                                uniformizationRate = std::max(uniformizationRate, exitRates[state]);
-                            }
-                            uniformizationRate *= 1.02;
-                            STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
-
-                            // Compute the (first) uniformized matrix.
-                            storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
-                                computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
-
-                            // Compute the vector that is to be added as a compensation for removing the absorbing states.
+                            // Compute the rates that are to be added as a compensation for removing the absorbing states.
                             std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
-                            for (auto& element : b) {
-                                element /= uniformizationRate;
-                            }
 
                             // Start by computing the transient probabilities of reaching a psi state in time t' - t.
                             std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
                             // divide the possible error by two since we will make this error two times.
-                            std::vector<ValueType> subresult =
-                                computeTransientProbabilities(env, uniformizedMatrix, &b, upperBound - lowerBound, uniformizationRate, values,
-                                                              epsilon / storm::utility::convertNumber<ValueType>(2.0));
+                            std::vector<ValueType> subresult = computeTransientProbabilitiesOfSubsystem<ValueType>(
+                                env, rateMatrix, statesWithProbabilityGreater0NonPsi, exitRates, &b, upperBound - lowerBound, values,
+                                epsilon / storm::utility::convertNumber<ValueType>(2.0));
                             storm::utility::vector::setVectorValues(newSubresult, statesWithProbabilityGreater0NonPsi % relevantStates, subresult);
                         }
 
                         // Then compute the transient probabilities of being in such a state after t time units. For this,
-                        // we must re-uniformize the CTMC, so we need to compute the second uniformized matrix.
-                        ValueType uniformizationRate = storm::utility::zero<ValueType>();
-                        for (auto state : relevantStates) {
-                            uniformizationRate = std::max(uniformizationRate, exitRates[state]);
-                        }
-                        uniformizationRate *= 1.02;
-                        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
-
-                        // Finally, we compute the second set of transient probabilities.
-                        storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
-                            computeUniformizedMatrix(rateMatrix, relevantStates, uniformizationRate, exitRates);
-                        newSubresult = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult,
-                                                                                epsilon / storm::utility::convertNumber<ValueType>(2.0));
+                        // we must re-uniformize the CTMC on the relevant states.
+                        newSubresult = computeTransientProbabilitiesOfSubsystem<ValueType>(env, rateMatrix, relevantStates, exitRates, nullptr, lowerBound,
+                                                                                           newSubresult, epsilon / storm::utility::convertNumber<ValueType>(2.0));
 
                         // Fill in the correct values.
                         result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
@@ -239,20 +236,9 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
                         std::vector<ValueType> newSubresult = std::vector<ValueType>(statesWithProbabilityGreater0.getNumberOfSetBits());
                         storm::utility::vector::setVectorValues(newSubresult, psiStates % statesWithProbabilityGreater0, storm::utility::one<ValueType>());
 
-                        // Then compute the transient probabilities of being in such a state after t time units. For this,
-                        // we must re-uniformize the CTMC, so we need to compute the second uniformized matrix.
-                        ValueType uniformizationRate = storm::utility::zero<ValueType>();
-                        for (auto state : statesWithProbabilityGreater0) {
-                            uniformizationRate = std::max(uniformizationRate, exitRates[state]);
-                        }
-                        uniformizationRate *= 1.02;
-                        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
-
-                        // Finally, we compute the second set of transient probabilities.
-                        storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
-                            computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0, uniformizationRate, exitRates);
-                        newSubresult =
-                            computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult, epsilon);
+                        // Then compute the transient probabilities of being in such a state after t time units.
+                        newSubresult = computeTransientProbabilitiesOfSubsystem<ValueType>(env, rateMatrix, statesWithProbabilityGreater0, exitRates, nullptr,
+                                                                                           lowerBound, newSubresult, epsilon);
 
                         // Fill in the correct values.
                         result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
@@ -277,6 +263,90 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Env
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    STORM_LOG_THROW(std::is_sorted(upperBounds.begin(), upperBounds.end()), storm::exceptions::InvalidArgumentException, "The time points must be sorted.");
+    STORM_LOG_THROW(upperBounds.empty() || (upperBounds.front() >= 0.0 && upperBounds.back() < storm::utility::infinity<double>()),
+                    storm::exceptions::InvalidArgumentException, "The time points must be non-negative and finite.");
+
+    uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+    std::vector<std::vector<ValueType>> result;
+
+    // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
+    ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+
+    storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+    storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+
+    // the positions within the result for which the precision needs to be checked
+    storm::storage::BitVector relevantValues;
+    if (goal.hasRelevantValues()) {
+        relevantValues = std::move(goal.relevantValues());
+        relevantValues &= statesWithProbabilityGreater0;
+    } else {
+        relevantValues = statesWithProbabilityGreater0;
+    }
+
+    // All time points are handled with the same uniformization.
+    ValueType uniformizationRate = storm::utility::zero<ValueType>();
+    storm::storage::SparseMatrix<ValueType> uniformizedMatrix;
+    std::vector<ValueType> b;
+    if (!statesWithProbabilityGreater0NonPsi.empty()) {
+        for (auto state : statesWithProbabilityGreater0NonPsi) {
+            uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+        }
+        uniformizationRate *= 1.02;
+        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+        uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+
+        // Compute the vector that is to be added as a compensation for removing the absorbing states.
+        b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+        for (auto& element : b) {
+            element /= uniformizationRate;
+        }
+    }
+    std::vector<ValueType> timeBounds;
+    timeBounds.reserve(upperBounds.size());
+    for (auto const& bound : upperBounds) {
+        timeBounds.push_back(storm::utility::convertNumber<ValueType>(bound));
+    }
+
+    bool refine;
+    do {  // Iterate until the desired precision is reached (only relevant for relative precision criterion)
+        result.assign(upperBounds.size(), std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>()));
+        for (auto& values : result) {
+            storm::utility::vector::setVectorValues<ValueType>(values, psiStates, storm::utility::one<ValueType>());
+        }
+        if (!statesWithProbabilityGreater0NonPsi.empty()) {
+            std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+            std::vector<std::vector<ValueType>> subresults =
+                computeTransientProbabilitiesForTimePoints<ValueType>(env, uniformizedMatrix, &b, timeBounds, uniformizationRate, values, epsilon);
+            for (uint64_t timePointIndex = 0; timePointIndex < result.size(); ++timePointIndex) {
+                storm::utility::vector::setVectorValues(result[timePointIndex], statesWithProbabilityGreater0NonPsi, subresults[timePointIndex]);
+            }
+        }
+        // Each check may further decrease epsilon, so we have to check all time points.
+        refine = false;
+        for (auto const& values : result) {
+            refine |= checkAndUpdateTransientProbabilityEpsilon(env, epsilon, values, relevantValues);
+        }
+    } while (refine);
+    return result;
+}
+
+template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const&, storm::solver::SolveGoal<ValueType>&&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&,
+    storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, std::vector<double> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+}
+
 template<typename ValueType>
 std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                       storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -573,26 +643,8 @@ std::vector<ValueType> SparseCtmcCslHelper::computeAllTransientProbabilities(Env
     STORM_LOG_DEBUG(relevantStates.getNumberOfSetBits() << " relevant states.");
 
     if (!relevantStates.empty()) {
-        // Find the maximal rate of all relevant states to take it as the uniformization rate.
-        ValueType uniformizationRate = 0;
-        for (auto state : relevantStates) {
-            uniformizationRate = std::max(uniformizationRate, newRates[state]);
-        }
-        uniformizationRate *= 1.02;
-        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
-
         transposedMatrix = transposedMatrix.transpose();
 
-        // Compute the uniformized matrix.
-        storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(transposedMatrix, relevantStates, uniformizationRate, newRates);
-
-        // Compute the vector that is to be added as a compensation for removing the absorbing states.
-        /*std::vector<ValueType> b = transposedMatrix.getConstrainedRowSumVector(relevantStates, initialStates);
-        for (auto& element : b) {
-            element /= uniformizationRate;
-            std::cout << element << '\n';
-        }*/
-
         ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
         STORM_LOG_WARN_COND(!env.solver().timeBounded().getRelativeTerminationCriterion(),
                             "Computation of transient probabilities with relative precision not supported. Using absolute precision instead.");
@@ -608,7 +660,7 @@ std::vector<ValueType> SparseCtmcCslHelper::computeAllTransientProbabilities(Env
         }
         // Finally compute the transient probabilities.
         std::vector<ValueType> subresult =
-            computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, values, epsilon);
+            computeTransientProbabilitiesOfSubsystem<ValueType>(env, transposedMatrix, relevantStates, newRates, nullptr, timeBound, values, epsilon);
 
         storm::utility::vector::setVectorValues(result, relevantStates, subresult);
     }
@@ -666,8 +718,34 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
         return values;
     }
 
+    // Stopping the iterations early is only sound if the difference of two consecutive iterates does not grow. This is the case if all
+    // row sums (for the maximum norm) or all column sums (for the sum norm) of the uniformized matrix are at most one.
+    bool detectSteadyState = !useMixedPoissonProbabilities && env.solver().timeBounded().isSteadyStateDetectionSet();
+    bool useSumNorm = false;
+    if (detectSteadyState) {
+        ValueType const maximalSum = storm::utility::one<ValueType>() + storm::utility::convertNumber<ValueType>(1e-12);
+        std::vector<ValueType> columnSums(uniformizedMatrix.getColumnCount(), storm::utility::zero<ValueType>());
+        bool rowSumsBounded = true;
+        for (uint64_t row = 0; row < uniformizedMatrix.getRowCount(); ++row) {
+            ValueType rowSum = storm::utility::zero<ValueType>();
+            for (auto const& entry : uniformizedMatrix.getRow(row)) {
+                rowSum += entry.getValue();
+                columnSums[entry.getColumn()] += entry.getValue();
+            }
+            rowSumsBounded &= rowSum <= maximalSum;
+        }
+        if (!rowSumsBounded) {
+            useSumNorm = std::all_of(columnSums.begin(), columnSums.end(), [&maximalSum](ValueType const& sum) { return sum <= maximalSum; });
+            detectSteadyState = useSumNorm;
+            STORM_LOG_WARN_COND(detectSteadyState, "Steady-state detection is not applicable for the given matrix and is therefore disabled.");
+        }
+    }
+    // If we detect steady states, half of the error is spent on stopping early.
+    ValueType truncationEpsilon = detectSteadyState ? epsilon / storm::utility::convertNumber<ValueType>(2.0) : epsilon;
+    ValueType steadyStateEpsilon = epsilon - truncationEpsilon;
+
     // Use Fox-Glynn to get the truncation points and the weights.
-    storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
+    storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, truncationEpsilon);
     STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
     // foxGlynnResult.weights do not sum up to one. This is to enhance numerical stability.
 
@@ -681,6 +759,32 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
         }
     }
 
+    // For steady-state detection, we need the weights of the remaining iterations and their distance to the current iteration, i.e.
+    // tailWeights[i] is the sum of all weights[j] with j > i and tailMoments[i] is the sum of all weights[j] * (j - i) with j > i.
+    std::vector<ValueType> tailWeights, tailMoments;
+    if (detectSteadyState) {
+        tailWeights.assign(foxGlynnResult.weights.size(), storm::utility::zero<ValueType>());
+        tailMoments.assign(foxGlynnResult.weights.size(), storm::utility::zero<ValueType>());
+        for (uint64_t index = foxGlynnResult.weights.size() - 1; index > 0; --index) {
+            tailWeights[index - 1] = tailWeights[index] + foxGlynnResult.weights[index];
+            tailMoments[index - 1] = tailMoments[index] + tailWeights[index - 1];
+        }
+    }
+
+    // If requested, we only multiply the rows whose values can already be non-zero.
+    bool restrictToActiveSupport = env.solver().timeBounded().isRestrictToActiveSupportSet();
+    std::vector<uint64_t> activeRows, levelBoundaries;
+    if (restrictToActiveSupport) {
+        storm::storage::BitVector support(values.size());
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            if (!storm::utility::isZero(values[state]) || (addVector != nullptr && !storm::utility::isZero((*addVector)[state]))) {
+                support.set(state);
+            }
+        }
+        activeRows = orderRowsByDistanceToSupport(uniformizedMatrix.transpose(), support, levelBoundaries);
+        STORM_LOG_DEBUG("Restricting iterations to " << activeRows.size() << " of " << values.size() << " rows.");
+    }
+
     STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
 
     // Initialize result.
@@ -703,9 +807,56 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     }
 
     auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    std::vector<ValueType> previousValues;
+    uint64_t numberOfPerformedIterations = 0;
+    auto performIteration = [&](std::vector<ValueType> const* summand) {
+        ++numberOfPerformedIterations;
+        if (restrictToActiveSupport) {
+            uint64_t numberOfActiveRows = levelBoundaries[std::min<uint64_t>(numberOfPerformedIterations, levelBoundaries.size() - 1)];
+            if (numberOfActiveRows < values.size()) {
+                // The inactive rows are zero in both vectors, so we can swap them after the multiplication.
+                previousValues.resize(values.size(), storm::utility::zero<ValueType>());
+                for (auto rowIt = activeRows.begin(), rowIte = activeRows.begin() + numberOfActiveRows; rowIt != rowIte; ++rowIt) {
+                    previousValues[*rowIt] = uniformizedMatrix.multiplyRowWithVector(*rowIt, values);
+                    if (summand != nullptr) {
+                        previousValues[*rowIt] += (*summand)[*rowIt];
+                    }
+                }
+                std::swap(values, previousValues);
+                return;
+            }
+        }
+        if (detectSteadyState) {
+            previousValues = values;
+        }
+        multiplier->multiply(env, values, summand, values);
+    };
+    auto isSteadyState = [&](ValueType const& remainingMoment) {
+        // The difference between the current values and all upcoming ones grows at most linearly with the number of iterations.
+        ValueType difference = storm::utility::zero<ValueType>();
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            ValueType stateDifference = storm::utility::abs<ValueType>(values[state] - previousValues[state]);
+            difference = useSumNorm ? difference + stateDifference : std::max(difference, stateDifference);
+        }
+        return difference * remainingMoment <= steadyStateEpsilon * foxGlynnResult.totalWeight;
+    };
+
     if (!useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
         // Perform the matrix-vector multiplications (without adding).
-        multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
+        if (!detectSteadyState && !restrictToActiveSupport) {
+            multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
+        } else {
+            ValueType leftMoment = tailMoments.empty() ? storm::utility::zero<ValueType>() : tailMoments.front();
+            for (uint_fast64_t index = 1; index < foxGlynnResult.left; ++index) {
+                performIteration(addVector);
+                // All remaining weights are at least (left - index) iterations away.
+                if (detectSteadyState &&
+                    isSteadyState(leftMoment + storm::utility::convertNumber<ValueType>(foxGlynnResult.left - index) * foxGlynnResult.totalWeight)) {
+                    STORM_LOG_DEBUG("Detected steady state after " << index << " iterations.");
+                    return values;
+                }
+            }
+        }
     } else if (useMixedPoissonProbabilities) {
         std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&uniformizationRate](ValueType const& a, ValueType const& b) {
             return a + b / uniformizationRate;
@@ -713,7 +864,7 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
 
         // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
         for (uint_fast64_t index = 1; index < startingIteration; ++index) {
-            multiplier->multiply(env, values, nullptr, values);
+            performIteration(nullptr);
             storm::utility::vector::applyPointwise(result, values, result, addAndScale);
         }
         // To make sure that the values obtained before the left truncation point have the same 'impact' on the total result as the values obtained
@@ -727,10 +878,18 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     ValueType weight = 0;
     std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight](ValueType const& a, ValueType const& b) { return a + weight * b; };
     for (uint_fast64_t index = startingIteration; index <= foxGlynnResult.right; ++index) {
-        multiplier->multiply(env, values, addVector, values);
+        performIteration(addVector);
 
         weight = foxGlynnResult.weights[index - foxGlynnResult.left];
         storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+
+        if (detectSteadyState && index < foxGlynnResult.right && isSteadyState(tailMoments[index - foxGlynnResult.left])) {
+            // Use the current values for all remaining iterations.
+            weight = tailWeights[index - foxGlynnResult.left];
+            storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+            STORM_LOG_DEBUG("Detected steady state after " << index << " of " << foxGlynnResult.right << " iterations.");
+            break;
+        }
     }
 
     // Finally, divide the result by the total weight
@@ -738,6 +897,199 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     return result;
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimePoints(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+    std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+
+    // Use Fox-Glynn to get the truncation points and the weights of each time bound.
+    std::vector<storm::utility::numerical::FoxGlynnResult<ValueType>> foxGlynnResults;
+    foxGlynnResults.reserve(timeBounds.size());
+    uint64_t maximalRight = 0;
+    for (auto const& timeBound : timeBounds) {
+        ValueType lambda = timeBound * uniformizationRate;
+        if (storm::utility::isZero(lambda)) {
+            // If no time can pass, the initial values are the result.
+            foxGlynnResults.emplace_back();
+            foxGlynnResults.back().left = 0;
+            foxGlynnResults.back().right = 0;
+            foxGlynnResults.back().weights.push_back(storm::utility::one<ValueType>());
+            foxGlynnResults.back().totalWeight = storm::utility::one<ValueType>();
+        } else {
+            foxGlynnResults.push_back(storm::utility::numerical::foxGlynn(lambda, epsilon));
+        }
+        maximalRight = std::max<uint64_t>(maximalRight, foxGlynnResults.back().right);
+    }
+    STORM_LOG_DEBUG("Performing " << maximalRight << " iterations for " << timeBounds.size() << " time points.");
+
+    // Initialize the results.
+    std::vector<std::vector<ValueType>> result(timeBounds.size());
+    for (uint64_t timePointIndex = 0; timePointIndex < timeBounds.size(); ++timePointIndex) {
+        if (foxGlynnResults[timePointIndex].left == 0) {
+            result[timePointIndex] = values;
+            storm::utility::vector::scaleVectorInPlace(result[timePointIndex], foxGlynnResults[timePointIndex].weights.front());
+        } else {
+            result[timePointIndex] = std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>());
+        }
+    }
+
+    // Perform the matrix-vector multiplications once and add the scaled values to each result whose truncation points enclose the iteration.
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    for (uint64_t index = 1; index <= maximalRight; ++index) {
+        multiplier->multiply(env, values, addVector, values);
+        for (uint64_t timePointIndex = 0; timePointIndex < timeBounds.size(); ++timePointIndex) {
+            auto const& foxGlynnResult = foxGlynnResults[timePointIndex];
+            if (foxGlynnResult.left <= index && index <= foxGlynnResult.right) {
+                storm::utility::vector::addScaledVector(result[timePointIndex], values, foxGlynnResult.weights[index - foxGlynnResult.left]);
+            }
+        }
+        STORM_LOG_THROW(!storm::utility::resources::isTerminate(), storm::exceptions::AbortException,
+                        "Iterations were aborted before reaching all time points.");
+    }
+
+    // Finally, divide the results by the total weights.
+    for (uint64_t timePointIndex = 0; timePointIndex < timeBounds.size(); ++timePointIndex) {
+        storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result[timePointIndex],
+                                                                         storm::utility::one<ValueType>() / foxGlynnResults[timePointIndex].totalWeight);
+    }
+    return result;
+}
+
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilitiesOfSubsystem(Environment const& env,
+                                                                                     storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                     storm::storage::BitVector const& subsystem,
+                                                                                     std::vector<ValueType> const& exitRates,
+                                                                                     std::vector<ValueType> const* addRates, ValueType timeBound,
+                                                                                     std::vector<ValueType> const& values, ValueType epsilon) {
+    if (env.solver().timeBounded().getCtmcMethod() == storm::solver::CtmcTransientMethod::AdaptiveUniformization) {
+        return computeTransientProbabilitiesAdaptive<ValueType>(env, rateMatrix, subsystem, exitRates, addRates, timeBound, values, epsilon);
+    }
+
+    // Find the maximal rate of all considered states to take it as the uniformization rate.
+    ValueType uniformizationRate = storm::utility::zero<ValueType>();
+    for (auto state : subsystem) {
+        uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+    }
+    uniformizationRate *= 1.02;
+    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+    // Compute the uniformized matrix.
+    storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, subsystem, uniformizationRate, exitRates);
+
+    if (addRates == nullptr) {
+        return computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, values, epsilon);
+    }
+
+    // Compute the vector that is to be added as a compensation for removing the absorbing states.
+    std::vector<ValueType> addVector = *addRates;
+    for (auto& element : addVector) {
+        element /= uniformizationRate;
+    }
+    return computeTransientProbabilities<ValueType>(env, uniformizedMatrix, &addVector, timeBound, uniformizationRate, values, epsilon);
+}
+
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilitiesAdaptive(Environment const& env,
+                                                                                  storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                  storm::storage::BitVector const& subsystem,
+                                                                                  std::vector<ValueType> const& exitRates,
+                                                                                  std::vector<ValueType> const* addRates, ValueType timeBound,
+                                                                                  std::vector<ValueType> values, ValueType epsilon) {
+    // Restrict the CTMC to the considered states. The diagonal entries are inserted later, when the individual steps are uniformized.
+    storm::storage::SparseMatrix<ValueType> subsystemRateMatrix = rateMatrix.getSubmatrix(false, subsystem, subsystem);
+    storm::storage::SparseMatrix<ValueType> transposedSubsystemRateMatrix = subsystemRateMatrix.transpose();
+    std::vector<ValueType> subsystemExitRates(subsystem.getNumberOfSetBits());
+    storm::utility::vector::selectVectorValues(subsystemExitRates, subsystem, exitRates);
+
+    // The states whose values can currently be non-zero.
+    storm::storage::BitVector activeStates(values.size());
+    for (uint64_t state = 0; state < values.size(); ++state) {
+        if (!storm::utility::isZero(values[state]) || (addRates != nullptr && !storm::utility::isZero((*addRates)[state]))) {
+            activeStates.set(state);
+        }
+    }
+
+    // The step lengths are doubled in every step such that the first steps (where few states are active) are short.
+    uint64_t const numberOfSteps = env.solver().timeBounded().getAdaptiveUniformizationSteps();
+    ValueType stepEpsilon = epsilon / storm::utility::convertNumber<ValueType>(numberOfSteps);
+    ValueType stepTime = timeBound / (storm::utility::pow(storm::utility::convertNumber<ValueType>(2.0), numberOfSteps) - storm::utility::one<ValueType>());
+    ValueType remainingTime = timeBound;
+    ValueType remainingEpsilon = epsilon;
+    bool activeStatesClosed = false;
+    std::vector<uint64_t> levelBoundaries;
+    for (uint64_t step = 0; !activeStatesClosed && !storm::utility::isZero(remainingTime) && !activeStates.empty(); ++step) {
+        if (step + 1 >= numberOfSteps) {
+            stepTime = remainingTime;
+            stepEpsilon = remainingEpsilon;
+        }
+
+        // Find the states that can be reached within the right truncation point of this step. Their exit rates determine the uniformization
+        // rate, which in turn determines the truncation point, so we increase the rate until this is consistent.
+        storm::storage::BitVector stepStates = activeStates;
+        ValueType uniformizationRate = storm::utility::zero<ValueType>();
+        for (auto state : stepStates) {
+            uniformizationRate = std::max(uniformizationRate, subsystemExitRates[state]);
+        }
+        while (true) {
+            uint64_t maximalLevel = std::numeric_limits<uint64_t>::max();
+            if (step + 1 < numberOfSteps && !storm::utility::isZero(uniformizationRate)) {
+                // Only half of the step's error is spent on truncation. The other half accounts for leaving the considered states.
+                maximalLevel = storm::utility::numerical::foxGlynn<ValueType>(stepTime * uniformizationRate * 1.02, stepEpsilon / 2).right;
+            }
+            std::vector<uint64_t> stepStatesOrdered = orderRowsByDistanceToSupport(transposedSubsystemRateMatrix, activeStates, levelBoundaries, maximalLevel);
+            activeStatesClosed = levelBoundaries.size() <= maximalLevel;
+            stepStates = storm::storage::BitVector(values.size(), stepStatesOrdered.begin(), stepStatesOrdered.end());
+            ValueType newUniformizationRate = uniformizationRate;
+            for (auto state : stepStates) {
+                newUniformizationRate = std::max(newUniformizationRate, subsystemExitRates[state]);
+            }
+            if (newUniformizationRate <= uniformizationRate) {
+                break;
+            }
+            uniformizationRate = newUniformizationRate;
+        }
+        if (activeStatesClosed) {
+            // The considered states do not change anymore, so we can handle the remaining time in a single step.
+            stepTime = remainingTime;
+            stepEpsilon = remainingEpsilon;
+        }
+        if (storm::utility::isZero(uniformizationRate)) {
+            // All considered states are absorbing, so no time needs to pass.
+            break;
+        }
+        uniformizationRate *= 1.02;
+        STORM_LOG_DEBUG("Adaptive uniformization step " << step << " of length " << stepTime << " considers " << stepStates.getNumberOfSetBits()
+                                                        << " states with uniformization rate " << uniformizationRate << ".");
+
+        // Perform the uniformization of this step and compute the transient probabilities. All other states have value zero.
+        storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
+            computeUniformizedMatrix(subsystemRateMatrix, stepStates, uniformizationRate, subsystemExitRates);
+        std::vector<ValueType> stepValues(stepStates.getNumberOfSetBits());
+        storm::utility::vector::selectVectorValues(stepValues, stepStates, values);
+        ValueType truncationEpsilon = activeStatesClosed ? stepEpsilon : stepEpsilon / 2;
+        if (addRates != nullptr) {
+            std::vector<ValueType> addVector(stepStates.getNumberOfSetBits());
+            storm::utility::vector::selectVectorValues(addVector, stepStates, *addRates);
+            for (auto& element : addVector) {
+                element /= uniformizationRate;
+            }
+            stepValues = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, &addVector, stepTime, uniformizationRate, stepValues, truncationEpsilon);
+        } else {
+            stepValues = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, stepTime, uniformizationRate, stepValues, truncationEpsilon);
+        }
+        storm::utility::vector::setVectorValues(values, stepStates, stepValues);
+
+        activeStates = std::move(stepStates);
+        remainingTime -= stepTime;
+        remainingEpsilon -= stepEpsilon;
+        stepTime *= storm::utility::convertNumber<ValueType>(2.0);
+    }
+    return values;
+}
+
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                                       std::vector<ValueType> const& exitRates) {
@@ -835,6 +1187,22 @@ template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(
                                                                                 std::vector<double> const* addVector, double timeBound,
                                                                                 double uniformizationRate, std::vector<double> values, double epsilon);
 
+template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilitiesOfSubsystem(Environment const& env,
+                                                                                           storm::storage::SparseMatrix<double> const& rateMatrix,
+                                                                                           storm::storage::BitVector const& subsystem,
+                                                                                           std::vector<double> const& exitRates,
+                                                                                           std::vector<double> const* addRates, double timeBound,
+                                                                                           std::vector<double> const& values, double epsilon);
+
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix,
+    storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<double> const& exitRates, std::vector<double> const& upperBounds);
+
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimePoints(
+    Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector,
+    std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values, double epsilon);
+
 #ifdef STORM_HAVE_CARL
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
@@ -844,6 +1212,14 @@ template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBounde
     Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix,
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
+    storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, std::vector<double> const& upperBounds);
+template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix,
+    storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, std::vector<double> const& upperBounds);
 
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
@@ -38,6 +38,25 @@ class SparseCtmcCslHelper {
                                                                    std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound,
                                                                    double upperBound);
 
+    /*!
+     * Computes the probabilities of satisfying phi U[0, t] psi for several time bounds t at once. All time bounds share a single
+     * uniformization and the matrix-vector multiplications are performed only once up to the largest right truncation point.
+     *
+     * @param upperBounds The (sorted) time bounds.
+     * @return For each time bound, the vector of probabilities of all states.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimePoints(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+        storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+        storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds);
+
+    template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimePoints(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+        storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+        storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds);
+
     template<typename ValueType>
     static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                             storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -131,7 +150,8 @@ class SparseCtmcCslHelper {
      * @param timeBound The time bound to use.
      * @param uniformizationRate The used uniformization rate.
      * @param values A vector mapping each state to an initial probability.
-     * @param epsilon The precision used for computing the truncation points
+     * @param epsilon The precision used for computing the truncation points. If steady-state detection is enabled in the environment, half
+     * of this error is spent on stopping the iterations early.
      * @tparam useMixedPoissonProbabilities If set to true, instead of taking the poisson probabilities,  mixed
      * poisson probabilities are used.
      * @return The vector of transient probabilities.
@@ -142,6 +162,60 @@ class SparseCtmcCslHelper {
                                                                 std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
                                                                 std::vector<ValueType> values, ValueType epsilon);
 
+    /*!
+     * Computes the transient probabilities for several time bounds in a single sequence of matrix-vector multiplications.
+     *
+     * @param uniformizedMatrix The uniformized transition matrix.
+     * @param addVector A vector that is added in each step as a possible compensation for removing absorbing states
+     * with a non-zero initial value. If this is not supposed to be used, it can be set to nullptr.
+     * @param timeBounds The time bounds to use.
+     * @param uniformizationRate The used uniformization rate.
+     * @param values A vector mapping each state to an initial probability.
+     * @param epsilon The precision used for computing the truncation points of each time bound.
+     * @return For each time bound, the vector of transient probabilities. If the computation is aborted, an AbortException is thrown instead.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeTransientProbabilitiesForTimePoints(Environment const& env,
+                                                                                          storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                                          std::vector<ValueType> const* addVector,
+                                                                                          std::vector<ValueType> const& timeBounds, ValueType uniformizationRate,
+                                                                                          std::vector<ValueType> values, ValueType epsilon);
+
+    /*!
+     * Computes the transient probabilities of the subsystem induced by the given states. Depending on the environment, either a single
+     * uniformization rate is used for the whole time horizon or the time horizon is split into steps that are uniformized adaptively.
+     *
+     * @param rateMatrix The rate matrix of the CTMC.
+     * @param subsystem The states that need to be considered.
+     * @param exitRates The exit rates of all states.
+     * @param addRates If not nullptr, the rates (indexed by the states of the subsystem) with which each state moves to a removed absorbing
+     * state with value one.
+     * @param timeBound The time bound to use.
+     * @param values A vector mapping each state of the subsystem to an initial probability.
+     * @param epsilon The precision used for computing the truncation points
+     * @return The vector of transient probabilities (indexed by the states of the subsystem).
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<ValueType> computeTransientProbabilitiesOfSubsystem(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                           storm::storage::BitVector const& subsystem, std::vector<ValueType> const& exitRates,
+                                                                           std::vector<ValueType> const* addRates, ValueType timeBound,
+                                                                           std::vector<ValueType> const& values, ValueType epsilon);
+
+    /*!
+     * Computes the transient probabilities of the subsystem induced by the given states using adaptive uniformization. The time horizon is
+     * split into steps of increasing length. For each step, only the states whose values can become non-zero within the right truncation
+     * point are considered and the uniformization rate is the maximal exit rate of these states. Once these states are closed under
+     * transitions, the remaining time is handled in a single step. The error made by cutting off the remaining states is accounted for
+     * in the truncation error of each step.
+     *
+     * The parameters are the same as for computeTransientProbabilitiesOfSubsystem.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<ValueType> computeTransientProbabilitiesAdaptive(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                        storm::storage::BitVector const& subsystem, std::vector<ValueType> const& exitRates,
+                                                                        std::vector<ValueType> const* addRates, ValueType timeBound,
+                                                                        std::vector<ValueType> values, ValueType epsilon);
+
     /*!
      * Converts the given rate-matrix into a time-abstract probability matrix.
      *
@@ -1,16 +1,21 @@
 #include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
 #include "storm/solver/LpSolver.h"
@@ -131,19 +136,30 @@ class UnifPlusHelper {
         // The probabilities to go from a probabilistic state to a psi state in one step
         std::vector<std::pair<uint64_t, ValueType>> probabilisticToPsiProbabilities = getSparseOneStepProbabilities(probabilisticMaybeStates, psiStates);
 
-        // Set up a solver for the transitions between probabilistic states (if there are some)
+        // At this point, the markovianExitRates are no longer needed, so we release their memory.
+        markovianExitRates = std::vector<ValueType>();
+
+        // Set up the data for the sweeps of the upper and lower bound. The data is kept over all outer iterations. If the sweeps are performed in
+        // parallel, each sweep gets its own solver, multipliers and auxiliary vectors. Otherwise, both sweeps share the same data.
         Environment solverEnv = env;
         solverEnv.solver().setForceExact(true);  // Errors within the inner iterations can propagate significantly
-        auto solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
+        bool parallelSweeps = false;
+#ifdef STORM_HAVE_INTELTBB
+        parallelSweeps = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#endif
+        SweepData upperSweepData(env, solverEnv, dir, markovianToMaybeTransitions, probabilisticToProbabilisticTransitions,
+                                 probabilisticToMarkovianTransitions);
+        std::unique_ptr<SweepData> separateLowerSweepData;
+        if (parallelSweeps) {
+            separateLowerSweepData = std::make_unique<SweepData>(env, solverEnv, dir, markovianToMaybeTransitions, probabilisticToProbabilisticTransitions,
+                                                                 probabilisticToMarkovianTransitions);
+        }
+        SweepData& lowerSweepData = parallelSweeps ? *separateLowerSweepData : upperSweepData;
 
         // Allocate auxiliary memory that can be used during the iterations
         std::vector<ValueType> maybeStatesValuesLower(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
         std::vector<ValueType> maybeStatesValuesWeightedUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());  // should be zero initially
         std::vector<ValueType> maybeStatesValuesUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
-        std::vector<ValueType> nextMarkovianStateValues = std::move(
-            markovianExitRates);  // At this point, the markovianExitRates are no longer needed, so we 'move' them away instead of allocating new memory
-        std::vector<ValueType> nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount());
-        std::vector<ValueType> eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount());
 
         // Start the outer iterations which increase the uniformization rate until lower and upper bound on the result vector is sufficiently small
         storm::utility::ProgressMeasurement progressIterations("iterations");
@@ -160,13 +176,8 @@ class UnifPlusHelper {
             // Scale the weights so they sum to one.
             // storm::utility::vector::scaleVectorInPlace(foxGlynnResult.weights, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
 
-            // Set up multiplier
-            auto markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
-            auto probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
-
-            // Perform inner iterations first for upper, then for lower bound
-            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
-            for (bool computeLowerBound : {false, true}) {
+            // Performs the inner iterations for the upper or the lower bound. Returns true if the iterations have been aborted.
+            auto performSweep = [&](bool computeLowerBound, SweepData& data) {
                 auto& maybeStatesValues = computeLowerBound ? maybeStatesValuesLower : maybeStatesValuesWeightedUpper;
                 ValueType targetValue = computeLowerBound ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
                 storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for " +
@@ -174,6 +185,7 @@ class UnifPlusHelper {
                 progressSteps.setMaxCount(N);
                 progressSteps.startNewMeasurement(0);
                 bool firstIteration = true;  // The first iterations can be irrelevant, because they will only produce zeroes anyway.
+                bool aborted = false;
                 int64_t k = N;
                 // Iteration k = N is always non-relevant
                 for (--k; k >= 0; --k) {
@@ -199,12 +211,12 @@ class UnifPlusHelper {
                         // Reaching this point means that this is the very first relevant iteration.
                         // If we are in the very first relevant iteration, we know that all states from the previous iteration have value zero.
                         // It is therefore valid (and necessary) to just set the values of Markovian states to zero.
-                        std::fill(nextMarkovianStateValues.begin(), nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
+                        std::fill(data.nextMarkovianStateValues.begin(), data.nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
                     } else {
                         // Compute the values at Markovian maybe states.
-                        markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, nextMarkovianStateValues);
+                        data.markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, data.nextMarkovianStateValues);
                         for (auto const& oneStepProb : markovianToPsiProbabilities) {
-                            nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
+                            data.nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
                         }
                     }
 
@@ -216,21 +228,22 @@ class UnifPlusHelper {
                     }
 
                     // Compute the values at probabilistic states.
-                    probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
+                    // The solver starts from the values of the previous step, which typically are close to the solution.
+                    data.probabilisticToMarkovianMultiplier->multiply(env, data.nextMarkovianStateValues, nullptr, data.eqSysRhs);
                     for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
-                        eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
+                        data.eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
                     }
-                    if (solver) {
-                        solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
+                    if (data.solver) {
+                        data.solver->solveEquations(solverEnv, dir, data.nextProbabilisticStateValues, data.eqSysRhs);
                     } else {
-                        storm::utility::vector::reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues,
+                        storm::utility::vector::reduceVectorMinOrMax(dir, data.eqSysRhs, data.nextProbabilisticStateValues,
                                                                      probabilisticToProbabilisticTransitions.getRowGroupIndices());
                     }
 
                     // Create the new values for the maybestates
                     // Fuse the results together
-                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, nextMarkovianStateValues);
-                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, nextProbabilisticStateValues);
+                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, data.nextMarkovianStateValues);
+                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, data.nextProbabilisticStateValues);
                     if (!computeLowerBound) {
                         // Add the scaled values to the actual result vector
                         uint64_t i = N - 1 - k;
@@ -243,7 +256,7 @@ class UnifPlusHelper {
 
                     progressSteps.updateProgress(N - k);
                     if (storm::utility::resources::isTerminate()) {
-                        abortedInnerIterations = true;
+                        aborted = true;
                         break;
                     }
                 }
@@ -253,18 +266,9 @@ class UnifPlusHelper {
                 } else {
                     storm::utility::vector::scaleVectorInPlace(maybeStatesValuesUpper, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
                 }
-
-                if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
-                    break;
-                }
-
-                // Check if the lower and upper bound are sufficiently close to each other
-                converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
-                if (converged) {
-                    break;
-                }
-
-                // Store the best solution we have found so far.
+                return aborted;
+            };
+            auto storeBestKnownSolution = [&]() {
                 if (relevantMaybeStates) {
                     auto currentSolIt = bestKnownSolution.begin();
                     for (auto state : relevantMaybeStates.get()) {
@@ -273,6 +277,43 @@ class UnifPlusHelper {
                         ++currentSolIt;
                     }
                 }
+            };
+
+            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
+            if (parallelSweeps) {
+#ifdef STORM_HAVE_INTELTBB
+                // The sweeps for the upper and the lower bound are independent of each other.
+                bool abortedUpper = false;
+                bool abortedLower = false;
+                tbb::parallel_invoke([&]() { abortedUpper = performSweep(false, upperSweepData); },
+                                     [&]() { abortedLower = performSweep(true, lowerSweepData); });
+                abortedInnerIterations = abortedUpper || abortedLower;
+                if (!abortedInnerIterations && !storm::utility::resources::isTerminate()) {
+                    // Check if the lower and upper bound are sufficiently close to each other
+                    converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
+                    if (!converged) {
+                        storeBestKnownSolution();
+                    }
+                }
+#endif
+            } else {
+                // Perform inner iterations first for upper, then for lower bound.
+                // As the lower bound of the previous iteration remains valid, we might not need to compute a new lower bound.
+                for (bool computeLowerBound : {false, true}) {
+                    abortedInnerIterations = performSweep(computeLowerBound, computeLowerBound ? lowerSweepData : upperSweepData);
+                    if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
+                        break;
+                    }
+
+                    // Check if the lower and upper bound are sufficiently close to each other
+                    converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
+                    if (converged) {
+                        break;
+                    }
+
+                    // Store the best solution we have found so far.
+                    storeBestKnownSolution();
+                }
             }
 
             if (!converged) {
@@ -296,8 +337,12 @@ class UnifPlusHelper {
                     STORM_LOG_DEBUG("Decreased kappa to " << kappa << ".");
                 }
 
-                // Apply uniformization with new rate
+                // Apply uniformization with new rate. The matrix is updated in place, so the multipliers only need to drop their cached data.
                 uniformize(markovianToMaybeTransitions, markovianToPsiProbabilities, oldLambda, lambda, markovianStatesModMaybeStates);
+                upperSweepData.markovianToMaybeMultiplier->clearCache();
+                if (separateLowerSweepData) {
+                    separateLowerSweepData->markovianToMaybeMultiplier->clearCache();
+                }
 
                 // Reset the values of the maybe states to zero.
                 std::fill(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end(), storm::utility::zero<ValueType>());
@@ -328,6 +373,31 @@ class UnifPlusHelper {
     }
 
    private:
+    /*!
+     * The solver, multipliers and auxiliary vectors used within the inner iterations. These are set up once and reused in all outer iterations.
+     */
+    struct SweepData {
+        SweepData(Environment const& env, Environment& solverEnv, OptimizationDirection dir,
+                  storm::storage::SparseMatrix<ValueType> const& markovianToMaybeTransitions,
+                  storm::storage::SparseMatrix<ValueType> const& probabilisticToProbabilisticTransitions,
+                  storm::storage::SparseMatrix<ValueType> const& probabilisticToMarkovianTransitions)
+            : markovianToMaybeMultiplier(storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions)),
+              probabilisticToMarkovianMultiplier(storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions)),
+              solver(setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions)),
+              nextMarkovianStateValues(markovianToMaybeTransitions.getRowCount()),
+              nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount()),
+              eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount()) {
+            // Intentionally left empty
+        }
+
+        std::unique_ptr<storm::solver::Multiplier<ValueType>> markovianToMaybeMultiplier;
+        std::unique_ptr<storm::solver::Multiplier<ValueType>> probabilisticToMarkovianMultiplier;
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+        std::vector<ValueType> nextMarkovianStateValues;
+        std::vector<ValueType> nextProbabilisticStateValues;
+        std::vector<ValueType> eqSysRhs;
+    };
+
     bool checkConvergence(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper,
                           boost::optional<storm::storage::BitVector> const& relevantValues, ValueType const& epsilon, bool relative, ValueType& kappa) {
         STORM_LOG_ASSERT(!relevantValues.is_initialized() || relevantValues->size() == lower.size(), "Relevant values size mismatch.");
@@ -491,7 +561,9 @@ void computeBoundedReachabilityProbabilitiesImca(Environment const& env, Optimiz
                                                  storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRates,
                                                  storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates,
                                                  storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<ValueType>& markovianNonGoalValues,
-                                                 std::vector<ValueType>& probabilisticNonGoalValues, ValueType delta, uint64_t numberOfSteps) {
+                                                 std::vector<ValueType>& probabilisticNonGoalValues, ValueType delta, uint64_t numberOfSteps,
+                                                 std::function<void(uint64_t, std::vector<ValueType> const&, std::vector<ValueType> const&)> const&
+                                                     stepCallback = nullptr) {
     // Start by computing four sparse matrices:
     // * a matrix aMarkovian with all (discretized) transitions from Markovian non-goal states to all Markovian non-goal states.
     // * a matrix aMarkovianToProbabilistic with all (discretized) transitions from Markovian non-goal states to all probabilistic non-goal states.
@@ -567,8 +639,10 @@ void computeBoundedReachabilityProbabilitiesImca(Environment const& env, Optimiz
     // *    perform value iteration using A_PSwG, v_PS and the vector b where b = (A * 1_G)|PS + A_PStoMS * v_MS
     //      and 1_G being the characteristic vector for all goal states.
     // *    perform one timed-step using v_MS := A_MSwG * v_MS + A_MStoPS * v_PS + (A * 1_G)|MS
+    // If a callback is given, it is invoked with the values of each step once the values of the probabilistic states are up to date.
     std::vector<ValueType> markovianNonGoalValuesSwap(markovianNonGoalValues);
-    for (uint64_t currentStep = 0; currentStep < numberOfSteps; ++currentStep) {
+    uint64_t currentStep = 0;
+    for (; currentStep < numberOfSteps; ++currentStep) {
         if (existProbabilisticStates) {
             // Start by (re-)computing bProbabilistic = bProbabilisticFixed + aProbabilisticToMarkovian * vMarkovian.
             aProbabilisticToMarkovian.multiplyWithVector(markovianNonGoalValues, bProbabilistic);
@@ -580,7 +654,11 @@ void computeBoundedReachabilityProbabilitiesImca(Environment const& env, Optimiz
             } else {
                 storm::utility::vector::reduceVectorMinOrMax(dir, bProbabilistic, probabilisticNonGoalValues, aProbabilistic.getRowGroupIndices());
             }
-
+        }
+        if (stepCallback) {
+            stepCallback(currentStep, markovianNonGoalValues, probabilisticNonGoalValues);
+        }
+        if (existProbabilisticStates) {
             // (Re-)compute bMarkovian = bMarkovianFixed + aMarkovianToProbabilistic * vProbabilistic.
             aMarkovianToProbabilistic.multiplyWithVector(probabilisticNonGoalValues, bMarkovian);
             storm::utility::vector::addVectors(bMarkovian, bMarkovianFixed, bMarkovian);
@@ -594,6 +672,7 @@ void computeBoundedReachabilityProbabilitiesImca(Environment const& env, Optimiz
             storm::utility::vector::addVectors(markovianNonGoalValues, bMarkovianFixed, markovianNonGoalValues);
         }
         if (storm::utility::resources::isTerminate()) {
+            ++currentStep;
             break;
         }
     }
@@ -608,6 +687,9 @@ void computeBoundedReachabilityProbabilitiesImca(Environment const& env, Optimiz
             storm::utility::vector::reduceVectorMinOrMax(dir, bProbabilistic, probabilisticNonGoalValues, aProbabilistic.getRowGroupIndices());
         }
     }
+    if (stepCallback) {
+        stepCallback(currentStep, markovianNonGoalValues, probabilisticNonGoalValues);
+    }
 }
 
 template<typename ValueType>
@@ -680,6 +762,63 @@ std::vector<ValueType> computeBoundedUntilProbabilitiesImca(Environment const& e
     }
 }
 
+template<typename ValueType>
+std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesImcaForTimePoints(
+    Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates,
+    std::vector<double> const& upperBounds) {
+    STORM_LOG_TRACE("Using IMCA's technique to compute bounded until probabilities for " << upperBounds.size() << " time points.");
+
+    uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+    std::vector<std::vector<ValueType>> result(upperBounds.size());
+    if (upperBounds.empty()) {
+        return result;
+    }
+
+    // (1) Compute the accuracy we need to achieve the required error bound. As the error grows with the time bound, the accuracy
+    // required for the largest time bound suffices for all others.
+    double maximalUpperBound = upperBounds.back();
+    ValueType maxExitRate = 0;
+    for (auto value : exitRateVector) {
+        maxExitRate = std::max(maxExitRate, value);
+    }
+    ValueType delta = storm::utility::one<ValueType>();
+    if (maximalUpperBound > 0.0 && maxExitRate > storm::utility::zero<ValueType>()) {
+        delta = (2.0 * storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision())) / (maximalUpperBound * maxExitRate * maxExitRate);
+    }
+
+    // (2) Compute the number of steps we need to make for each time bound.
+    std::vector<uint64_t> stepsOfTimePoints;
+    stepsOfTimePoints.reserve(upperBounds.size());
+    for (auto const& upperBound : upperBounds) {
+        stepsOfTimePoints.push_back(static_cast<uint64_t>(std::ceil(upperBound / delta)));
+    }
+    uint64_t numberOfSteps = stepsOfTimePoints.back();
+    STORM_LOG_INFO("Performing " << numberOfSteps << " iterations (delta=" << delta << ") for " << upperBounds.size() << " time points up to "
+                                 << maximalUpperBound << ".\n");
+
+    // (3) Compute the non-goal states and perform the iterations, recording the values of the steps that correspond to one of the time bounds.
+    storm::storage::BitVector const& markovianNonGoalStates = markovianStates & ~psiStates;
+    storm::storage::BitVector const& probabilisticNonGoalStates = ~markovianStates & ~psiStates;
+    std::vector<ValueType> vProbabilistic(probabilisticNonGoalStates.getNumberOfSetBits());
+    std::vector<ValueType> vMarkovian(markovianNonGoalStates.getNumberOfSetBits());
+
+    uint64_t nextTimePointIndex = 0;
+    auto recordTimePoints = [&](uint64_t step, std::vector<ValueType> const& markovianValues, std::vector<ValueType> const& probabilisticValues) {
+        for (; nextTimePointIndex < stepsOfTimePoints.size() && stepsOfTimePoints[nextTimePointIndex] == step; ++nextTimePointIndex) {
+            auto& values = result[nextTimePointIndex];
+            values.resize(numberOfStates);
+            storm::utility::vector::setVectorValues<ValueType>(values, psiStates, storm::utility::one<ValueType>());
+            storm::utility::vector::setVectorValues(values, probabilisticNonGoalStates, probabilisticValues);
+            storm::utility::vector::setVectorValues(values, markovianNonGoalStates, markovianValues);
+        }
+    };
+    computeBoundedReachabilityProbabilitiesImca<ValueType>(env, dir, transitionMatrix, exitRateVector, psiStates, markovianNonGoalStates,
+                                                           probabilisticNonGoalStates, vMarkovian, vProbabilistic, delta, numberOfSteps, recordTimePoints);
+    STORM_LOG_THROW(nextTimePointIndex == upperBounds.size(), storm::exceptions::AbortException, "Iterations were aborted before reaching all time points.");
+    return result;
+}
+
 template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
 std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -723,6 +862,32 @@ std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbab
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    STORM_LOG_THROW(phiStates.full(), storm::exceptions::NotSupportedException,
+                    "Computing bounded until probabilities for multiple time points is only supported for (true Until psi).");
+    STORM_LOG_THROW(std::is_sorted(upperBounds.begin(), upperBounds.end()), storm::exceptions::InvalidArgumentException, "The time points must be sorted.");
+    STORM_LOG_THROW(upperBounds.empty() || (upperBounds.front() >= 0.0 && upperBounds.back() < storm::utility::infinity<double>()),
+                    storm::exceptions::InvalidArgumentException, "The time points must be non-negative and finite.");
+    STORM_LOG_WARN_COND(env.solver().timeBounded().getMaMethod() == storm::solver::MaBoundedReachabilityMethod::Imca ||
+                            env.solver().timeBounded().isMaMethodSetFromDefault(),
+                        "Using IMCA method because Unif+ does not support multiple time points.");
+    return computeBoundedUntilProbabilitiesImcaForTimePoints(env, goal.direction(), transitionMatrix, exitRateVector, markovianStates, psiStates,
+                                                             upperBounds);
+}
+
+template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const&, storm::solver::SolveGoal<ValueType>&&, storm::storage::SparseMatrix<ValueType> const&, std::vector<ValueType> const&,
+    storm::storage::BitVector const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<double> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+}
+
 template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -786,6 +951,11 @@ template std::vector<double> SparseMarkovAutomatonCslHelper::computeBoundedUntil
     std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+template std::vector<std::vector<double>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
+    std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds);
+
 template MDPSparseModelCheckingHelperReturnType<double> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
@@ -812,6 +982,11 @@ template std::vector<storm::RationalNumber> SparseMarkovAutomatonCslHelper::comp
     std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+template std::vector<std::vector<storm::RationalNumber>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds);
+
 template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
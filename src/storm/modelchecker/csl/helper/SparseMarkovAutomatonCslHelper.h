@@ -32,6 +32,25 @@ class SparseMarkovAutomatonCslHelper {
                                                                    storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
                                                                    storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+    /*!
+     * Computes the probabilities of satisfying true U[0, t] psi for several time bounds t at once. A single digitization (chosen for the
+     * largest time bound) is used and the values are recorded whenever the iteration passes one of the time bounds.
+     *
+     * @param upperBounds The (sorted) time bounds.
+     * @return For each time bound, the vector of probabilities of all states.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimePoints(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+        storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds);
+
+    template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimePoints(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+        storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds);
+
     template<typename ValueType>
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeUntilProbabilities(Environment const& env, OptimizationDirection dir,
                                                                                        storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
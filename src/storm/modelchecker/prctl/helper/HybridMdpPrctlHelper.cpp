@@ -9,6 +9,7 @@
 #include "storm/storage/dd/Odd.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/dd.h"
 #include "storm/utility/graph.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
@@ -23,6 +24,10 @@
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/Stopwatch.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -65,7 +70,7 @@ std::vector<uint64_t> computeValidInitialSchedulerForUntilProbabilities(storm::s
 
         for (uint64_t state = 0; state < numberOfMaybeStates; ++state) {
             if (!targetStates.get(state)) {
-                result[state] = validScheduler.getChoice(state).getDeterministicChoice();
+                result[state] = validScheduler.getDeterministicChoice(state);
             }
         }
     }
@@ -133,6 +138,111 @@ void eliminateEndComponentsAndExtendedStatesUntilProbabilities(
     }
 }
 
+template<typename ValueType>
+struct SccEquationSystem {
+    storm::dd::Odd odd;
+    storm::storage::BitVector maybeStatePositions;
+    storm::storage::SparseMatrix<ValueType> matrix;
+    std::vector<ValueType> b;
+    std::vector<ValueType> x;
+};
+
+template<storm::dd::DdType DdType, typename ValueType>
+std::vector<ValueType> computeUntilProbabilitiesPerScc(Environment const& env, OptimizationDirection dir,
+                                                       storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model,
+                                                       storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& maybeStates,
+                                                       storm::dd::Bdd<DdType> const& statesWithProbability1, storm::dd::Odd const& odd,
+                                                       bool hasNoEndComponents, bool requireInitialScheduler) {
+    storm::utility::Stopwatch decompositionWatch(true);
+    std::vector<std::vector<storm::dd::Bdd<DdType>>> layers = storm::utility::dd::computeSccLayers(
+        maybeStates, transitionMatrix.notZero().existsAbstract(model.getNondeterminismVariables()), model.getRowVariables(), model.getColumnVariables(),
+        model.getRowColumnMetaVariablePairs());
+    decompositionWatch.stop();
+    STORM_LOG_INFO("Decomposed maybe states into " << layers.size() << " layer(s) of SCCs in " << decompositionWatch.getTimeInMilliseconds() << "ms.");
+
+    // Arithmetic on rational numbers is not guaranteed to be thread-safe, so only double-valued systems are solved concurrently.
+    bool parallel = false;
+#ifdef STORM_HAVE_INTELTBB
+    parallel = std::is_same<ValueType, double>::value && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#endif
+
+    // The values of all states that are already known, as a function over the column variables.
+    storm::dd::Add<DdType, ValueType> knownValues = statesWithProbability1.template toAdd<ValueType>().swapVariables(model.getRowColumnMetaVariablePairs());
+    std::vector<ValueType> result(odd.getTotalOffset(), storm::utility::zero<ValueType>());
+    storm::utility::Stopwatch conversionWatch;
+    storm::utility::Stopwatch solvingWatch;
+    for (auto const& layer : layers) {
+        // The DD operations are not thread-safe, so the equation systems of a layer are translated sequentially. Only the systems of one layer are
+        // stored explicitly at any time.
+        conversionWatch.start();
+        std::vector<SccEquationSystem<ValueType>> systems(layer.size());
+        for (uint64_t index = 0; index < layer.size(); ++index) {
+            SccEquationSystem<ValueType>& system = systems[index];
+            system.odd = layer[index].createOdd();
+            system.maybeStatePositions = layer[index].toVector(odd);
+
+            storm::dd::Add<DdType, ValueType> componentAdd = layer[index].template toAdd<ValueType>();
+            storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * componentAdd;
+            storm::dd::Add<DdType, ValueType> subvector = (submatrix * knownValues).sumAbstract(model.getColumnVariables());
+            submatrix *= componentAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+            std::tie(system.matrix, system.b) = submatrix.toMatrixVector(subvector, model.getNondeterminismVariables(), system.odd, system.odd);
+        }
+        conversionWatch.stop();
+
+        solvingWatch.start();
+        auto solveSystem = [&](SccEquationSystem<ValueType>& system) {
+            system.x.assign(system.matrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+            boost::optional<std::vector<uint64_t>> initialScheduler;
+            if (requireInitialScheduler) {
+                initialScheduler = computeValidInitialSchedulerForUntilProbabilities<ValueType>(system.matrix, system.b);
+            }
+
+            storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+            std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver =
+                linearEquationSolverFactory.create(env, std::move(system.matrix));
+            solver->setHasUniqueSolution(hasNoEndComponents);
+            solver->setHasNoEndComponents(hasNoEndComponents);
+            if (initialScheduler) {
+                solver->setInitialScheduler(std::move(initialScheduler.get()));
+            }
+            solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+            solver->setRequirementsChecked();
+            solver->solveEquations(env, dir, system.x, system.b);
+        };
+        if (parallel && systems.size() > 1) {
+#ifdef STORM_HAVE_INTELTBB
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, systems.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    solveSystem(systems[index]);
+                }
+            });
+#endif
+        } else {
+            for (auto& system : systems) {
+                solveSystem(system);
+            }
+        }
+        solvingWatch.stop();
+
+        // Stream the values back to the result and make them available for the systems of later layers.
+        conversionWatch.start();
+        for (auto const& system : systems) {
+            auto valueIt = system.x.begin();
+            for (auto position : system.maybeStatePositions) {
+                result[position] = *valueIt;
+                ++valueIt;
+            }
+            knownValues += storm::dd::Add<DdType, ValueType>::fromVector(model.getManager(), system.x, system.odd, model.getRowVariables())
+                               .swapVariables(model.getRowColumnMetaVariablePairs());
+        }
+        conversionWatch.stop();
+    }
+    STORM_LOG_INFO("Translating the SCC equation systems took " << conversionWatch.getTimeInMilliseconds() << "ms, solving them took "
+                                                               << solvingWatch.getTimeInMilliseconds() << "ms.");
+
+    return result;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model,
@@ -189,6 +299,17 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUnt
                                 "Solver requirements " + clearedRequirements.getEnabledRequirementsAsString() + " not checked.");
             }
 
+            if (env.modelchecker().isHybridSccDecompositionSet() && !extendMaybeStates) {
+                storm::dd::Odd odd = maybeStates.createOdd();
+                std::vector<ValueType> x = computeUntilProbabilitiesPerScc(env, dir, model, transitionMatrix, maybeStates, statesWithProbability01.second, odd,
+                                                                           hasNoEndComponents, requirements.validInitialScheduler());
+                return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(
+                    model.getReachableStates(), model.getReachableStates() && !maybeStates, statesWithProbability01.second.template toAdd<ValueType>(),
+                    maybeStates, odd, x));
+            }
+            STORM_LOG_WARN_COND(!env.modelchecker().isHybridSccDecompositionSet(),
+                                "Not solving SCC by SCC, because the solver requires the elimination of end components.");
+
             storm::dd::Bdd<DdType> extendedMaybeStates = maybeStates;
             if (extendMaybeStates) {
                 // Extend the maybe states by all non-maybe states that can be reached from a maybe state within one step (they
@@ -466,7 +587,7 @@ std::vector<uint64_t> computeValidInitialSchedulerForReachabilityRewards(storm::
 
     for (uint64_t state = 0; state < numberOfMaybeStates; ++state) {
         if (!targetStates.get(state)) {
-            result[state] = validScheduler.getChoice(state).getDeterministicChoice();
+            result[state] = validScheduler.getDeterministicChoice(state);
         }
     }
 
@@ -173,7 +173,7 @@ std::vector<uint_fast64_t> computeValidSchedulerHint(Environment const& env, Sol
     std::vector<uint_fast64_t> schedulerHint(maybeStates.getNumberOfSetBits());
     auto maybeIt = maybeStates.begin();
     for (auto& choice : schedulerHint) {
-        choice = validScheduler.getChoice(*maybeIt).getDeterministicChoice();
+        choice = validScheduler.getDeterministicChoice(*maybeIt);
         ++maybeIt;
     }
     return schedulerHint;
@@ -274,7 +274,7 @@ void extractValueAndSchedulerHint(SparseMdpHintType<ValueType>& hintStorage, sto
             if (!skipECWithinMaybeStatesCheck) {
                 hintChoices.reserve(maybeStates.size());
                 for (uint_fast64_t state = 0; state < maybeStates.size(); ++state) {
-                    hintChoices.push_back(schedulerHint.getChoice(state).getDeterministicChoice());
+                    hintChoices.push_back(schedulerHint.getDeterministicChoice(state));
                 }
                 hintApplicable =
                     storm::utility::graph::performProb1(transitionMatrix.transposeSelectedRowsFromRowGroups(hintChoices), maybeStates, ~maybeStates).full();
@@ -287,7 +287,7 @@ void extractValueAndSchedulerHint(SparseMdpHintType<ValueType>& hintStorage, sto
                 hintChoices.clear();
                 hintChoices.reserve(maybeStates.getNumberOfSetBits());
                 for (auto state : maybeStates) {
-                    uint_fast64_t hintChoice = schedulerHint.getChoice(state).getDeterministicChoice();
+                    uint_fast64_t hintChoice = schedulerHint.getDeterministicChoice(state);
                     if (selectedChoices) {
                         uint_fast64_t firstChoice = transitionMatrix.getRowGroupIndices()[state];
                         uint_fast64_t lastChoice = firstChoice + hintChoice;
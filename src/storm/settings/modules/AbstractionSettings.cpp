@@ -308,6 +308,18 @@ AbstractionSettings::ReuseMode AbstractionSettings::getReuseMode() const {
     return ReuseMode::All;
 }
 
+void AbstractionSettings::setReuseMode(ReuseMode mode) {
+    std::string modeAsString = "all";
+    if (mode == ReuseMode::None) {
+        modeAsString = "none";
+    } else if (mode == ReuseMode::Qualitative) {
+        modeAsString = "qualitative";
+    } else if (mode == ReuseMode::Quantitative) {
+        modeAsString = "quantitative";
+    }
+    this->getOption(reuseResultsOptionName).getArgumentByName("mode").setFromStringValue(modeAsString);
+}
+
 uint_fast64_t AbstractionSettings::getMaximalAbstractionCount() const {
     return this->getOption(maximalAbstractionOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
 }
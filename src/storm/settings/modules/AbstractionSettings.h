@@ -108,6 +108,13 @@ class AbstractionSettings : public ModuleSettings {
      */
     ReuseMode getReuseMode() const;
 
+    /*!
+     * Sets the reuse mode to the specified value.
+     *
+     * @param mode The new reuse mode.
+     */
+    void setReuseMode(ReuseMode mode);
+
     /*!
      * Retrieves whether only relevant states are to be considered.
      *
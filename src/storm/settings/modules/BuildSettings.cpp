@@ -20,6 +20,9 @@ const std::string BuildSettings::moduleName = "build";
 
 const std::string explorationOrderOptionName = "explorder";
 const std::string explorationOrderOptionShortName = "eo";
+const std::string ddReachabilityMethodOptionName = "ddreach";
+const std::string ddVariableOrderingOptionName = "ddvarorder";
+const std::string ddSparseStateOrderOptionName = "ddsparseorder";
 const std::string explorationChecksOptionName = "explchecks";
 const std::string explorationChecksOptionShortName = "ec";
 const std::string prismCompatibilityOptionName = "prismcompat";
@@ -75,6 +78,38 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("bfs")
                                          .build())
                         .build());
+    std::vector<std::string> ddReachabilityMethods = {"bfs", "chaining", "chaining-restart"};
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, ddReachabilityMethodOptionName, false,
+                                       "Sets the method to compute the reachable states when building symbolic models. The chaining methods apply the "
+                                       "transition relation partitioned by modules and actions. With restart, each part is applied until no new states are found "
+                                       "and the first part is applied again afterwards.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.")
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddReachabilityMethods))
+                             .setDefaultValueString("bfs")
+                             .build())
+            .build());
+    std::vector<std::string> ddVariableOrderingHeuristics = {"declaration", "force"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderingOptionName, false,
+                                                   "Sets the heuristic that statically orders the variables when building symbolic models. 'force' places "
+                                                   "variables that occur in the same command (or edge) close to each other.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the heuristic to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderingHeuristics))
+                                         .setDefaultValueString("declaration")
+                                         .build())
+                        .build());
+    std::vector<std::string> ddSparseStateOrders = {"odd", "bfs", "rcm"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddSparseStateOrderOptionName, false,
+                                                   "Sets the order of the states when translating a symbolic model to a sparse model (dd-to-sparse engine). "
+                                                   "'bfs' and 'rcm' (reverse Cuthill-McKee) store the successors of a state close to it.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the order to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddSparseStateOrders))
+                                         .setDefaultValueString("odd")
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false,
                                                    "If set, additional checks (if available) are performed during model exploration to debug the model.")
                         .setShortName(explorationChecksOptionShortName)
@@ -174,6 +209,40 @@ storm::builder::ExplorationOrder BuildSettings::getExplorationOrder() const {
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
 }
 
+storm::builder::DdReachabilityMethod BuildSettings::getDdReachabilityMethod() const {
+    std::string methodAsString = this->getOption(ddReachabilityMethodOptionName).getArgumentByName("name").getValueAsString();
+    if (methodAsString == "bfs") {
+        return storm::builder::DdReachabilityMethod::Bfs;
+    } else if (methodAsString == "chaining") {
+        return storm::builder::DdReachabilityMethod::Chaining;
+    } else if (methodAsString == "chaining-restart") {
+        return storm::builder::DdReachabilityMethod::ChainingWithRestart;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown reachability method '" << methodAsString << "'.");
+}
+
+storm::builder::DdVariableOrderingHeuristic BuildSettings::getDdVariableOrderingHeuristic() const {
+    std::string heuristicAsString = this->getOption(ddVariableOrderingOptionName).getArgumentByName("name").getValueAsString();
+    if (heuristicAsString == "declaration") {
+        return storm::builder::DdVariableOrderingHeuristic::Declaration;
+    } else if (heuristicAsString == "force") {
+        return storm::builder::DdVariableOrderingHeuristic::Force;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown variable ordering heuristic '" << heuristicAsString << "'.");
+}
+
+storm::transformer::SparseStateOrder BuildSettings::getDdSparseStateOrder() const {
+    std::string orderAsString = this->getOption(ddSparseStateOrderOptionName).getArgumentByName("name").getValueAsString();
+    if (orderAsString == "odd") {
+        return storm::transformer::SparseStateOrder::Odd;
+    } else if (orderAsString == "bfs") {
+        return storm::transformer::SparseStateOrder::Bfs;
+    } else if (orderAsString == "rcm") {
+        return storm::transformer::SparseStateOrder::ReverseCuthillMcKee;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown state order '" << orderAsString << "'.");
+}
+
 bool BuildSettings::isExplorationChecksSet() const {
     return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
 }
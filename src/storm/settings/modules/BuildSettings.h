@@ -1,8 +1,11 @@
 #pragma once
 
 #include "storm-config.h"
+#include "storm/builder/DdReachabilityMethod.h"
+#include "storm/builder/DdVariableOrderingHeuristic.h"
 #include "storm/builder/ExplorationOrder.h"
 #include "storm/settings/modules/ModuleSettings.h"
+#include "storm/transformer/SparseStateOrder.h"
 
 namespace storm {
 namespace settings {
@@ -35,6 +38,27 @@ class BuildSettings : public ModuleSettings {
      */
     storm::builder::ExplorationOrder getExplorationOrder() const;
 
+    /*!
+     * Retrieves the method that is used to compute the reachable states when building symbolic models.
+     *
+     * @return The chosen method.
+     */
+    storm::builder::DdReachabilityMethod getDdReachabilityMethod() const;
+
+    /*!
+     * Retrieves the heuristic that is used to statically order the variables when building symbolic models.
+     *
+     * @return The chosen heuristic.
+     */
+    storm::builder::DdVariableOrderingHeuristic getDdVariableOrderingHeuristic() const;
+
+    /*!
+     * Retrieves the order of the states when translating a symbolic model to a sparse model.
+     *
+     * @return The chosen order.
+     */
+    storm::transformer::SparseStateOrder getDdSparseStateOrder() const;
+
     /*!
      * Retrieves whether the PRISM compatibility mode was enabled.
      *
@@ -164,6 +164,10 @@ bool CoreSettings::isUseIntelTbbSet() const {
     return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
 }
 
+std::unique_ptr<storm::settings::SettingMemento> CoreSettings::overrideUseIntelTbbSet(bool stateToSet) {
+    return this->overrideOption(intelTbbOptionName, stateToSet);
+}
+
 bool CoreSettings::isUseCudaSet() const {
     return this->getOption(cudaOptionName).getHasOptionBeenSet();
 }
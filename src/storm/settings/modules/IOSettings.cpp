@@ -1,5 +1,7 @@
 #include "storm/settings/modules/IOSettings.h"
 
+#include <algorithm>
+
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/parser/CSVParser.h"
 #include "storm/settings/Argument.h"
@@ -49,6 +51,8 @@ const std::string IOSettings::propertyOptionName = "prop";
 const std::string IOSettings::propertyOptionShortName = "prop";
 const std::string IOSettings::steadyStateDistrOptionName = "steadystate";
 const std::string IOSettings::expectedVisitingTimesOptionName = "expvisittimes";
+const std::string IOSettings::timePointsOptionName = "timepoints";
+const std::string IOSettings::exportCurveOptionName = "exportcurve";
 
 const std::string IOSettings::qvbsInputOptionName = "qvbs";
 const std::string IOSettings::qvbsInputOptionShortName = "qvbs";
@@ -230,6 +234,19 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                                        exportCheckResultOptionName + ".")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, timePointsOptionName, false,
+                                                   "Evaluates the time-bounded properties for each of the given time points in a single pass (replacing their upper "
+                                                   "time bound). The values are printed in csv format or exported using --" +
+                                                       exportCurveOptionName + ".")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A comma separated list of time points.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportCurveOptionName, false,
+                                                   "Exports the values computed for the time points given by --" + timePointsOptionName +
+                                                       " to the given file in csv format.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build())
+                        .build());
 
     this->addOption(storm::settings::OptionBuilder(moduleName, qvbsInputOptionName, false, "Selects a model from the Quantitative Verification Benchmark Set.")
                         .setShortName(qvbsInputOptionShortName)
@@ -463,6 +480,33 @@ bool IOSettings::isComputeExpectedVisitingTimesSet() const {
     return this->getOption(expectedVisitingTimesOptionName).getHasOptionBeenSet();
 }
 
+bool IOSettings::isTimePointsSet() const {
+    return this->getOption(timePointsOptionName).getHasOptionBeenSet();
+}
+
+std::vector<double> IOSettings::getTimePoints() const {
+    std::vector<double> result;
+    for (auto const& value :
+         storm::parser::parseCommaSeperatedValues(this->getOption(timePointsOptionName).getArgumentByName("values").getValueAsString())) {
+        try {
+            result.push_back(std::stod(value));
+        } catch (std::exception const&) {
+            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unable to parse time point '" << value << "'.");
+        }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+bool IOSettings::isExportCurveSet() const {
+    return this->getOption(exportCurveOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExportCurveFilename() const {
+    return this->getOption(exportCurveOptionName).getArgumentByName("filename").getValueAsString();
+}
+
 bool IOSettings::isQvbsInputSet() const {
     return this->getOption(qvbsInputOptionName).getHasOptionBeenSet();
 }
@@ -533,6 +577,9 @@ bool IOSettings::check() const {
     STORM_LOG_THROW(!isPrismToJaniSet() || isPrismInputSet(), storm::exceptions::InvalidSettingsException,
                     "For the transformation from PRISM to JANI, the input model must be given in the prism format.");
 
+    STORM_LOG_THROW(!isExportCurveSet() || isTimePointsSet(), storm::exceptions::InvalidSettingsException,
+                    "Exporting a curve requires time points (given by --" << timePointsOptionName << ").");
+
     return true;
 }
 
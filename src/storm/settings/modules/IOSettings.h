@@ -338,6 +338,26 @@ class IOSettings : public ModuleSettings {
      */
     bool isComputeExpectedVisitingTimesSet() const;
 
+    /*!
+     * Retrieves whether time-bounded properties are to be evaluated for multiple time points.
+     */
+    bool isTimePointsSet() const;
+
+    /*!
+     * Retrieves the (sorted) time points for which time-bounded properties are to be evaluated.
+     */
+    std::vector<double> getTimePoints() const;
+
+    /*!
+     * Retrieves whether the values for multiple time points are to be exported to a file.
+     */
+    bool isExportCurveSet() const;
+
+    /*!
+     * Retrieves the name of the file to which the values for multiple time points are to be exported (in csv format).
+     */
+    std::string getExportCurveFilename() const;
+
     /*!
      * Retrieves whether the input model is to be read from the quantitative verification benchmark set (QVBS)
      */
@@ -406,6 +426,8 @@ class IOSettings : public ModuleSettings {
     static const std::string propertyOptionShortName;
     static const std::string steadyStateDistrOptionName;
     static const std::string expectedVisitingTimesOptionName;
+    static const std::string timePointsOptionName;
+    static const std::string exportCurveOptionName;
     static const std::string qvbsInputOptionName;
     static const std::string qvbsInputOptionShortName;
     static const std::string qvbsRootOptionName;
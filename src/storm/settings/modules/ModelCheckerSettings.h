@@ -35,6 +35,13 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves whether the hybrid engine is to solve the equation systems SCC by SCC.
+     *
+     * @return True iff the option was set.
+     */
+    bool isHybridSccDecompositionSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +49,7 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string hybridSccDecompositionOptionName;
 };
 
 }  // namespace modules
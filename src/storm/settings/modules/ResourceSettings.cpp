@@ -16,6 +16,7 @@ const std::string ResourceSettings::timeoutOptionShortName = "t";
 const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
 const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
 const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
+const std::string ResourceSettings::ddMemoryBudgetOptionName = "dd-memory-budget";
 
 ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.")
@@ -35,6 +36,16 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(3)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddMemoryBudgetOptionName, false,
+                                                   "If given, the memory of the DD library is kept within the given budget. Garbage collections are "
+                                                   "triggered and caches are shrunk when approaching the budget and the computation is aborted with a "
+                                                   "diagnostic if the budget is exhausted.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "value", "The memory budget in MB (0 means the memory limit of the control group of the process).")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
 }
 
 bool ResourceSettings::isTimeoutSet() const {
@@ -53,6 +64,14 @@ uint_fast64_t ResourceSettings::getSignalWaitingTimeInSeconds() const {
     return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+bool ResourceSettings::isDdMemoryBudgetSet() const {
+    return this->getOption(ddMemoryBudgetOptionName).getHasOptionBeenSet();
+}
+
+uint_fast64_t ResourceSettings::getDdMemoryBudget() const {
+    return this->getOption(ddMemoryBudgetOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
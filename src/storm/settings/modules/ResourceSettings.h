@@ -47,6 +47,21 @@ class ResourceSettings : public ModuleSettings {
      */
     uint_fast64_t getSignalWaitingTimeInSeconds() const;
 
+    /*!
+     * Retrieves whether a memory budget for the DD library was set.
+     *
+     * @return True iff the option was set.
+     */
+    bool isDdMemoryBudgetSet() const;
+
+    /*!
+     * Retrieves the memory budget (in MB) for the DD library. A value of zero means that the memory limit of the
+     * control group of the process is to be used.
+     *
+     * @return The memory budget in MB.
+     */
+    uint_fast64_t getDdMemoryBudget() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -57,6 +72,7 @@ class ResourceSettings : public ModuleSettings {
     static const std::string printTimeAndMemoryOptionName;
     static const std::string printTimeAndMemoryOptionShortName;
     static const std::string signalWaitingTimeOptionName;
+    static const std::string ddMemoryBudgetOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -1,5 +1,6 @@
 #include "storm/settings/modules/SylvanSettings.h"
 
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/settings/Argument.h"
@@ -14,6 +15,7 @@ namespace modules {
 const std::string SylvanSettings::moduleName = "sylvan";
 const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
 const std::string SylvanSettings::threadCountOptionName = "threads";
+const std::string SylvanSettings::statisticsOptionName = "stats";
 
 SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.")
@@ -28,6 +30,11 @@ SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
                                          "value", "The number of threads available to Sylvan (0 means 'auto-detect').")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, statisticsOptionName, true,
+                                                   "If set, statistics about the DD traversals (visited nodes per Lace worker) and, if Sylvan was built with "
+                                                   "SYLVAN_STATS, about Sylvan's operations and caches are printed when Sylvan is shut down.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 uint_fast64_t SylvanSettings::getMaximalMemory() const {
@@ -42,6 +49,14 @@ uint_fast64_t SylvanSettings::getNumberOfThreads() const {
     return this->getOption(threadCountOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
 }
 
+bool SylvanSettings::isPrintStatisticsSet() const {
+    return this->getOption(statisticsOptionName).getHasOptionBeenSet();
+}
+
+std::unique_ptr<storm::settings::SettingMemento> SylvanSettings::overridePrintStatisticsSet(bool stateToSet) {
+    return this->overrideOption(statisticsOptionName, stateToSet);
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
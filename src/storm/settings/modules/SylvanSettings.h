@@ -37,6 +37,20 @@ class SylvanSettings : public ModuleSettings {
      */
     bool isNumberOfThreadsSet() const;
 
+    /*!
+     * Retrieves whether statistics about the DD operations are to be printed when Sylvan is shut down.
+     */
+    bool isPrintStatisticsSet() const;
+
+    /*!
+     * Overrides the option to print statistics by setting it to the specified value. As soon as the returned memento
+     * goes out of scope, the original value is restored.
+     *
+     * @param stateToSet The value that is to be set for the option to print statistics.
+     * @return The memento that will eventually restore the original value.
+     */
+    std::unique_ptr<storm::settings::SettingMemento> overridePrintStatisticsSet(bool stateToSet);
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -44,6 +58,7 @@ class SylvanSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string maximalMemoryOptionName;
     static const std::string threadCountOptionName;
+    static const std::string statisticsOptionName;
 };
 
 }  // namespace modules
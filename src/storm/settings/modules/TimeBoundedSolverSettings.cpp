@@ -16,6 +16,10 @@ const std::string TimeBoundedSolverSettings::maMethodOptionName = "mamethod";
 const std::string TimeBoundedSolverSettings::precisionOptionName = "precision";
 const std::string TimeBoundedSolverSettings::absoluteOptionName = "absolute";
 const std::string TimeBoundedSolverSettings::unifPlusKappaOptionName = "kappa";
+const std::string TimeBoundedSolverSettings::ctmcMethodOptionName = "ctmcmethod";
+const std::string TimeBoundedSolverSettings::adaptiveStepsOptionName = "adaptivesteps";
+const std::string TimeBoundedSolverSettings::steadyStateDetectionOptionName = "steadystate";
+const std::string TimeBoundedSolverSettings::activeSupportOptionName = "activesupport";
 
 TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> maMethods = {"imca", "unifplus"};
@@ -48,6 +52,34 @@ TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleNa
                              .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                              .build())
             .build());
+
+    std::vector<std::string> ctmcMethods = {"uniformization", "adaptive"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ctmcMethodOptionName, false, "The method to use to compute transient probabilities on CTMCs.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ctmcMethods))
+                                         .setDefaultValueString("uniformization")
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, adaptiveStepsOptionName, false,
+                                                   "The maximal number of time steps (each with its own uniformization rate) used for adaptive uniformization.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of steps.")
+                                         .setDefaultValueUnsignedInteger(8)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, steadyStateDetectionOptionName, false,
+                                                   "If set, transient iterations on CTMCs stop early once the values are stationary up to the precision.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, activeSupportOptionName, false,
+                                                   "If set, transient iterations on CTMCs only consider states whose values can already be non-zero.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool TimeBoundedSolverSettings::isPrecisionSet() const {
@@ -79,6 +111,26 @@ double TimeBoundedSolverSettings::getUnifPlusKappa() const {
     return this->getOption(unifPlusKappaOptionName).getArgumentByName("kappa").getValueAsDouble();
 }
 
+storm::solver::CtmcTransientMethod TimeBoundedSolverSettings::getCtmcMethod() const {
+    std::string techniqueAsString = this->getOption(ctmcMethodOptionName).getArgumentByName("name").getValueAsString();
+    if (techniqueAsString == "adaptive") {
+        return storm::solver::CtmcTransientMethod::AdaptiveUniformization;
+    }
+    return storm::solver::CtmcTransientMethod::Uniformization;
+}
+
+uint64_t TimeBoundedSolverSettings::getAdaptiveUniformizationSteps() const {
+    return this->getOption(adaptiveStepsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool TimeBoundedSolverSettings::isSteadyStateDetectionSet() const {
+    return this->getOption(steadyStateDetectionOptionName).getHasOptionBeenSet();
+}
+
+bool TimeBoundedSolverSettings::isRestrictToActiveSupportSet() const {
+    return this->getOption(activeSupportOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -50,6 +50,26 @@ class TimeBoundedSolverSettings : public ModuleSettings {
      */
     double getUnifPlusKappa() const;
 
+    /*!
+     * Retrieves the selected technique for computing transient probabilities on CTMCs.
+     */
+    storm::solver::CtmcTransientMethod getCtmcMethod() const;
+
+    /*!
+     * Retrieves the number of time steps used for adaptive uniformization.
+     */
+    uint64_t getAdaptiveUniformizationSteps() const;
+
+    /*!
+     * Retrieves whether iterations on CTMCs are stopped as soon as the values provably do not change anymore (within the precision).
+     */
+    bool isSteadyStateDetectionSet() const;
+
+    /*!
+     * Retrieves whether iterations on CTMCs are restricted to states whose values can be non-zero.
+     */
+    bool isRestrictToActiveSupportSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -58,6 +78,10 @@ class TimeBoundedSolverSettings : public ModuleSettings {
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string unifPlusKappaOptionName;
+    static const std::string ctmcMethodOptionName;
+    static const std::string adaptiveStepsOptionName;
+    static const std::string steadyStateDetectionOptionName;
+    static const std::string activeSupportOptionName;
 };
 
 }  // namespace modules
@@ -74,6 +74,16 @@ std::string toString(MaBoundedReachabilityMethod m) {
     return "invalid";
 }
 
+std::string toString(CtmcTransientMethod m) {
+    switch (m) {
+        case CtmcTransientMethod::Uniformization:
+            return "uniformization";
+        case CtmcTransientMethod::AdaptiveUniformization:
+            return "adaptive";
+    }
+    return "invalid";
+}
+
 std::string toString(LpSolverType t) {
     switch (t) {
         case LpSolverType::Gurobi:
@@ -3,6 +3,7 @@
 
 #include <boost/algorithm/string/join.hpp>
 #include "storm/adapters/JsonAdapter.h"
+#include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/utility/macros.h"
 
@@ -11,9 +12,12 @@ namespace storage {
 
 template<typename ValueType>
 Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure> const& memoryStructure)
-    : memoryStructure(memoryStructure) {
-    uint_fast64_t numOfMemoryStates = memoryStructure ? memoryStructure->getNumberOfStates() : 1;
-    schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+    : memoryStructure(memoryStructure), numberOfModelStates(numberOfModelStates) {
+    uint_fast64_t numOfMemoryStates = this->memoryStructure ? this->memoryStructure->getNumberOfStates() : 1;
+    // Initially, all choices are undefined and can thus be stored compactly.
+    compactChoicesUsed = true;
+    bitsPerCompactChoice = 1;
+    compactChoices = storm::storage::BitVector(numOfMemoryStates * numberOfModelStates * bitsPerCompactChoice, false);
     dontCareStates = std::vector<storm::storage::BitVector>(numOfMemoryStates, storm::storage::BitVector(numberOfModelStates, false));
     numOfUndefinedChoices = numOfMemoryStates * numberOfModelStates;
     numOfDeterministicChoices = 0;
@@ -22,19 +26,100 @@ Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::option
 
 template<typename ValueType>
 Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure>&& memoryStructure)
-    : memoryStructure(std::move(memoryStructure)) {
+    : memoryStructure(std::move(memoryStructure)), numberOfModelStates(numberOfModelStates) {
     uint_fast64_t numOfMemoryStates = this->memoryStructure ? this->memoryStructure->getNumberOfStates() : 1;
-    schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+    // Initially, all choices are undefined and can thus be stored compactly.
+    compactChoicesUsed = true;
+    bitsPerCompactChoice = 1;
+    compactChoices = storm::storage::BitVector(numOfMemoryStates * numberOfModelStates * bitsPerCompactChoice, false);
     dontCareStates = std::vector<storm::storage::BitVector>(numOfMemoryStates, storm::storage::BitVector(numberOfModelStates, false));
     numOfUndefinedChoices = numOfMemoryStates * numberOfModelStates;
     numOfDeterministicChoices = 0;
     numOfDontCareStates = 0;
 }
 
+template<typename ValueType>
+uint_fast64_t Scheduler<ValueType>::getCompactChoiceIndex(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+    return memoryState * numberOfModelStates + modelState;
+}
+
+template<typename ValueType>
+boost::optional<uint_fast64_t> Scheduler<ValueType>::getCompactChoice(uint_fast64_t compactChoiceIndex) const {
+    uint_fast64_t storedValue = compactChoices.getAsInt(compactChoiceIndex * bitsPerCompactChoice, bitsPerCompactChoice);
+    if (storedValue == 0) {
+        return boost::none;
+    }
+    return storedValue - 1;
+}
+
+template<typename ValueType>
+void Scheduler<ValueType>::setCompactChoice(uint_fast64_t compactChoiceIndex, boost::optional<uint_fast64_t> const& choice) {
+    uint_fast64_t valueToStore = choice ? choice.get() + 1 : 0;
+    STORM_LOG_THROW(!choice || valueToStore > choice.get(), storm::exceptions::InvalidOperationException, "Choice index " << choice.get() << " is too large.");
+    uint_fast64_t requiredBits = 1;
+    while (requiredBits < 64 && (valueToStore >> requiredBits) != 0) {
+        ++requiredBits;
+    }
+    if (requiredBits > bitsPerCompactChoice) {
+        // Widen the storage. Doubling the width ensures that the storage is rebuilt at most a few times.
+        uint_fast64_t newBitsPerCompactChoice = std::min<uint_fast64_t>(64, std::max(requiredBits, 2 * bitsPerCompactChoice));
+        uint_fast64_t numberOfEntries = compactChoices.size() / bitsPerCompactChoice;
+        storm::storage::BitVector newCompactChoices(numberOfEntries * newBitsPerCompactChoice, false);
+        for (uint_fast64_t entry = 0; entry < numberOfEntries; ++entry) {
+            uint_fast64_t storedValue = compactChoices.getAsInt(entry * bitsPerCompactChoice, bitsPerCompactChoice);
+            if (storedValue != 0) {
+                newCompactChoices.setFromInt(entry * newBitsPerCompactChoice, newBitsPerCompactChoice, storedValue);
+            }
+        }
+        compactChoices = std::move(newCompactChoices);
+        bitsPerCompactChoice = newBitsPerCompactChoice;
+    }
+    compactChoices.setFromInt(compactChoiceIndex * bitsPerCompactChoice, bitsPerCompactChoice, valueToStore);
+}
+
+template<typename ValueType>
+void Scheduler<ValueType>::convertToExplicitChoices() {
+    STORM_LOG_ASSERT(compactChoicesUsed, "Choices are already stored explicitly.");
+    schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(getNumberOfMemoryStates(),
+                                                                            std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+    for (uint_fast64_t memoryState = 0; memoryState < getNumberOfMemoryStates(); ++memoryState) {
+        for (uint_fast64_t modelState = 0; modelState < numberOfModelStates; ++modelState) {
+            auto choice = getCompactChoice(getCompactChoiceIndex(modelState, memoryState));
+            if (choice) {
+                schedulerChoices[memoryState][modelState] = SchedulerChoice<ValueType>(choice.get());
+            }
+        }
+    }
+    compactChoices = storm::storage::BitVector();
+    bitsPerCompactChoice = 1;
+    compactChoicesUsed = false;
+}
+
 template<typename ValueType>
 void Scheduler<ValueType>::setChoice(SchedulerChoice<ValueType> const& choice, uint_fast64_t modelState, uint_fast64_t memoryState) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+
+    if (compactChoicesUsed && choice.isDefined() && !choice.isDeterministic()) {
+        STORM_LOG_TRACE("Switching to explicit representation of scheduler choices due to a randomized choice.");
+        convertToExplicitChoices();
+    }
+
+    if (compactChoicesUsed) {
+        uint_fast64_t compactChoiceIndex = getCompactChoiceIndex(modelState, memoryState);
+        bool wasDefined = static_cast<bool>(getCompactChoice(compactChoiceIndex));
+        if (wasDefined && !choice.isDefined()) {
+            ++numOfUndefinedChoices;
+            assert(numOfDeterministicChoices > 0);
+            --numOfDeterministicChoices;
+        } else if (!wasDefined && choice.isDefined()) {
+            assert(numOfUndefinedChoices > 0);
+            --numOfUndefinedChoices;
+            ++numOfDeterministicChoices;
+        }
+        setCompactChoice(compactChoiceIndex, choice.isDefined() ? boost::optional<uint_fast64_t>(choice.getDeterministicChoice()) : boost::none);
+        return;
+    }
 
     auto& schedulerChoice = schedulerChoices[memoryState][modelState];
 
@@ -65,8 +150,11 @@ void Scheduler<ValueType>::setChoice(SchedulerChoice<ValueType> const& choice, u
 template<typename ValueType>
 bool Scheduler<ValueType>::isChoiceSelected(BitVector const& selectedStates, uint64_t memoryState) const {
     for (auto selectedState : selectedStates) {
-        auto& schedulerChoice = schedulerChoices[memoryState][selectedState];
-        if (!schedulerChoice.isDefined()) {
+        if (compactChoicesUsed) {
+            if (!getCompactChoice(getCompactChoiceIndex(selectedState, memoryState))) {
+                return false;
+            }
+        } else if (!schedulerChoices[memoryState][selectedState].isDefined()) {
             return false;
         }
     }
@@ -76,25 +164,62 @@ bool Scheduler<ValueType>::isChoiceSelected(BitVector const& selectedStates, uin
 template<typename ValueType>
 void Scheduler<ValueType>::clearChoice(uint_fast64_t modelState, uint_fast64_t memoryState) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
     setChoice(SchedulerChoice<ValueType>(), modelState, memoryState);
 }
 
 template<typename ValueType>
-SchedulerChoice<ValueType> const& Scheduler<ValueType>::getChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+SchedulerChoice<ValueType> Scheduler<ValueType>::getChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+    if (compactChoicesUsed) {
+        auto choice = getCompactChoice(getCompactChoiceIndex(modelState, memoryState));
+        return choice ? SchedulerChoice<ValueType>(choice.get()) : SchedulerChoice<ValueType>();
+    }
     return schedulerChoices[memoryState][modelState];
 }
 
+template<typename ValueType>
+bool Scheduler<ValueType>::isChoiceDefined(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+    STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+    if (compactChoicesUsed) {
+        return static_cast<bool>(getCompactChoice(getCompactChoiceIndex(modelState, memoryState)));
+    }
+    return schedulerChoices[memoryState][modelState].isDefined();
+}
+
+template<typename ValueType>
+bool Scheduler<ValueType>::isChoiceDeterministic(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+    STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+    if (compactChoicesUsed) {
+        // All defined choices are deterministic in the compact representation.
+        return static_cast<bool>(getCompactChoice(getCompactChoiceIndex(modelState, memoryState)));
+    }
+    return schedulerChoices[memoryState][modelState].isDeterministic();
+}
+
+template<typename ValueType>
+uint_fast64_t Scheduler<ValueType>::getDeterministicChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+    STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+    if (compactChoicesUsed) {
+        auto choice = getCompactChoice(getCompactChoiceIndex(modelState, memoryState));
+        STORM_LOG_THROW(choice, storm::exceptions::InvalidOperationException,
+                        "Tried to obtain the deterministic choice of a scheduler, but the choice is not deterministic");
+        return choice.get();
+    }
+    return schedulerChoices[memoryState][modelState].getDeterministicChoice();
+}
+
 template<typename ValueType>
 void Scheduler<ValueType>::setDontCare(uint_fast64_t modelState, uint_fast64_t memoryState, bool setArbitraryChoice) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
 
     if (!dontCareStates[memoryState].get(modelState)) {
-        auto& schedulerChoice = schedulerChoices[memoryState][modelState];
-        if (!schedulerChoice.isDefined() && setArbitraryChoice) {
+        if (setArbitraryChoice && !isChoiceDefined(modelState, memoryState)) {
             // Set an arbitrary choice
             this->setChoice(0, modelState, memoryState);
         }
@@ -106,7 +231,7 @@ void Scheduler<ValueType>::setDontCare(uint_fast64_t modelState, uint_fast64_t m
 template<typename ValueType>
 void Scheduler<ValueType>::unSetDontCare(uint_fast64_t modelState, uint_fast64_t memoryState) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
 
     if (dontCareStates[memoryState].get(modelState)) {
         dontCareStates[memoryState].set(modelState, false);
@@ -124,10 +249,21 @@ storm::storage::BitVector Scheduler<ValueType>::computeActionSupport(std::vector
     auto nrActions = nondeterministicChoiceIndices.back();
     storm::storage::BitVector result(nrActions);
 
-    for (auto const& choicesPerMemoryNode : schedulerChoices) {
-        STORM_LOG_ASSERT(nondeterministicChoiceIndices.size() - 2 < choicesPerMemoryNode.size(), "Illegal model state index");
+    STORM_LOG_ASSERT(nondeterministicChoiceIndices.size() - 2 < numberOfModelStates, "Illegal model state index");
+    for (uint64_t memoryState = 0; memoryState < getNumberOfMemoryStates(); ++memoryState) {
         for (uint64_t stateId = 0; stateId < nondeterministicChoiceIndices.size() - 1; ++stateId) {
-            for (auto const& schedChoice : choicesPerMemoryNode[stateId].getChoiceAsDistribution()) {
+            if (compactChoicesUsed) {
+                auto choice = getCompactChoice(getCompactChoiceIndex(stateId, memoryState));
+                if (choice) {
+                    STORM_LOG_ASSERT(choice.get() < nondeterministicChoiceIndices[stateId + 1] - nondeterministicChoiceIndices[stateId],
+                                     "Scheduler chooses action indexed " << choice.get() << " in state id " << stateId << " but state contains only "
+                                                                         << nondeterministicChoiceIndices[stateId + 1] - nondeterministicChoiceIndices[stateId]
+                                                                         << " choices .");
+                    result.set(nondeterministicChoiceIndices[stateId] + choice.get());
+                }
+                continue;
+            }
+            for (auto const& schedChoice : schedulerChoices[memoryState][stateId].getChoiceAsDistribution()) {
                 STORM_LOG_ASSERT(schedChoice.first < nondeterministicChoiceIndices[stateId + 1] - nondeterministicChoiceIndices[stateId],
                                  "Scheduler chooses action indexed " << schedChoice.first << " in state id " << stateId << " but state contains only "
                                                                      << nondeterministicChoiceIndices[stateId + 1] - nondeterministicChoiceIndices[stateId]
@@ -146,7 +282,7 @@ bool Scheduler<ValueType>::isPartialScheduler() const {
 
 template<typename ValueType>
 bool Scheduler<ValueType>::isDeterministicScheduler() const {
-    return numOfDeterministicChoices == (schedulerChoices.size() * schedulerChoices.begin()->size()) - numOfUndefinedChoices;
+    return numOfDeterministicChoices == (getNumberOfMemoryStates() * numberOfModelStates) - numOfUndefinedChoices;
 }
 
 template<typename ValueType>
@@ -167,15 +303,15 @@ boost::optional<storm::storage::MemoryStructure> const& Scheduler<ValueType>::ge
 template<typename ValueType>
 void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices,
                                          bool skipDontCareStates) const {
-    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == schedulerChoices.front().size(), storm::exceptions::InvalidOperationException,
+    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == numberOfModelStates, storm::exceptions::InvalidOperationException,
                     "The given model is not compatible with this scheduler.");
 
     bool const stateValuationsGiven = model != nullptr && model->hasStateValuations();
     bool const choiceLabelsGiven = model != nullptr && model->hasChoiceLabeling();
     bool const choiceOriginsGiven = model != nullptr && model->hasChoiceOrigins();
-    uint_fast64_t widthOfStates = std::to_string(schedulerChoices.front().size()).length();
+    uint_fast64_t widthOfStates = std::to_string(numberOfModelStates).length();
     if (stateValuationsGiven) {
-        widthOfStates += model->getStateValuations().getStateInfo(schedulerChoices.front().size() - 1).length() + 5;
+        widthOfStates += model->getStateValuations().getStateInfo(numberOfModelStates - 1).length() + 5;
     }
     widthOfStates = std::max(widthOfStates, (uint_fast64_t)12);
     uint_fast64_t numOfSkippedStatesWithUniqueChoice = 0;
@@ -191,7 +327,7 @@ void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<stor
     STORM_LOG_WARN_COND(!(skipUniqueChoices && model == nullptr), "Can not skip unique choices if the model is not given.");
     out << std::setw(widthOfStates) << "model state:"
         << "    " << (isMemorylessScheduler() ? "" : " memory:     ") << "choice(s)" << (isMemorylessScheduler() ? "" : "     memory updates:     ") << '\n';
-    for (uint_fast64_t state = 0; state < schedulerChoices.front().size(); ++state) {
+    for (uint_fast64_t state = 0; state < numberOfModelStates; ++state) {
         // Check whether the state is skipped
         if (skipUniqueChoices && model != nullptr && model->getTransitionMatrix().getRowGroupSize(state) == 1) {
             ++numOfSkippedStatesWithUniqueChoice;
@@ -226,7 +362,7 @@ void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<stor
             }
 
             // Print choice info
-            SchedulerChoice<ValueType> const& choice = schedulerChoices[memoryState][state];
+            SchedulerChoice<ValueType> choice = getChoice(state, memoryState);
             if (choice.isDefined()) {
                 if (choice.isDeterministic()) {
                     if (choiceOriginsGiven) {
@@ -306,11 +442,13 @@ void Scheduler<float>::printJsonToStream(std::ostream& out, std::shared_ptr<stor
 template<typename ValueType>
 void Scheduler<ValueType>::printJsonToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices,
                                              bool skipDontCareStates) const {
-    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == schedulerChoices.front().size(), storm::exceptions::InvalidOperationException,
+    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == numberOfModelStates, storm::exceptions::InvalidOperationException,
                     "The given model is not compatible with this scheduler.");
     STORM_LOG_WARN_COND(!(skipUniqueChoices && model == nullptr), "Can not skip unique choices if the model is not given.");
-    storm::json<storm::RationalNumber> output;
-    for (uint64_t state = 0; state < schedulerChoices.front().size(); ++state) {
+    // The entries are written directly to the stream to avoid building the json representation of the whole scheduler in memory.
+    bool firstEntry = true;
+    out << "[";
+    for (uint64_t state = 0; state < numberOfModelStates; ++state) {
         // Check whether the state is skipped
         if (skipUniqueChoices && model != nullptr && model->getTransitionMatrix().getRowGroupSize(state) == 1) {
             continue;
@@ -333,11 +471,11 @@ void Scheduler<ValueType>::printJsonToStream(std::ostream& out, std::shared_ptr<
                 stateChoicesJson["m"] = memoryState;
             }
 
-            auto const& choice = schedulerChoices[memoryState][state];
+            auto const choice = getChoice(state, memoryState);
             storm::json<storm::RationalNumber> choicesJson;
             if (choice.isDefined()) {
                 for (auto const& choiceProbPair : choice.getChoiceAsDistribution()) {
-                    uint64_t globalChoiceIndex = model->getTransitionMatrix().getRowGroupIndices()[state] + choiceProbPair.first;
+                    uint64_t globalChoiceIndex = model ? model->getTransitionMatrix().getRowGroupIndices()[state] + choiceProbPair.first : choiceProbPair.first;
                     storm::json<storm::RationalNumber> choiceJson;
                     if (model && model->hasChoiceOrigins() &&
                         model->getChoiceOrigins()->getIdentifier(globalChoiceIndex) != model->getChoiceOrigins()->getIdentifierForChoicesWithNoOrigin()) {
@@ -375,10 +513,11 @@ void Scheduler<ValueType>::printJsonToStream(std::ostream& out, std::shared_ptr<
                 choicesJson = "undefined";
             }
             stateChoicesJson["c"] = std::move(choicesJson);
-            output.push_back(std::move(stateChoicesJson));
+            out << (firstEntry ? "\n" : ",\n") << "    " << stateChoicesJson.dump();
+            firstEntry = false;
         }
     }
-    out << output.dump(4);
+    out << (firstEntry ? "]" : "\n]");
 }
 
 template class Scheduler<double>;
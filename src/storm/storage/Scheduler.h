@@ -13,6 +13,9 @@ namespace storage {
  * This class defines which action is chosen in a particular state of a non-deterministic model. More concretely, a scheduler maps a state s to i
  * if the scheduler takes the i-th action available in s (i.e. the choices are relative to the states).
  * A Choice can be undefined, deterministic
+ *
+ * As long as all choices are deterministic, the choices are stored compactly as bit-packed (local) choice indices using a dense layout over all pairs
+ * of memory and model states. The scheduler switches to an explicit representation once a randomized choice is set.
  */
 template<typename ValueType>
 class Scheduler {
@@ -54,7 +57,34 @@ class Scheduler {
      * @param state The state for which to get the choice.
      * @param memoryState the memory state which we consider.
      */
-    SchedulerChoice<ValueType> const& getChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+    SchedulerChoice<ValueType> getChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+
+    /*!
+     * Retrieves whether the scheduler defines a choice for the given model and memory state.
+     * In contrast to getChoice, this does not construct a SchedulerChoice.
+     *
+     * @param modelState The state of the model.
+     * @param memoryState The state of the memoryStructure.
+     */
+    bool isChoiceDefined(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+
+    /*!
+     * Retrieves whether the scheduler defines a deterministic choice for the given model and memory state.
+     * In contrast to getChoice, this does not construct a SchedulerChoice.
+     *
+     * @param modelState The state of the model.
+     * @param memoryState The state of the memoryStructure.
+     */
+    bool isChoiceDeterministic(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+
+    /*!
+     * Retrieves the (local) index of the deterministic choice for the given model and memory state.
+     * If the choice is not deterministic, an exception is thrown.
+     *
+     * @param modelState The state of the model.
+     * @param memoryState The state of the memoryStructure.
+     */
+    uint_fast64_t getDeterministicChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
 
     /*!
      * Set the combination of model state and memoryStructure state to dontCare.
@@ -115,7 +145,7 @@ class Scheduler {
      */
     template<typename NewValueType>
     Scheduler<NewValueType> toValueType() const {
-        uint_fast64_t numModelStates = schedulerChoices.front().size();
+        uint_fast64_t numModelStates = numberOfModelStates;
         Scheduler<NewValueType> newScheduler(numModelStates, memoryStructure);
         for (uint_fast64_t memState = 0; memState < this->getNumberOfMemoryStates(); ++memState) {
             for (uint_fast64_t modelState = 0; modelState < numModelStates; ++modelState) {
@@ -138,12 +168,39 @@ class Scheduler {
 
     /*!
      * Prints the scheduler in json format to the given output stream.
+     * The entries are written one after another, i.e., the json representation of the whole scheduler is never built in memory.
      */
     void printJsonToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model = nullptr, bool skipUniqueChoices = false,
                            bool skipDontCareStates = false) const;
 
    private:
+    /*!
+     * Retrieves the position of the given model and memory state in the compact choice storage.
+     */
+    uint_fast64_t getCompactChoiceIndex(uint_fast64_t modelState, uint_fast64_t memoryState) const;
+
+    /*!
+     * Retrieves the (deterministic) choice stored compactly for the given position. Returns none if the choice is undefined.
+     */
+    boost::optional<uint_fast64_t> getCompactChoice(uint_fast64_t compactChoiceIndex) const;
+
+    /*!
+     * Stores the given deterministic choice compactly. The storage is widened if the given choice index does not fit into the current bit width.
+     */
+    void setCompactChoice(uint_fast64_t compactChoiceIndex, boost::optional<uint_fast64_t> const& choice);
+
+    /*!
+     * Converts the compactly stored choices into the explicit representation that also allows for randomized choices.
+     */
+    void convertToExplicitChoices();
+
     boost::optional<storm::storage::MemoryStructure> memoryStructure;
+    uint_fast64_t numberOfModelStates;
+    // Bit-packed choice indices (shifted by one such that zero encodes an undefined choice). Only used if compactChoicesUsed is true.
+    bool compactChoicesUsed;
+    uint_fast64_t bitsPerCompactChoice;
+    storm::storage::BitVector compactChoices;
+    // Explicit choices. Only used if compactChoicesUsed is false.
     std::vector<std::vector<SchedulerChoice<ValueType>>> schedulerChoices;
     std::vector<storm::storage::BitVector> dontCareStates;
     uint_fast64_t numOfUndefinedChoices;
@@ -11,6 +11,9 @@
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -22,6 +25,12 @@
 
 namespace storm {
 namespace dd {
+namespace {
+bool isParallelConversionEnabled() {
+    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+}
+}  // namespace
+
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType>::Add(DdManager<LibraryType> const& ddManager, InternalAdd<LibraryType, ValueType> const& internalAdd,
                                  std::set<storm::expressions::Variable> const& containedMetaVariables)
@@ -713,7 +722,7 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(st
 
     // Now actually fill the entry vector.
     internalAdd.toMatrixComponents(trivialRowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
-                                   true);
+                                   true, isParallelConversionEnabled());
 
     // Since the last call to toMatrixRec modified the rowIndications, we need to restore the correct values.
     for (uint_fast64_t i = rowIndications.size() - 1; i > 0; --i) {
@@ -892,7 +901,7 @@ typename Add<LibraryType, ValueType>::MatrixAndLabeling Add<LibraryType, ValueTy
         auto const& group = groups[i];
 
         group.internalAdd.toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices,
-                                             ddColumnVariableIndices, true);
+                                             ddColumnVariableIndices, true, isParallelConversionEnabled());
 
         statesWithGroupEnabled[i].composeWithExplicitVector(rowOdd, ddRowVariableIndices, rowGroupIndices, std::plus<uint_fast64_t>());
     }
@@ -1117,7 +1126,7 @@ std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<Value
         auto const& dd = groups[i].back();
 
         dd.internalAdd.toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
-                                          true);
+                                          true, isParallelConversionEnabled());
         statesWithGroupEnabled[i].composeWithExplicitVector(rowOdd, ddRowVariableIndices, rowGroupIndices, std::plus<uint_fast64_t>());
     }
 
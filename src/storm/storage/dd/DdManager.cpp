@@ -8,6 +8,7 @@
 
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/OutOfMemoryException.h"
 
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -461,6 +462,39 @@ void DdManager<LibraryType>::triggerReordering() {
     internalDdManager.triggerReordering();
 }
 
+template<DdType LibraryType>
+uint64_t DdManager<LibraryType>::getNumberOfNodes() const {
+    return internalDdManager.getNumberOfNodes();
+}
+
+template<DdType LibraryType>
+uint64_t DdManager<LibraryType>::getMemoryInUse() const {
+    return internalDdManager.getMemoryInUse();
+}
+
+template<DdType LibraryType>
+void DdManager<LibraryType>::performGarbageCollection() {
+    internalDdManager.performGarbageCollection();
+}
+
+template<DdType LibraryType>
+void DdManager<LibraryType>::finishPhase(std::string const& phase) {
+    uint64_t peakNumberOfNodes = internalDdManager.getPeakNumberOfNodes();
+    internalDdManager.resetPeakNumberOfNodes();
+    STORM_LOG_INFO("DD phase '" << phase << "' finished with a peak of " << peakNumberOfNodes << " nodes (" << getMemoryInUse() / (1024 * 1024)
+                                << "MB in use).");
+
+    uint64_t memoryBudget = internalDdManager.getMemoryBudget();
+    if (memoryBudget > 0 && (getMemoryInUse() * 5 > memoryBudget * 4 || internalDdManager.isMemoryBudgetExhausted())) {
+        STORM_LOG_DEBUG("DD library occupies " << getMemoryInUse() / (1024 * 1024) << "MB of its memory budget of " << memoryBudget / (1024 * 1024)
+                                               << "MB, performing garbage collection.");
+        performGarbageCollection();
+        STORM_LOG_THROW(!internalDdManager.isMemoryBudgetExhausted(), storm::exceptions::OutOfMemoryException,
+                        "The DD library exhausted its memory budget of " << memoryBudget / (1024 * 1024) << "MB in phase '" << phase << "' with a peak of "
+                                                                         << peakNumberOfNodes << " nodes.");
+    }
+}
+
 template<DdType LibraryType>
 std::set<storm::expressions::Variable> DdManager<LibraryType>::getAllMetaVariables() const {
     std::set<storm::expressions::Variable> result;
@@ -281,6 +281,34 @@ class DdManager : public std::enable_shared_from_this<DdManager<LibraryType>> {
      */
     void triggerReordering();
 
+    /*!
+     * Retrieves the number of nodes that are currently stored by the DD library.
+     *
+     * @return The number of nodes.
+     */
+    uint64_t getNumberOfNodes() const;
+
+    /*!
+     * Retrieves the amount of memory that is currently occupied by the DD library.
+     *
+     * @return The occupied memory in bytes.
+     */
+    uint64_t getMemoryInUse() const;
+
+    /*!
+     * Performs a garbage collection of the DD library.
+     */
+    void performGarbageCollection();
+
+    /*!
+     * Marks the end of a phase of a computation (e.g. of the model building). The peak number of nodes during the
+     * phase is reported. If a memory budget is set (see `--dd-memory-budget`) and the DD library occupies most of
+     * it, a garbage collection is triggered. If the budget is still exhausted afterwards, the computation is aborted.
+     *
+     * @param phase The name of the phase.
+     */
+    void finishPhase(std::string const& phase);
+
     /*!
      * Retrieves the meta variable with the given name if it exists.
      *
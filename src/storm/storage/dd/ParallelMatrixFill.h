@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/storage/dd/Odd.h"
+
+namespace storm {
+namespace dd {
+
+#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Fills the entries of the matrix represented by the given DD concurrently. For this, the DD is split along the topmost row and column variables
+ * into blocks of consecutive rows. Since different row blocks cover disjoint sets of rows, they write to disjoint parts of the row indications and
+ * the entry vector. Within a row block, the parts of the DD are filled in the order of their columns, so the entries of each row remain sorted.
+ *
+ * @param dd The DD to convert.
+ * @param rowOdd The ODD used for the row translation.
+ * @param columnOdd The ODD used for the column translation.
+ * @param ddRowVariableIndices The (sorted) indices of all DD row variables that need to be considered.
+ * @param ddColumnVariableIndices The (sorted) indices of all DD column variables that need to be considered.
+ * @param getCofactors A function that, given a DD as well as a row and a column variable index, returns the cofactors of the DD w.r.t. these
+ * variables in the order (else, else), (else, then), (then, else), (then, then), where the first component refers to the row variable.
+ * @param isZero A function that determines whether a DD is the constant zero.
+ * @param fill A function that fills the entries of a DD, given the ODDs, the level of the topmost row and column variables and the row and
+ * column offsets.
+ */
+template<typename DdNodeType, typename GetCofactorsFunction, typename IsZeroFunction, typename FillFunction>
+void fillMatrixComponentsInParallel(DdNodeType const& dd, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                    std::vector<uint_fast64_t> const& ddColumnVariableIndices, GetCofactorsFunction const& getCofactors,
+                                    IsZeroFunction const& isZero, FillFunction const& fill) {
+    // A part of the DD that still needs to be converted together with the column ODD and column offset it refers to.
+    struct ColumnBlock {
+        DdNodeType dd;
+        Odd const* columnOdd;
+        uint_fast64_t columnOffset;
+    };
+
+    // A set of consecutive rows together with all parts of the DD that contribute to these rows (ordered by their column offset).
+    struct RowBlock {
+        Odd const* rowOdd;
+        uint_fast64_t rowOffset;
+        std::vector<ColumnBlock> columnBlocks;
+    };
+
+    uint_fast64_t splitLevel = std::min<uint_fast64_t>(std::min(ddRowVariableIndices.size(), ddColumnVariableIndices.size()), 10);
+    std::vector<RowBlock> rowBlocks = {RowBlock{&rowOdd, 0, {ColumnBlock{dd, &columnOdd, 0}}}};
+    for (uint_fast64_t level = 0; level < splitLevel; ++level) {
+        std::vector<RowBlock> nextRowBlocks;
+        nextRowBlocks.reserve(2 * rowBlocks.size());
+        for (auto const& rowBlock : rowBlocks) {
+            RowBlock elseBlock{&rowBlock.rowOdd->getElseSuccessor(), rowBlock.rowOffset, {}};
+            RowBlock thenBlock{&rowBlock.rowOdd->getThenSuccessor(), rowBlock.rowOffset + rowBlock.rowOdd->getElseOffset(), {}};
+
+            for (auto const& columnBlock : rowBlock.columnBlocks) {
+                std::array<DdNodeType, 4> cofactors = getCofactors(columnBlock.dd, ddRowVariableIndices[level], ddColumnVariableIndices[level]);
+                Odd const* columnOdds[2] = {&columnBlock.columnOdd->getElseSuccessor(), &columnBlock.columnOdd->getThenSuccessor()};
+                uint_fast64_t columnOffsets[2] = {columnBlock.columnOffset, columnBlock.columnOffset + columnBlock.columnOdd->getElseOffset()};
+                for (uint_fast64_t index = 0; index < 4; ++index) {
+                    if (!isZero(cofactors[index])) {
+                        RowBlock& block = index < 2 ? elseBlock : thenBlock;
+                        block.columnBlocks.push_back(ColumnBlock{cofactors[index], columnOdds[index % 2], columnOffsets[index % 2]});
+                    }
+                }
+            }
+
+            if (!elseBlock.columnBlocks.empty()) {
+                nextRowBlocks.push_back(std::move(elseBlock));
+            }
+            if (!thenBlock.columnBlocks.empty()) {
+                nextRowBlocks.push_back(std::move(thenBlock));
+            }
+        }
+        rowBlocks = std::move(nextRowBlocks);
+    }
+
+    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, rowBlocks.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+        for (uint_fast64_t index = range.begin(); index < range.end(); ++index) {
+            RowBlock const& rowBlock = rowBlocks[index];
+            for (auto const& columnBlock : rowBlock.columnBlocks) {
+                fill(columnBlock.dd, *rowBlock.rowOdd, *columnBlock.columnOdd, splitLevel, rowBlock.rowOffset, columnBlock.columnOffset);
+            }
+        }
+    });
+}
+#endif
+
+}  // namespace dd
+}  // namespace storm
@@ -12,7 +12,7 @@ InternalSignatureRefinerOptions::InternalSignatureRefinerOptions() : InternalSig
 }
 
 InternalSignatureRefinerOptions::InternalSignatureRefinerOptions(bool shiftStateVariables)
-    : shiftStateVariables(shiftStateVariables), createChangedStates(true) {
+    : shiftStateVariables(shiftStateVariables), createChangedStates(true), initialTableCapacity(1ull << 20) {
     auto const& bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
 
     storm::settings::modules::BisimulationSettings::ReuseMode reuseMode = bisimulationSettings.getReuseMode();
@@ -1,5 +1,7 @@
 #include "storm/storage/dd/bisimulation/InternalSylvanSignatureRefiner.h"
 
+#include <algorithm>
+
 #include "storm/storage/dd/DdManager.h"
 
 #include "storm/storage/dd/bisimulation/Partition.h"
@@ -29,7 +31,7 @@ InternalSylvanSignatureRefinerBase::InternalSylvanSignatureRefinerBase(storm::dd
       blockCube(manager.getMetaVariable(blockVariable).getCube()),
       nextFreeBlockIndex(0),
       numberOfRefinements(0),
-      currentCapacity(1ull << 20),
+      currentCapacity(options.initialTableCapacity),
       resizeFlag(0) {
     // Perform garbage collection to clean up stuff not needed anymore.
     LACE_ME;
@@ -57,14 +59,31 @@ Partition<storm::dd::DdType::Sylvan, ValueType> InternalSignatureRefiner<storm::
     return oldPartition.replacePartition(newPartitionDds.first, nextFreeBlockIndex, nextFreeBlockIndex, newPartitionDds.second);
 }
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+VOID_TASK_3(sylvan_clear, uint64_t*, first, size_t, count, uint64_t, value) {
+    if (count > 4096) {
+        SPAWN(sylvan_clear, first, count / 2, value);
+        CALL(sylvan_clear, first + count / 2, count - count / 2, value);
+        SYNC(sylvan_clear);
+        return;
+    }
+
+    std::fill(first, first + count, value);
+}
+
+#pragma GCC diagnostic pop
+#pragma clang diagnostic pop
+
 template<typename ValueType>
 void InternalSignatureRefiner<storm::dd::DdType::Sylvan, ValueType>::clearCaches() {
-    for (auto& e : this->table) {
-        e = NO_ELEMENT_MARKER;
-    }
-    for (auto& e : this->signatures) {
-        e = 0ull;
-    }
+    // The table has at least 2^20 entries, so it pays off to let all Lace workers take part in clearing it.
+    LACE_ME;
+    CALL(sylvan_clear, this->table.data(), this->table.size(), NO_ELEMENT_MARKER);
+    CALL(sylvan_clear, this->signatures.data(), this->signatures.size(), 0ull);
 }
 
 template<typename ValueType>
@@ -79,21 +98,21 @@ InternalSignatureRefiner<storm::dd::DdType::Sylvan, ValueType>::refine(Partition
     signatures.resize(nextFreeBlockIndex);
 
     // Perform the actual recursive refinement step.
-    std::pair<BDD, BDD> result(0, 0);
-    result.first =
+    BDD result =
         CALL(sylvan_refine_partition, signatureAdd.getInternalAdd().getSylvanMtbdd().GetMTBDD(), oldPartition.asBdd().getInternalBdd().getSylvanBdd().GetBDD(),
              nondeterminismVariables.getInternalBdd().getSylvanBdd().GetBDD(), nonBlockVariables.getInternalBdd().getSylvanBdd().GetBDD(), this);
 
     // Construct resulting BDD from the obtained node and the meta information.
-    storm::dd::InternalBdd<storm::dd::DdType::Sylvan> internalNewPartitionBdd(&manager.getInternalDdManager(), sylvan::Bdd(result.first));
+    storm::dd::InternalBdd<storm::dd::DdType::Sylvan> internalNewPartitionBdd(&manager.getInternalDdManager(), sylvan::Bdd(result));
     storm::dd::Bdd<storm::dd::DdType::Sylvan> newPartitionBdd(oldPartition.asBdd().getDdManager(), internalNewPartitionBdd,
                                                               oldPartition.asBdd().getContainedMetaVariables());
 
     boost::optional<storm::dd::Bdd<storm::dd::DdType::Sylvan>> optionalChangedBdd;
-    if (options.createChangedStates && result.second != 0) {
-        storm::dd::InternalBdd<storm::dd::DdType::Sylvan> internalChangedBdd(&manager.getInternalDdManager(), sylvan::Bdd(result.second));
-        storm::dd::Bdd<storm::dd::DdType::Sylvan> changedBdd(oldPartition.asBdd().getDdManager(), internalChangedBdd, stateVariables);
-        optionalChangedBdd = changedBdd;
+    if (options.createChangedStates) {
+        // A state changed its block iff its new block number differs from its old one. As all states that carry the
+        // same new block number stem from the same old block, the states that kept their number form a subset of
+        // their old block, which lets the next signature computation ignore them.
+        optionalChangedBdd = (newPartitionBdd && !oldPartition.asBdd()).existsAbstract({blockVariable});
     }
 
     clearCaches();
@@ -140,6 +159,10 @@ VOID_TASK_3(sylvan_rehash, size_t, first, size_t, count, InternalSylvanSignature
         uint64_t a = old_ptr[0];
         uint64_t b = old_ptr[1];
         uint64_t c = old_ptr[2];
+        if (a == NO_ELEMENT_MARKER) {
+            first++;
+            continue;
+        }
 
         uint64_t hash = sylvan_hash(a, b);
         uint64_t pos = hash % refiner->currentCapacity;
@@ -147,8 +170,8 @@ VOID_TASK_3(sylvan_rehash, size_t, first, size_t, count, InternalSylvanSignature
         volatile uint64_t* ptr = 0;
         for (;;) {
             ptr = refiner->table.data() + pos * 3;
-            if (*ptr == 0) {
-                if (cas(ptr, 0, a)) {
+            if (*ptr == NO_ELEMENT_MARKER) {
+                if (cas(ptr, NO_ELEMENT_MARKER, a)) {
                     ptr[1] = b;
                     ptr[2] = c;
                     break;
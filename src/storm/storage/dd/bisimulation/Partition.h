@@ -73,6 +73,11 @@ class Partition {
     storm::dd::Add<DdType, ValueType> const& changedStatesAsAdd() const;
     storm::dd::Bdd<DdType> const& changedStatesAsBdd() const;
 
+    /*!
+     * Retrieves a copy of this partition without the information about the states whose block assignment changed.
+     */
+    Partition<DdType, ValueType> withoutChangedStates() const;
+
    private:
     /*!
      * Creates a new partition from the given data.
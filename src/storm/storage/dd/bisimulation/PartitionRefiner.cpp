@@ -16,6 +16,7 @@ PartitionRefiner<DdType, ValueType>::PartitionRefiner(storm::models::symbolic::M
                                                       Partition<DdType, ValueType> const& initialStatePartition)
     : status(Status::Initialized),
       refinements(0),
+      lastRefinementUsedFullSignatures(false),
       statePartition(initialStatePartition),
       signatureComputer(model),
       signatureRefiner(model.getManager(), statePartition.getBlockVariable(), model.getRowAndNondeterminismVariables(), model.getColumnVariables(),
@@ -56,7 +57,12 @@ Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine
         bool refined = false;
         uint64_t index = 0;
         Partition<DdType, ValueType> newPartition;
-        auto signatureIterator = signatureComputer.compute(targetPartition);
+
+        // Restricting the signatures to the states that changed their block is only sound if the blocks of the old
+        // partition were obtained from the full signatures. This is not the case for the initial partition (which
+        // may also have been refined with respect to rewards) or after a qualitative refinement.
+        Partition<DdType, ValueType> signaturePartition = lastRefinementUsedFullSignatures ? targetPartition : targetPartition.withoutChangedStates();
+        auto signatureIterator = signatureComputer.compute(signaturePartition);
         while (signatureIterator.hasNext() && !refined) {
             auto signatureStart = std::chrono::high_resolution_clock::now();
             auto signature = signatureIterator.next();
@@ -76,7 +82,9 @@ Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine
             if (newPartition.getNumberOfBlocks() > oldPartition.getNumberOfBlocks()) {
                 refined = true;
             }
+            ++index;
         }
+        lastRefinementUsedFullSignatures = mode == SignatureMode::Eager || (mode == SignatureMode::Lazy && index == 2);
 
         auto totalTimeInRefinement = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
         STORM_LOG_INFO("Refinement " << refinements << " produced " << newPartition.getNumberOfBlocks() << " blocks and was completed in "
@@ -72,6 +72,10 @@ class PartitionRefiner {
     // The number of refinements that were made.
     uint64_t refinements;
 
+    // A flag indicating whether the last refinement based on the signature computer used the full signatures. Only
+    // then, the signatures may be restricted to the states whose block changed in that refinement.
+    bool lastRefinementUsedFullSignatures;
+
     // The state partition in the refinement process. Initially set to the initial partition.
     Partition<DdType, ValueType> statePartition;
 
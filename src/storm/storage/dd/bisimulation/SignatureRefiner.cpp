@@ -14,6 +14,17 @@ SignatureRefiner<DdType, ValueType>::SignatureRefiner(storm::dd::DdManager<DdTyp
                                                       std::set<storm::expressions::Variable> const& stateRowVariables,
                                                       std::set<storm::expressions::Variable> const& stateColumnVariables, bool shiftStateVariables,
                                                       std::set<storm::expressions::Variable> const& nondeterminismVariables)
+    : SignatureRefiner(manager, blockVariable, stateRowVariables, stateColumnVariables, nondeterminismVariables,
+                       InternalSignatureRefinerOptions(shiftStateVariables)) {
+    // Intentionally left empty.
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+SignatureRefiner<DdType, ValueType>::SignatureRefiner(storm::dd::DdManager<DdType> const& manager, storm::expressions::Variable const& blockVariable,
+                                                      std::set<storm::expressions::Variable> const& stateRowVariables,
+                                                      std::set<storm::expressions::Variable> const& stateColumnVariables,
+                                                      std::set<storm::expressions::Variable> const& nondeterminismVariables,
+                                                      InternalSignatureRefinerOptions const& options)
     : manager(&manager) {
     storm::dd::Bdd<DdType> nonBlockVariablesCube = manager.getBddOne();
     storm::dd::Bdd<DdType> nondeterminismVariablesCube = manager.getBddOne();
@@ -28,8 +39,8 @@ SignatureRefiner<DdType, ValueType>::SignatureRefiner(storm::dd::DdManager<DdTyp
     }
 
     internalRefiner = std::make_unique<InternalSignatureRefiner<DdType, ValueType>>(
-        manager, blockVariable, shiftStateVariables ? stateColumnVariables : stateRowVariables, nondeterminismVariablesCube, nonBlockVariablesCube,
-        InternalSignatureRefinerOptions(shiftStateVariables));
+        manager, blockVariable, options.shiftStateVariables ? stateColumnVariables : stateRowVariables, nondeterminismVariablesCube, nonBlockVariablesCube,
+        options);
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
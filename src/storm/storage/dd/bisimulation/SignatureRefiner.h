@@ -4,6 +4,7 @@
 
 #include "storm/storage/dd/DdType.h"
 
+#include "storm/storage/dd/bisimulation/InternalSignatureRefiner.h"
 #include "storm/storage/dd/bisimulation/Partition.h"
 #include "storm/storage/dd/bisimulation/Signature.h"
 
@@ -11,9 +12,6 @@ namespace storm {
 namespace dd {
 namespace bisimulation {
 
-template<storm::dd::DdType DdType, typename ValueType>
-class InternalSignatureRefiner;
-
 template<storm::dd::DdType DdType, typename ValueType>
 class SignatureRefiner {
    public:
@@ -22,6 +20,13 @@ class SignatureRefiner {
                      bool shiftStateVariables,
                      std::set<storm::expressions::Variable> const& nondeterminismVariables = std::set<storm::expressions::Variable>());
 
+    /*!
+     * Creates a refiner that uses the given options instead of the ones derived from the settings.
+     */
+    SignatureRefiner(storm::dd::DdManager<DdType> const& manager, storm::expressions::Variable const& blockVariable,
+                     std::set<storm::expressions::Variable> const& stateRowVariables, std::set<storm::expressions::Variable> const& stateColumnVariables,
+                     std::set<storm::expressions::Variable> const& nondeterminismVariables, InternalSignatureRefinerOptions const& options);
+
     Partition<DdType, ValueType> refine(Partition<DdType, ValueType> const& oldPartition, Signature<DdType, ValueType> const& signature);
 
    private:
@@ -1,6 +1,7 @@
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
 
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/ParallelMatrixFill.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
 #include "storm/storage/dd/cudd/InternalCuddDdManager.h"
@@ -728,12 +729,63 @@ template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
                                                               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                               Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                              std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
+                                                              std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues,
+                                                              bool parallel) const {
+#ifdef STORM_HAVE_INTELTBB
+    // Only the values are filled concurrently as counting the entries requires the rows to be traversed in order.
+    if (parallel && writeValues && std::is_same<ValueType, double>::value && !ddRowVariableIndices.empty()) {
+        toMatrixComponentsParallel(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices,
+                                   ddColumnVariableIndices);
+        return;
+    }
+#endif
     return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0,
                                  ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
                                  writeValues);
 }
 
+template<typename ValueType>
+void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsParallel(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets,
+                                                                      std::vector<uint_fast64_t>& rowIndications,
+                                                                      std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
+                                                                      Odd const& rowOdd, Odd const& columnOdd,
+                                                                      std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                                      std::vector<uint_fast64_t> const& ddColumnVariableIndices) const {
+#ifdef STORM_HAVE_INTELTBB
+    DdNode const* zero = Cudd_ReadZero(ddManager->getCuddManager().getManager());
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+    auto getCofactors = [](DdNode const* node, uint_fast64_t rowVariableIndex, uint_fast64_t columnVariableIndex) {
+        std::array<DdNode const*, 4> cofactors;
+        if (columnVariableIndex < Cudd_NodeReadIndex(node)) {
+            cofactors.fill(node);
+        } else if (rowVariableIndex < Cudd_NodeReadIndex(node)) {
+            cofactors[0] = cofactors[2] = Cudd_E_const(node);
+            cofactors[1] = cofactors[3] = Cudd_T_const(node);
+        } else {
+            DdNode const* rowCofactors[2] = {Cudd_E_const(node), Cudd_T_const(node)};
+            for (uint_fast64_t index = 0; index < 2; ++index) {
+                if (columnVariableIndex < Cudd_NodeReadIndex(rowCofactors[index])) {
+                    cofactors[2 * index] = cofactors[2 * index + 1] = rowCofactors[index];
+                } else {
+                    cofactors[2 * index] = Cudd_E_const(rowCofactors[index]);
+                    cofactors[2 * index + 1] = Cudd_T_const(rowCofactors[index]);
+                }
+            }
+        }
+        return cofactors;
+    };
+    fillMatrixComponentsInParallel(
+        dd, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices, getCofactors, [zero](DdNode const* node) { return node == zero; },
+        [&](DdNode const* node, Odd const& currentRowOdd, Odd const& currentColumnOdd, uint_fast64_t level, uint_fast64_t rowOffset,
+            uint_fast64_t columnOffset) {
+            toMatrixComponentsRec(node, rowGroupOffsets, rowIndications, columnsAndValues, currentRowOdd, currentColumnOdd, level, level, maxLevel, rowOffset,
+                                  columnOffset, ddRowVariableIndices, ddColumnVariableIndices, true);
+        });
+#else
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Filling the matrix in parallel requires Intel TBB.");
+#endif
+}
+
 template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets,
                                                                  std::vector<uint_fast64_t>& rowIndications,
@@ -644,11 +644,12 @@ class InternalAdd<DdType::CUDD, ValueType> {
      * @param ddColumnVariableIndices The variable indices of the column variables.
      * @param writeValues A flag that indicates whether or not to write to the entry vector. If this is not set,
      * only the row indications are modified.
+     * @param parallel If set and the values are to be written, the rows are filled concurrently (if supported).
      */
     void toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
                             std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd,
                             std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices,
-                            bool writeValues) const;
+                            bool writeValues, bool parallel = false) const;
 
     /*!
      * Creates an ADD from the given explicit vector.
@@ -762,6 +763,25 @@ class InternalAdd<DdType::CUDD, ValueType> {
     void splitIntoGroupsRec(std::vector<DdNode*> const& dds, std::vector<std::vector<InternalAdd<DdType::CUDD, ValueType>>>& groups,
                             std::vector<uint_fast64_t> const& ddGroupVariableIndices, uint_fast64_t currentLevel, uint_fast64_t maxLevel) const;
 
+    /*!
+     * Fills the entry vector by first splitting the DD along the topmost row variables into blocks of rows that
+     * are disjoint and then filling these blocks concurrently. The row indications must already be correct.
+     *
+     * @param dd The DD to convert.
+     * @param rowGroupOffsets The row offsets at which a given row group starts.
+     * @param rowIndications The (correct) offsets of the rows in the entry vector. These are modified as in the
+     * sequential conversion.
+     * @param columnsAndValues The vector that is to be filled with the non-zero entries of the matrix.
+     * @param rowOdd The ODD used for the row translation.
+     * @param columnOdd The ODD used for the column translation.
+     * @param ddRowVariableIndices The (sorted) indices of all DD row variables that need to be considered.
+     * @param ddColumnVariableIndices The (sorted) indices of all DD row variables that need to be considered.
+     */
+    void toMatrixComponentsParallel(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications,
+                                    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd,
+                                    Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                    std::vector<uint_fast64_t> const& ddColumnVariableIndices) const;
+
     /*!
      * Helper function to convert the DD into a (sparse) matrix.
      *
@@ -1,16 +1,46 @@
 #include "storm/storage/dd/cudd/InternalCuddDdManager.h"
 
+#include <algorithm>
+#include <stdexcept>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CuddSettings.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/OutOfMemoryException.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/resources.h"
 
 namespace storm {
 namespace dd {
 
-InternalDdManager<DdType::CUDD>::InternalDdManager() : cuddManager(), reorderingTechnique(CUDD_REORDER_NONE), numberOfDdVariables(0) {
-    this->cuddManager.SetMaxMemory(
-        static_cast<unsigned long>(storm::settings::getModule<storm::settings::modules::CuddSettings>().getMaximalMemory() * 1024ul * 1024ul));
+namespace {
+// The approximate memory (in bytes) that CUDD occupies per entry of its operation cache.
+const uint64_t bytesPerCacheEntry = 40;
+
+// CUDD reports errors (like exceeding its maximal memory) to this handler before returning from the operation.
+void handleCuddError(std::string message) {
+    STORM_LOG_THROW(message.find("memory") == std::string::npos, storm::exceptions::OutOfMemoryException,
+                    "CUDD could not complete an operation within its memory budget (" << message
+                                                                                      << "). Consider a larger budget (--dd-memory-budget, --cudd:maxmem) or "
+                                                                                         "a different variable ordering (--ddvarorder).");
+    throw std::logic_error(message);
+}
+}  // namespace
+
+InternalDdManager<DdType::CUDD>::InternalDdManager()
+    : cuddManager(), reorderingTechnique(CUDD_REORDER_NONE), numberOfDdVariables(0), memoryBudget(storm::utility::resources::getDdMemoryBudget()) {
+    if (memoryBudget > 0) {
+        // A memory budget takes precedence over the maximal memory. At most a quarter of the budget is spent on the
+        // operation cache.
+        this->cuddManager.SetMaxMemory(static_cast<size_t>(memoryBudget));
+        this->cuddManager.SetMaxCacheHard(static_cast<unsigned int>(std::min<uint64_t>(memoryBudget / 4 / bytesPerCacheEntry, 1ull << 31)));
+        this->cuddManager.setHandler(&handleCuddError);
+    } else {
+        this->cuddManager.SetMaxMemory(
+            static_cast<unsigned long>(storm::settings::getModule<storm::settings::modules::CuddSettings>().getMaximalMemory() * 1024ul * 1024ul));
+    }
+    this->peakLiveNodeCountAtReset = Cudd_ReadPeakLiveNodeCount(this->cuddManager.getManager());
 
     auto const& settings = storm::settings::getModule<storm::settings::modules::CuddSettings>();
     this->cuddManager.SetEpsilon(settings.getConstantPrecision());
@@ -201,6 +231,37 @@ void InternalDdManager<DdType::CUDD>::debugCheck() const {
     this->getCuddManager().DebugCheck();
 }
 
+uint64_t InternalDdManager<DdType::CUDD>::getNumberOfNodes() const {
+    return Cudd_ReadKeys(this->getCuddManager().getManager());
+}
+
+uint64_t InternalDdManager<DdType::CUDD>::getMemoryInUse() const {
+    return Cudd_ReadMemoryInUse(this->getCuddManager().getManager());
+}
+
+uint64_t InternalDdManager<DdType::CUDD>::getPeakNumberOfNodes() const {
+    // CUDD only keeps track of the overall peak. If it was not exceeded since the last reset, we report the current
+    // number of nodes instead.
+    uint64_t peakLiveNodeCount = Cudd_ReadPeakLiveNodeCount(this->getCuddManager().getManager());
+    return peakLiveNodeCount > peakLiveNodeCountAtReset ? peakLiveNodeCount : getNumberOfNodes();
+}
+
+void InternalDdManager<DdType::CUDD>::resetPeakNumberOfNodes() {
+    peakLiveNodeCountAtReset = Cudd_ReadPeakLiveNodeCount(this->getCuddManager().getManager());
+}
+
+void InternalDdManager<DdType::CUDD>::performGarbageCollection() {
+    cuddGarbageCollect(this->getCuddManager().getManager(), 1);
+}
+
+uint64_t InternalDdManager<DdType::CUDD>::getMemoryBudget() const {
+    return memoryBudget;
+}
+
+bool InternalDdManager<DdType::CUDD>::isMemoryBudgetExhausted() const {
+    return memoryBudget > 0 && getMemoryInUse() * 10 > memoryBudget * 9;
+}
+
 cudd::Cudd& InternalDdManager<DdType::CUDD>::getCuddManager() {
     return cuddManager;
 }
@@ -138,6 +138,53 @@ class InternalDdManager<DdType::CUDD> {
      */
     uint_fast64_t getNumberOfDdVariables() const;
 
+    /*!
+     * Retrieves the number of nodes that are currently stored in the unique table (including dead nodes that were
+     * not yet garbage collected).
+     *
+     * @return The number of nodes.
+     */
+    uint64_t getNumberOfNodes() const;
+
+    /*!
+     * Retrieves the amount of memory that is occupied by CUDD.
+     *
+     * @return The occupied memory in bytes.
+     */
+    uint64_t getMemoryInUse() const;
+
+    /*!
+     * Retrieves the largest number of live nodes since the last reset. As CUDD only keeps track of the overall
+     * peak, this is the current number of nodes if the overall peak was not exceeded since the last reset.
+     *
+     * @return The peak number of nodes.
+     */
+    uint64_t getPeakNumberOfNodes() const;
+
+    /*!
+     * Resets the peak number of nodes.
+     */
+    void resetPeakNumberOfNodes();
+
+    /*!
+     * Performs a garbage collection.
+     */
+    void performGarbageCollection();
+
+    /*!
+     * Retrieves the memory budget that CUDD may occupy (see `--dd-memory-budget`).
+     *
+     * @return The memory budget in bytes or zero if no budget is enforced.
+     */
+    uint64_t getMemoryBudget() const;
+
+    /*!
+     * Retrieves whether CUDD occupies (almost) all of its memory budget.
+     *
+     * @return True iff the memory budget is exhausted.
+     */
+    bool isMemoryBudgetExhausted() const;
+
     /*!
      * Retrieves the underlying CUDD manager.
      *
@@ -165,6 +212,12 @@ class InternalDdManager<DdType::CUDD> {
 
     // Keeps track of the number of registered DD variables.
     uint_fast64_t numberOfDdVariables;
+
+    // The memory budget (in bytes) or zero if no budget is enforced.
+    uint64_t memoryBudget;
+
+    // The overall peak number of live nodes at the last reset of the peak.
+    uint64_t peakLiveNodeCountAtReset;
 };
 }  // namespace dd
 }  // namespace storm
@@ -1,22 +1,93 @@
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
 
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/ParallelMatrixFill.h"
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/SylvanSettings.h"
+
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/Stopwatch.h"
 #include "storm/utility/macros.h"
 
 #include "storm-config.h"
 
 namespace storm {
 namespace dd {
+
+/*!
+ * The information shared by all tasks of a parallel traversal of an MTBDD along an ODD.
+ */
+struct SylvanForEachContext {
+    std::vector<uint_fast64_t> const* ddVariableIndices;
+    uint64_t maxLevel;
+    std::function<void(uint64_t, MTBDD)> const* visitLeaf;
+    // The statistics to record the visited nodes in or null if no statistics are to be recorded.
+    SylvanTraversalStatistics* statistics;
+};
+
+// The number of explicit entries below an ODD node from which on the two successors are traversed in separate tasks.
+static const uint64_t MINIMAL_PARALLEL_TRAVERSAL_SIZE = 4096;
+
+static uint64_t sylvan_for_each_sequential(MTBDD dd, uint64_t currentLevel, uint64_t currentOffset, Odd const& odd, SylvanForEachContext const& context) {
+    if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
+        return 1;
+    }
+
+    if (currentLevel == context.maxLevel) {
+        (*context.visitLeaf)(currentOffset, dd);
+        return 1;
+    } else if (mtbdd_isleaf(dd) || (*context.ddVariableIndices)[currentLevel] < mtbdd_getvar(dd)) {
+        return 1 + sylvan_for_each_sequential(dd, currentLevel + 1, currentOffset, odd.getElseSuccessor(), context) +
+               sylvan_for_each_sequential(dd, currentLevel + 1, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), context);
+    } else {
+        return 1 + sylvan_for_each_sequential(mtbdd_getlow(dd), currentLevel + 1, currentOffset, odd.getElseSuccessor(), context) +
+               sylvan_for_each_sequential(mtbdd_gethigh(dd), currentLevel + 1, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), context);
+    }
+}
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+VOID_TASK_5(sylvan_for_each, MTBDD, dd, uint64_t, currentLevel, uint64_t, currentOffset, Odd const*, odd, SylvanForEachContext const*, context) {
+    // Small parts are traversed sequentially, because spawning tasks for them does not pay off.
+    if (odd->getTotalOffset() < MINIMAL_PARALLEL_TRAVERSAL_SIZE || currentLevel == context->maxLevel || (mtbdd_isleaf(dd) && mtbdd_iszero(dd))) {
+        uint64_t visitedNodes = sylvan_for_each_sequential(dd, currentLevel, currentOffset, *odd, *context);
+        if (context->statistics != nullptr) {
+            context->statistics->addVisitedNodes(LACE_WORKER_ID, visitedNodes);
+        }
+        return;
+    }
+
+    MTBDD elseNode = dd;
+    MTBDD thenNode = dd;
+    if (!mtbdd_isleaf(dd) && (*context->ddVariableIndices)[currentLevel] == mtbdd_getvar(dd)) {
+        elseNode = mtbdd_getlow(dd);
+        thenNode = mtbdd_gethigh(dd);
+    }
+
+    // As the successors write to disjoint ranges of offsets, they can be traversed in parallel.
+    SPAWN(sylvan_for_each, elseNode, currentLevel + 1, currentOffset, &odd->getElseSuccessor(), context);
+    CALL(sylvan_for_each, thenNode, currentLevel + 1, currentOffset + odd->getElseOffset(), &odd->getThenSuccessor(), context);
+    SYNC(sylvan_for_each);
+    if (context->statistics != nullptr) {
+        context->statistics->addVisitedNodes(LACE_WORKER_ID, 1);
+    }
+}
+
+#pragma GCC diagnostic pop
+#pragma clang diagnostic pop
+
 template<typename ValueType>
 InternalAdd<DdType::Sylvan, ValueType>::InternalAdd() : ddManager(nullptr), sylvanMtbdd() {
     // Intentionally left empty.
@@ -966,19 +1037,52 @@ template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
                                                                        std::vector<ValueType>& targetVector,
                                                                        std::function<ValueType(ValueType const&, ValueType const&)> const& function) const {
-    forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices,
-               [&function, &targetVector](uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
+    forEachConcurrently("composeWithExplicitVector", odd, ddVariableIndices,
+                        [&function, &targetVector](uint64_t const& offset, ValueType const& value) {
+                            targetVector[offset] = function(targetVector[offset], value);
+                        });
 }
 
 template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
                                                                        std::vector<uint_fast64_t> const& offsets, std::vector<ValueType>& targetVector,
                                                                        std::function<ValueType(ValueType const&, ValueType const&)> const& function) const {
-    forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices,
-               [&function, &targetVector, &offsets](uint64_t const& offset, ValueType const& value) {
-                   ValueType& targetValue = targetVector[offsets[offset]];
-                   targetValue = function(targetValue, value);
-               });
+    forEachConcurrently("composeWithExplicitVector", odd, ddVariableIndices,
+                        [&function, &targetVector, &offsets](uint64_t const& offset, ValueType const& value) {
+                            ValueType& targetValue = targetVector[offsets[offset]];
+                            targetValue = function(targetValue, value);
+                        });
+}
+
+template<typename ValueType>
+void InternalAdd<DdType::Sylvan, ValueType>::forEachConcurrently(std::string const& operation, Odd const& odd,
+                                                                 std::vector<uint_fast64_t> const& ddVariableIndices,
+                                                                 std::function<void(uint64_t const&, ValueType const&)> const& function) const {
+    // Statistics are only recorded if they are printed eventually.
+    SylvanTraversalStatistics* statistics = nullptr;
+    std::vector<uint64_t> visitedNodesBefore;
+    if (storm::settings::getModule<storm::settings::modules::SylvanSettings>().isPrintStatisticsSet()) {
+        statistics = &InternalDdManager<DdType::Sylvan>::getTraversalStatistics();
+        visitedNodesBefore = statistics->getVisitedNodesPerWorker();
+    }
+    storm::utility::Stopwatch timer(true);
+
+    // The values of the other types are not safe to be copied concurrently, so they are traversed sequentially.
+    bool parallel = false;
+    if (std::is_same<ValueType, double>::value || std::is_same<ValueType, uint_fast64_t>::value) {
+        LACE_ME;
+        parallel = lace_workers() > 1;
+        std::function<void(uint64_t, MTBDD)> visitLeaf = [&function](uint64_t offset, MTBDD leaf) { function(offset, getValue(leaf)); };
+        SylvanForEachContext context{&ddVariableIndices, ddVariableIndices.size(), &visitLeaf, statistics};
+        CALL(sylvan_for_each, this->getSylvanMtbdd().GetMTBDD(), 0, 0, &odd, &context);
+    } else {
+        forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, function);
+    }
+
+    timer.stop();
+    if (statistics != nullptr) {
+        statistics->recordOperation(operation, visitedNodesBefore, timer, parallel);
+    }
 }
 
 template<typename ValueType>
@@ -1230,12 +1334,70 @@ template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
                                                                 std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                                 Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
+                                                                std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues,
+                                                                bool parallel) const {
+#ifdef STORM_HAVE_INTELTBB
+    // Only the values are filled concurrently as counting the entries requires the rows to be traversed in order.
+    if (parallel && writeValues && std::is_same<ValueType, double>::value && !ddRowVariableIndices.empty()) {
+        toMatrixComponentsParallel(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
+                                   rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices);
+        return;
+    }
+#endif
     return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
                                  rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
                                  ddRowVariableIndices, ddColumnVariableIndices, writeValues);
 }
 
+template<typename ValueType>
+void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsParallel(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets,
+                                                                        std::vector<uint_fast64_t>& rowIndications,
+                                                                        std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
+                                                                        Odd const& rowOdd, Odd const& columnOdd,
+                                                                        std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                                        std::vector<uint_fast64_t> const& ddColumnVariableIndices) const {
+#ifdef STORM_HAVE_INTELTBB
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+    // Nodes are given by their regular node and a flag whether they are negated.
+    typedef std::pair<MTBDD, bool> NodeType;
+    auto getCofactors = [](NodeType const& node, uint_fast64_t rowVariableIndex, uint_fast64_t columnVariableIndex) {
+        MTBDD current = node.first;
+        std::array<MTBDD, 4> cofactors;
+        if (mtbdd_isleaf(current) || columnVariableIndex < mtbdd_getvar(current)) {
+            cofactors.fill(current);
+        } else if (rowVariableIndex < mtbdd_getvar(current)) {
+            cofactors[0] = cofactors[2] = mtbdd_getlow(current);
+            cofactors[1] = cofactors[3] = mtbdd_gethigh(current);
+        } else {
+            MTBDD rowCofactors[2] = {mtbdd_getlow(current), mtbdd_gethigh(current)};
+            for (uint_fast64_t index = 0; index < 2; ++index) {
+                if (mtbdd_isleaf(rowCofactors[index]) || columnVariableIndex < mtbdd_getvar(rowCofactors[index])) {
+                    cofactors[2 * index] = cofactors[2 * index + 1] = rowCofactors[index];
+                } else {
+                    cofactors[2 * index] = mtbdd_getlow(rowCofactors[index]);
+                    cofactors[2 * index + 1] = mtbdd_gethigh(rowCofactors[index]);
+                }
+            }
+        }
+        std::array<NodeType, 4> result;
+        for (uint_fast64_t index = 0; index < 4; ++index) {
+            result[index] = NodeType(mtbdd_regular(cofactors[index]), static_cast<bool>(mtbdd_hascomp(cofactors[index]) ^ node.second));
+        }
+        return result;
+    };
+    fillMatrixComponentsInParallel(
+        NodeType(dd, negated), rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices, getCofactors,
+        [](NodeType const& node) { return mtbdd_isleaf(node.first) && mtbdd_iszero(node.first); },
+        [&](NodeType const& node, Odd const& currentRowOdd, Odd const& currentColumnOdd, uint_fast64_t level, uint_fast64_t rowOffset,
+            uint_fast64_t columnOffset) {
+            toMatrixComponentsRec(node.first, node.second, rowGroupOffsets, rowIndications, columnsAndValues, currentRowOdd, currentColumnOdd, level, level,
+                                  maxLevel, rowOffset, columnOffset, ddRowVariableIndices, ddColumnVariableIndices, true);
+        });
+#else
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Filling the matrix in parallel requires Intel TBB.");
+#endif
+}
+
 template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets,
                                                                    std::vector<uint_fast64_t>& rowIndications,
@@ -560,7 +560,8 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      *
      * @param odd The ODD to use for the translation from symbolic to explicit positions.
      * @param ddVariableIndices The indices of the DD variables present in this ADD.
-     * @param offsets The offsets
+     * @param offsets The offsets. The offsets of the non-zero entries need to be pairwise different, because the
+     * entries may be composed concurrently.
      * @param targetVector The explicit vector that is to be composed with the ADD. The results are written to
      * this vector again.
      * @param function The function to perform in the composition.
@@ -636,11 +637,12 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      * @param ddColumnVariableIndices The variable indices of the column variables.
      * @param writeValues A flag that indicates whether or not to write to the entry vector. If this is not set,
      * only the row indications are modified.
+     * @param parallel If set and the values are to be written, the rows are filled concurrently (if supported).
      */
     void toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
                             std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd,
                             std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices,
-                            bool writeValues) const;
+                            bool writeValues, bool parallel = false) const;
 
     /*!
      * Creates an ADD from the given explicit vector.
@@ -693,6 +695,20 @@ class InternalAdd<DdType::Sylvan, ValueType> {
     static std::shared_ptr<Odd> createOddRec(BDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<uint_fast64_t> const& ddVariableIndices,
                                              std::vector<std::unordered_map<BDD, std::shared_ptr<Odd>>>& uniqueTableForLevels);
 
+    /*!
+     * Calls the given function for all entries of the ADD, where the entries are enumerated by Lace tasks. The
+     * function may hence be called concurrently, but only for different offsets. If statistics are to be printed
+     * (--sylvan:stats), the traversal is recorded in the traversal statistics of the manager.
+     *
+     * @param operation The name of the operation (for the statistics).
+     * @param odd The ODD used for the translation.
+     * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
+     * @param function The callback invoked for every element. The first argument is the offset and the second
+     * is the value.
+     */
+    void forEachConcurrently(std::string const& operation, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
+                             std::function<void(uint64_t const&, ValueType const&)> const& function) const;
+
     /*!
      * Performs a recursive step for forEach.
      *
@@ -781,6 +797,26 @@ class InternalAdd<DdType::Sylvan, ValueType> {
     static MTBDD fromVectorRec(uint_fast64_t& currentOffset, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<ValueType> const& values,
                                Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices);
 
+    /*!
+     * Fills the entry vector by first splitting the DD along the topmost row variables into blocks of rows that
+     * are disjoint and then filling these blocks concurrently. The row indications must already be correct.
+     *
+     * @param dd The DD to convert.
+     * @param negated A flag indicating whether the DD node is to be interpreted as negated.
+     * @param rowGroupOffsets The row offsets at which a given row group starts.
+     * @param rowIndications The (correct) offsets of the rows in the entry vector. These are modified as in the
+     * sequential conversion.
+     * @param columnsAndValues The vector that is to be filled with the non-zero entries of the matrix.
+     * @param rowOdd The ODD used for the row translation.
+     * @param columnOdd The ODD used for the column translation.
+     * @param ddRowVariableIndices The (sorted) indices of all DD row variables that need to be considered.
+     * @param ddColumnVariableIndices The (sorted) indices of all DD row variables that need to be considered.
+     */
+    void toMatrixComponentsParallel(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications,
+                                    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd,
+                                    Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                    std::vector<uint_fast64_t> const& ddColumnVariableIndices) const;
+
     /*!
      * Helper function to convert the DD into a (sparse) matrix.
      *
@@ -1,5 +1,6 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -10,9 +11,18 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/resources.h"
 
 #include "storm/adapters/sylvan.h"
 
+#include "sylvan_cache.h"
+#include "sylvan_table.h"
+
+extern "C" {
+// The unique table of Sylvan.
+extern llmsset_t nodes;
+}
+
 #include "storm-config.h"
 
 namespace storm {
@@ -39,12 +49,79 @@ VOID_TASK_0(gc_end) {
 
 #endif
 
+// The memory (in bytes) that Sylvan occupies per entry of the unique table and the operation cache, respectively.
+static const uint64_t bytesPerNode = 24;
+static const uint64_t bytesPerCacheEntry = 36;
+
+// The operation cache is not shrunk below this number of entries to preserve the effect of caching.
+static const uint64_t minimalCacheSize = 1ull << 16;
+
+// The memory budget (in bytes) or zero if no budget is enforced. This needs to be 'global' as it is used by the
+// garbage collection hooks.
+static uint64_t memoryBudget = 0;
+
+// The largest number of nodes in the unique table that was observed since the last reset.
+static uint64_t peakNumberOfNodes = 0;
+
+// A flag that is set once the unique table is (almost) full but cannot grow within the memory budget.
+static bool memoryBudgetExhausted = false;
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wzero-length-array"
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#endif
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+VOID_TASK_0(record_peak_number_of_nodes) {
+    // Before garbage collection, the unique table holds the most nodes.
+    peakNumberOfNodes = std::max<uint64_t>(peakNumberOfNodes, llmsset_count_marked(nodes));
+}
+
+VOID_TASK_0(resize_within_memory_budget) {
+    // Like Sylvan's default heuristic, only grow the tables if more than half of the unique table is in use.
+    uint64_t nodesSize = llmsset_get_size(nodes);
+    uint64_t markedNodes = llmsset_count_marked(nodes);
+    if (markedNodes * 2 <= nodesSize) {
+        return;
+    }
+
+    // The unique table is grown in favor of the operation cache, which is shrunk if both do not fit the budget.
+    uint64_t cacheSize = cache_getsize();
+    uint64_t newNodesSize = std::min<uint64_t>(2 * nodesSize, llmsset_get_max_size(nodes));
+    uint64_t newCacheSize = std::min<uint64_t>(2 * cacheSize, cache_getmaxsize());
+    while (newNodesSize * bytesPerNode + newCacheSize * bytesPerCacheEntry > memoryBudget && newCacheSize > minimalCacheSize) {
+        newCacheSize /= 2;
+    }
+
+    if (newNodesSize > nodesSize && newNodesSize * bytesPerNode + newCacheSize * bytesPerCacheEntry <= memoryBudget) {
+        llmsset_set_size(nodes, newNodesSize);
+        if (newCacheSize != cacheSize) {
+            STORM_LOG_DEBUG("Resizing Sylvan's operation cache from " << cacheSize << " to " << newCacheSize << " entries to stay within the memory budget.");
+            cache_setsize(newCacheSize);
+        }
+    } else if (markedNodes * 10 > nodesSize * 9 && !memoryBudgetExhausted) {
+        memoryBudgetExhausted = true;
+        STORM_LOG_ERROR("Sylvan's unique table holds " << markedNodes << " of " << nodesSize << " nodes and cannot grow within the memory budget of "
+                                                       << memoryBudget / (1024 * 1024)
+                                                       << "MB. Consider a larger budget (--dd-memory-budget) or a different variable ordering (--ddvarorder).");
+    }
+}
+
+#pragma GCC diagnostic pop
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
 uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
 
 // It is important that the variable pairs start at an even offset, because sylvan assumes this to be true for
 // some operations.
 uint_fast64_t InternalDdManager<DdType::Sylvan>::nextFreeVariableIndex = 0;
 
+SylvanTraversalStatistics InternalDdManager<DdType::Sylvan>::traversalStatistics;
+
 uint_fast64_t findLargestPowerOfTwoFitting(uint_fast64_t number) {
     for (uint_fast64_t index = 0; index < 64; ++index) {
         if ((number & (1ull << (63 - index))) != 0) {
@@ -63,6 +140,7 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
             lace_init(0, 1024 * 1024 * 16);
         }
         lace_startup(0, 0, 0);
+        traversalStatistics.initialize(lace_workers());
 
         // Table/cache size computation taken from newer version of sylvan.
         uint64_t memorycap = storm::settings::getModule<storm::settings::modules::SylvanSettings>().getMaximalMemory() * 1024 * 1024;
@@ -96,6 +174,24 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
         }
         // End of copied code.
 
+        // A memory budget takes precedence over the maximal memory. The unique table may then occupy almost all of the
+        // budget, because the operation cache is shrunk as the unique table grows. The tables start small, such that
+        // their growth can be controlled by the garbage collection.
+        memoryBudget = storm::utility::resources::getDdMemoryBudget();
+        memoryBudgetExhausted = false;
+        peakNumberOfNodes = 0;
+        if (memoryBudget > 0) {
+            max_t = 1;
+            while (2 * max_t * bytesPerNode + minimalCacheSize * bytesPerCacheEntry <= memoryBudget && max_t < 0x0000040000000000) {
+                max_t *= 2;
+            }
+            while (max_t * bytesPerNode + max_c * bytesPerCacheEntry > memoryBudget && max_c > minimalCacheSize) {
+                max_c /= 2;
+            }
+            min_t = std::min<uint64_t>(max_t, 1ull << 20);
+            min_c = std::min<uint64_t>(max_c, minimalCacheSize);
+        }
+
         STORM_LOG_DEBUG("Initializing sylvan library. Initial/max table size: " << min_t << "/" << max_t << ", initial/max cache size: " << min_c << "/"
                                                                                 << max_c << ".");
         sylvan::Sylvan::initPackage(min_t, max_t, min_c, max_c);
@@ -108,6 +204,10 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
         sylvan_gc_hook_pregc(TASK(gc_start));
         sylvan_gc_hook_postgc(TASK(gc_end));
 #endif
+        sylvan_gc_hook_pregc(TASK(record_peak_number_of_nodes));
+        if (memoryBudget > 0) {
+            sylvan_gc_hook_main(TASK(resize_within_memory_budget));
+        }
     }
     ++numberOfInstances;
 }
@@ -115,10 +215,10 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
 InternalDdManager<DdType::Sylvan>::~InternalDdManager() {
     --numberOfInstances;
     if (numberOfInstances == 0) {
-        // Enable this to print the sylvan statistics to a file.
-        //                FILE* filePointer = fopen("sylvan.stats", "w");
-        //                sylvan_stats_report(filePointer, 0);
-        //                fclose(filePointer);
+        if (storm::settings::getModule<storm::settings::modules::SylvanSettings>().isPrintStatisticsSet()) {
+            traversalStatistics.printToStream(std::cout);
+            sylvan_stats_report(stdout);
+        }
 
         sylvan::Sylvan::quitPackage();
         lace_exit();
@@ -267,6 +367,44 @@ void InternalDdManager<DdType::Sylvan>::debugCheck() const {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
 }
 
+uint64_t InternalDdManager<DdType::Sylvan>::getNumberOfNodes() const {
+    LACE_ME;
+    size_t filled = 0;
+    sylvan_table_usage(&filled, nullptr);
+    return filled;
+}
+
+uint64_t InternalDdManager<DdType::Sylvan>::getMemoryInUse() const {
+    // The tables are allocated up front, so only the nodes that are actually stored count as used.
+    return getNumberOfNodes() * bytesPerNode;
+}
+
+uint64_t InternalDdManager<DdType::Sylvan>::getPeakNumberOfNodes() const {
+    return std::max(peakNumberOfNodes, getNumberOfNodes());
+}
+
+void InternalDdManager<DdType::Sylvan>::resetPeakNumberOfNodes() {
+    peakNumberOfNodes = 0;
+}
+
+void InternalDdManager<DdType::Sylvan>::performGarbageCollection() {
+    LACE_ME;
+    sylvan_gc();
+}
+
+uint64_t InternalDdManager<DdType::Sylvan>::getMemoryBudget() const {
+    return memoryBudget;
+}
+
+bool InternalDdManager<DdType::Sylvan>::isMemoryBudgetExhausted() const {
+    // Once the unique table could not grow, it is only exhausted as long as it remains (almost) full.
+    return memoryBudgetExhausted && getNumberOfNodes() * 10 > llmsset_get_size(nodes) * 9;
+}
+
+SylvanTraversalStatistics& InternalDdManager<DdType::Sylvan>::getTraversalStatistics() {
+    return traversalStatistics;
+}
+
 uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfDdVariables() const {
     return nextFreeVariableIndex;
 }
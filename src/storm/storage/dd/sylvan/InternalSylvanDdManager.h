@@ -8,6 +8,7 @@
 
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
 #include "storm/storage/dd/sylvan/InternalSylvanBdd.h"
+#include "storm/storage/dd/sylvan/SylvanTraversalStatistics.h"
 
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -139,6 +140,59 @@ class InternalDdManager<DdType::Sylvan> {
      */
     uint_fast64_t getNumberOfDdVariables() const;
 
+    /*!
+     * Retrieves the number of nodes that are currently stored in the unique table (including dead nodes that were
+     * not yet garbage collected).
+     *
+     * @return The number of nodes.
+     */
+    uint64_t getNumberOfNodes() const;
+
+    /*!
+     * Retrieves the (approximate) amount of memory that is occupied by the nodes stored in the unique table.
+     *
+     * @return The occupied memory in bytes.
+     */
+    uint64_t getMemoryInUse() const;
+
+    /*!
+     * Retrieves the largest number of nodes that were stored in the unique table since the last reset.
+     *
+     * @return The peak number of nodes.
+     */
+    uint64_t getPeakNumberOfNodes() const;
+
+    /*!
+     * Resets the peak number of nodes.
+     */
+    void resetPeakNumberOfNodes();
+
+    /*!
+     * Performs a garbage collection.
+     */
+    void performGarbageCollection();
+
+    /*!
+     * Retrieves the memory budget in which the tables are kept (see `--dd-memory-budget`).
+     *
+     * @return The memory budget in bytes or zero if no budget is enforced.
+     */
+    uint64_t getMemoryBudget() const;
+
+    /*!
+     * Retrieves whether the unique table is (almost) full and cannot grow any further within the memory budget.
+     *
+     * @return True iff the memory budget is exhausted.
+     */
+    bool isMemoryBudgetExhausted() const;
+
+    /*!
+     * Retrieves the statistics about the DD traversals that are performed by Storm itself.
+     *
+     * @return The traversal statistics.
+     */
+    static SylvanTraversalStatistics& getTraversalStatistics();
+
    private:
     // Helper function to create the BDD whose encodings are below a given bound.
     BDD getBddEncodingLessOrEqualThanRec(uint64_t minimalValue, uint64_t maximalValue, uint64_t bound, BDD cube, uint64_t remainingDdVariables) const;
@@ -151,6 +205,10 @@ class InternalDdManager<DdType::Sylvan> {
     // The index of the next free variable index. This needs to be shared across all instances since the sylvan
     // manager is implicitly 'global'.
     static uint_fast64_t nextFreeVariableIndex;
+
+    // The statistics about the DD traversals. These need to be shared across all instances since the Lace
+    // workers are implicitly 'global'.
+    static SylvanTraversalStatistics traversalStatistics;
 };
 
 template<>
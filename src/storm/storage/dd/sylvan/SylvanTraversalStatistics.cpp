@@ -0,0 +1,67 @@
+#include "storm/storage/dd/sylvan/SylvanTraversalStatistics.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace dd {
+
+void SylvanTraversalStatistics::initialize(uint64_t numberOfWorkers) {
+    this->numberOfWorkers = std::max<uint64_t>(numberOfWorkers, 1);
+    visitedNodes.assign(this->numberOfWorkers * counterStride, 0);
+    operations.clear();
+}
+
+void SylvanTraversalStatistics::addVisitedNodes(uint64_t worker, uint64_t count) {
+    STORM_LOG_ASSERT(worker < numberOfWorkers, "Illegal worker index " << worker << ".");
+    visitedNodes[worker * counterStride] += count;
+}
+
+std::vector<uint64_t> SylvanTraversalStatistics::getVisitedNodesPerWorker() const {
+    std::vector<uint64_t> result(numberOfWorkers);
+    for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+        result[worker] = visitedNodes[worker * counterStride];
+    }
+    return result;
+}
+
+void SylvanTraversalStatistics::recordOperation(std::string const& operation, std::vector<uint64_t> const& visitedNodesBefore,
+                                                storm::utility::Stopwatch const& timer, bool parallel) {
+    OperationStatistics& statistics = operations[operation];
+    ++statistics.numberOfCalls;
+    if (parallel) {
+        ++statistics.numberOfParallelCalls;
+    }
+
+    uint64_t maximalVisitedNodes = 0;
+    for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+        uint64_t visitedNodesOfWorker = visitedNodes[worker * counterStride] - visitedNodesBefore[worker];
+        statistics.visitedNodes += visitedNodesOfWorker;
+        maximalVisitedNodes = std::max(maximalVisitedNodes, visitedNodesOfWorker);
+    }
+    statistics.maximalVisitedNodesPerWorker += maximalVisitedNodes;
+    statistics.timer.add(timer);
+}
+
+void SylvanTraversalStatistics::printToStream(std::ostream& out) const {
+    out << "Traversals of Sylvan DDs (" << numberOfWorkers << " Lace workers):\n";
+    for (auto const& operation : operations) {
+        OperationStatistics const& statistics = operation.second;
+        out << "    " << operation.first << ": " << statistics.numberOfCalls << " calls (" << statistics.numberOfParallelCalls << " in parallel), "
+            << statistics.visitedNodes << " visited nodes, " << statistics.timer;
+        if (statistics.maximalVisitedNodesPerWorker > 0) {
+            // The speedup is bounded by the ratio of all visited nodes and the nodes visited by the busiest worker.
+            out << ", achievable speedup " << static_cast<double>(statistics.visitedNodes) / statistics.maximalVisitedNodesPerWorker;
+        }
+        out << '\n';
+    }
+    out << "    Visited nodes per worker:";
+    for (auto const& count : getVisitedNodesPerWorker()) {
+        out << " " << count;
+    }
+    out << '\n';
+}
+
+}  // namespace dd
+}  // namespace storm
@@ -0,0 +1,86 @@
+#ifndef STORM_STORAGE_DD_SYLVAN_SYLVANTRAVERSALSTATISTICS_H_
+#define STORM_STORAGE_DD_SYLVAN_SYLVANTRAVERSALSTATISTICS_H_
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "storm/utility/Stopwatch.h"
+
+namespace storm {
+namespace dd {
+
+/*!
+ * Gathers statistics about the traversals of Sylvan DDs that are performed by Storm itself (as opposed to the
+ * operations provided by the Sylvan library). The visited nodes are accounted per Lace worker, which allows to
+ * judge how evenly the work of a traversal is distributed among the workers.
+ */
+class SylvanTraversalStatistics {
+   public:
+    /*!
+     * Prepares the statistics for the given number of Lace workers and resets all counters.
+     *
+     * @param numberOfWorkers The number of Lace workers.
+     */
+    void initialize(uint64_t numberOfWorkers);
+
+    /*!
+     * Adds the given number of visited nodes to the counter of the given worker. As every worker only modifies its
+     * own counter, this may be called concurrently by different workers.
+     *
+     * @param worker The index of the worker.
+     * @param count The number of nodes that were visited.
+     */
+    void addVisitedNodes(uint64_t worker, uint64_t count);
+
+    /*!
+     * Retrieves the number of nodes that each worker visited so far.
+     *
+     * @return The number of visited nodes for each worker.
+     */
+    std::vector<uint64_t> getVisitedNodesPerWorker() const;
+
+    /*!
+     * Records a finished call of the given operation.
+     *
+     * @param operation The name of the operation.
+     * @param visitedNodesBefore The number of nodes each worker visited before the call of the operation.
+     * @param timer The stopwatch that measured the wall-clock time of the call.
+     * @param parallel A flag indicating whether the operation was performed in parallel.
+     */
+    void recordOperation(std::string const& operation, std::vector<uint64_t> const& visitedNodesBefore, storm::utility::Stopwatch const& timer,
+                         bool parallel);
+
+    /*!
+     * Prints the statistics to the given stream.
+     *
+     * @param out The stream to print to.
+     */
+    void printToStream(std::ostream& out) const;
+
+   private:
+    struct OperationStatistics {
+        uint64_t numberOfCalls = 0;
+        uint64_t numberOfParallelCalls = 0;
+        uint64_t visitedNodes = 0;
+
+        // The sum over all calls of the largest number of nodes visited by a single worker.
+        uint64_t maximalVisitedNodesPerWorker = 0;
+
+        storm::utility::Stopwatch timer;
+    };
+
+    // The counters are placed on separate cache lines to avoid false sharing between the workers.
+    static const uint64_t counterStride = 8;
+
+    uint64_t numberOfWorkers = 1;
+    std::vector<uint64_t> visitedNodes;
+    std::map<std::string, OperationStatistics> operations;
+};
+
+}  // namespace dd
+}  // namespace storm
+
+#endif /* STORM_STORAGE_DD_SYLVAN_SYLVANTRAVERSALSTATISTICS_H_ */
@@ -155,12 +155,11 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableState
             uint64_t memoryState = stateIndex % memoryStateCount;
 
             if (scheduler) {
-                auto choices = scheduler->getChoice(modelState, memoryState).getChoiceAsDistribution();
                 uint64_t groupStart = model.getTransitionMatrix().getRowGroupIndices()[modelState];
-                for (auto const& choice : choices) {
-                    STORM_LOG_ASSERT(groupStart + choice.first < model.getTransitionMatrix().getRowGroupIndices()[modelState + 1],
-                                     "Invalid choice " << choice.first << " at model state " << modelState << ".");
-                    auto const& row = model.getTransitionMatrix().getRow(groupStart + choice.first);
+                auto exploreChoice = [&](uint64_t localChoice) {
+                    STORM_LOG_ASSERT(groupStart + localChoice < model.getTransitionMatrix().getRowGroupIndices()[modelState + 1],
+                                     "Invalid choice " << localChoice << " at model state " << modelState << ".");
+                    auto const& row = model.getTransitionMatrix().getRow(groupStart + localChoice);
                     for (auto modelTransitionIt = row.begin(); modelTransitionIt != row.end(); ++modelTransitionIt) {
                         if (!storm::utility::isZero(modelTransitionIt->getValue())) {
                             uint64_t successorModelState = modelTransitionIt->getColumn();
@@ -173,6 +172,15 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableState
                             }
                         }
                     }
+                };
+                // Avoid constructing a scheduler choice for the (common) deterministic case.
+                if (scheduler->isChoiceDeterministic(modelState, memoryState)) {
+                    exploreChoice(scheduler->getDeterministicChoice(modelState, memoryState));
+                } else if (scheduler->isChoiceDefined(modelState, memoryState)) {
+                    storm::storage::SchedulerChoice<ValueType> randomizedChoice = scheduler->getChoice(modelState, memoryState);
+                    for (auto const& choice : randomizedChoice.getChoiceAsDistribution()) {
+                        exploreChoice(choice.first);
+                    }
                 }
             } else {
                 auto const& rowGroup = model.getTransitionMatrix().getRowGroup(modelState);
@@ -262,14 +270,14 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
     for (auto stateIndex : reachableStates) {
         uint64_t modelState = stateIndex / memoryStateCount;
         uint64_t memoryState = stateIndex % memoryStateCount;
-        storm::storage::SchedulerChoice<ValueType> choice = scheduler->getChoice(modelState, memoryState);
-        if (choice.isDefined()) {
+        if (scheduler->isChoiceDefined(modelState, memoryState)) {
             ++numResChoices;
-            if (choice.isDeterministic()) {
-                uint64_t modelRow = model.getTransitionMatrix().getRowGroupIndices()[modelState] + choice.getDeterministicChoice();
+            if (scheduler->isChoiceDeterministic(modelState, memoryState)) {
+                uint64_t modelRow = model.getTransitionMatrix().getRowGroupIndices()[modelState] + scheduler->getDeterministicChoice(modelState, memoryState);
                 numResTransitions += model.getTransitionMatrix().getRow(modelRow).getNumberOfEntries();
             } else {
                 std::set<uint64_t> successors;
+                storm::storage::SchedulerChoice<ValueType> choice = scheduler->getChoice(modelState, memoryState);
                 for (auto const& choiceIndex : choice.getChoiceAsDistribution()) {
                     if (!storm::utility::isZero(choiceIndex.second)) {
                         uint64_t modelRow = model.getTransitionMatrix().getRowGroupIndices()[modelState] + choiceIndex.first;
@@ -300,10 +308,10 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
         if (!hasTrivialNondeterminism) {
             builder.newRowGroup(currentRow);
         }
-        storm::storage::SchedulerChoice<ValueType> choice = scheduler->getChoice(modelState, memoryState);
-        if (choice.isDefined()) {
-            if (choice.isDeterministic()) {
-                uint64_t modelRowIndex = model.getTransitionMatrix().getRowGroupIndices()[modelState] + choice.getDeterministicChoice();
+        if (scheduler->isChoiceDefined(modelState, memoryState)) {
+            if (scheduler->isChoiceDeterministic(modelState, memoryState)) {
+                uint64_t modelRowIndex =
+                    model.getTransitionMatrix().getRowGroupIndices()[modelState] + scheduler->getDeterministicChoice(modelState, memoryState);
                 auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
                 for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
                     uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
@@ -312,6 +320,7 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
                 }
             } else {
                 std::map<uint64_t, ValueType> transitions;
+                storm::storage::SchedulerChoice<ValueType> choice = scheduler->getChoice(modelState, memoryState);
                 for (auto const& choiceIndex : choice.getChoiceAsDistribution()) {
                     if (!storm::utility::isZero(choiceIndex.second)) {
                         uint64_t modelRowIndex = model.getTransitionMatrix().getRowGroupIndices()[modelState] + choiceIndex.first;
@@ -433,8 +442,14 @@ std::unordered_map<std::string, RewardModelType> SparseModelMemoryProduct<ValueT
                     uint64_t rowOffset = modelRow - model.getTransitionMatrix().getRowGroupIndices()[modelState];
                     for (uint64_t memoryState = 0; memoryState < memoryStateCount; ++memoryState) {
                         if (isStateReachable(modelState, memoryState)) {
-                            if (scheduler && scheduler->getChoice(modelState, memoryState).isDefined()) {
-                                ValueType factor = scheduler->getChoice(modelState, memoryState).getChoiceAsDistribution().getProbability(rowOffset);
+                            if (scheduler && scheduler->isChoiceDefined(modelState, memoryState)) {
+                                ValueType factor;
+                                if (scheduler->isChoiceDeterministic(modelState, memoryState)) {
+                                    factor = scheduler->getDeterministicChoice(modelState, memoryState) == rowOffset ? storm::utility::one<ValueType>()
+                                                                                                                     : storm::utility::zero<ValueType>();
+                                } else {
+                                    factor = scheduler->getChoice(modelState, memoryState).getChoiceAsDistribution().getProbability(rowOffset);
+                                }
                                 stateActionRewards.get()[resultTransitionMatrix.getRowGroupIndices()[getResultState(modelState, memoryState)]] +=
                                     factor * modelStateActionReward;
                             } else {
@@ -456,7 +471,7 @@ std::unordered_map<std::string, RewardModelType> SparseModelMemoryProduct<ValueT
                     uint64_t modelState = stateIndex / memoryStateCount;
                     uint64_t memoryState = stateIndex % memoryStateCount;
                     uint64_t rowGroupSize = resultTransitionMatrix.getRowGroupSize(resState);
-                    if (scheduler && scheduler->getChoice(modelState, memoryState).isDefined()) {
+                    if (scheduler && scheduler->isChoiceDefined(modelState, memoryState)) {
                         std::map<uint64_t, RewardValueType> rewards;
                         for (uint64_t rowOffset = 0; rowOffset < rowGroupSize; ++rowOffset) {
                             uint64_t modelRowIndex = model.getTransitionMatrix().getRowGroupIndices()[modelState] + rowOffset;
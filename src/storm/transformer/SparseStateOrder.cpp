@@ -0,0 +1,164 @@
+#include "storm/transformer/SparseStateOrder.h"
+
+#include <algorithm>
+#include <deque>
+#include <numeric>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace transformer {
+
+std::ostream& operator<<(std::ostream& out, SparseStateOrder const& order) {
+    switch (order) {
+        case SparseStateOrder::Odd:
+            out << "odd";
+            break;
+        case SparseStateOrder::Bfs:
+            out << "bfs";
+            break;
+        case SparseStateOrder::ReverseCuthillMcKee:
+            out << "rcm";
+            break;
+        default:
+            out << "undefined";
+            break;
+    }
+    return out;
+}
+
+namespace {
+template<typename ValueType>
+std::vector<uint64_t> computeBfsOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates) {
+    uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+    std::vector<uint64_t> order;
+    order.reserve(numberOfStates);
+    storm::storage::BitVector discovered(numberOfStates);
+
+    // The order itself serves as the queue of the search. States that are not reachable from the initial states
+    // (if any) start a new search, so that every state is numbered.
+    auto search = [&](uint64_t start) {
+        discovered.set(start);
+        order.push_back(start);
+        for (uint64_t index = order.size() - 1; index < order.size(); ++index) {
+            for (auto const& entry : transitionMatrix.getRowGroup(order[index])) {
+                if (!discovered.get(entry.getColumn())) {
+                    discovered.set(entry.getColumn());
+                    order.push_back(entry.getColumn());
+                }
+            }
+        }
+    };
+    for (auto const& initialState : initialStates) {
+        if (!discovered.get(initialState)) {
+            search(initialState);
+        }
+    }
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (!discovered.get(state)) {
+            search(state);
+        }
+    }
+    return order;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> computeReverseCuthillMcKeeOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+    storm::storage::SparseMatrix<ValueType> backwardTransitions = transitionMatrix.transpose(true);
+
+    // Collect the neighbors of every state in the symmetrized graph without selfloops and duplicates.
+    std::vector<uint64_t> neighborIndices(numberOfStates + 1, 0);
+    std::vector<uint64_t> neighbors;
+    neighbors.reserve(2 * transitionMatrix.getEntryCount());
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+            neighbors.push_back(entry.getColumn());
+        }
+        for (auto const& entry : backwardTransitions.getRow(state)) {
+            neighbors.push_back(entry.getColumn());
+        }
+        auto begin = neighbors.begin() + neighborIndices[state];
+        std::sort(begin, neighbors.end());
+        neighbors.erase(std::unique(begin, neighbors.end()), neighbors.end());
+        auto selfloopIt = std::lower_bound(begin, neighbors.end(), state);
+        if (selfloopIt != neighbors.end() && *selfloopIt == state) {
+            neighbors.erase(selfloopIt);
+        }
+        neighborIndices[state + 1] = neighbors.size();
+    }
+    backwardTransitions = storm::storage::SparseMatrix<ValueType>();
+    auto degree = [&neighborIndices](uint64_t state) { return neighborIndices[state + 1] - neighborIndices[state]; };
+    auto hasSmallerDegree = [&degree](uint64_t const& first, uint64_t const& second) { return degree(first) < degree(second); };
+
+    // Every connected component is searched from an unvisited state of minimal degree.
+    std::vector<uint64_t> statesByDegree(numberOfStates);
+    std::iota(statesByDegree.begin(), statesByDegree.end(), 0);
+    std::stable_sort(statesByDegree.begin(), statesByDegree.end(), hasSmallerDegree);
+
+    std::vector<uint64_t> order;
+    order.reserve(numberOfStates);
+    storm::storage::BitVector discovered(numberOfStates);
+    for (auto const& start : statesByDegree) {
+        if (discovered.get(start)) {
+            continue;
+        }
+        discovered.set(start);
+        order.push_back(start);
+        for (uint64_t index = order.size() - 1; index < order.size(); ++index) {
+            uint64_t firstNewState = order.size();
+            uint64_t state = order[index];
+            for (uint64_t neighborIndex = neighborIndices[state]; neighborIndex < neighborIndices[state + 1]; ++neighborIndex) {
+                uint64_t neighbor = neighbors[neighborIndex];
+                if (!discovered.get(neighbor)) {
+                    discovered.set(neighbor);
+                    order.push_back(neighbor);
+                }
+            }
+            std::stable_sort(order.begin() + firstNewState, order.end(), hasSmallerDegree);
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+}  // namespace
+
+template<typename ValueType>
+std::vector<uint64_t> computeSparseStateOrder(SparseStateOrder const& order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                              storm::storage::BitVector const& initialStates) {
+    std::vector<uint64_t> orderedStates;
+    switch (order) {
+        case SparseStateOrder::Odd:
+            orderedStates.resize(transitionMatrix.getRowGroupCount());
+            std::iota(orderedStates.begin(), orderedStates.end(), 0);
+            break;
+        case SparseStateOrder::Bfs:
+            orderedStates = computeBfsOrder(transitionMatrix, initialStates);
+            break;
+        case SparseStateOrder::ReverseCuthillMcKee:
+            orderedStates = computeReverseCuthillMcKeeOrder(transitionMatrix);
+            break;
+    }
+    STORM_LOG_ASSERT(orderedStates.size() == transitionMatrix.getRowGroupCount(), "Not all states were ordered.");
+
+    std::vector<uint64_t> newIndices(orderedStates.size());
+    for (uint64_t newIndex = 0; newIndex < orderedStates.size(); ++newIndex) {
+        newIndices[orderedStates[newIndex]] = newIndex;
+    }
+    return newIndices;
+}
+
+template std::vector<uint64_t> computeSparseStateOrder(SparseStateOrder const& order, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                       storm::storage::BitVector const& initialStates);
+template std::vector<uint64_t> computeSparseStateOrder(SparseStateOrder const& order,
+                                                       storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                       storm::storage::BitVector const& initialStates);
+template std::vector<uint64_t> computeSparseStateOrder(SparseStateOrder const& order,
+                                                       storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                       storm::storage::BitVector const& initialStates);
+
+}  // namespace transformer
+}  // namespace storm
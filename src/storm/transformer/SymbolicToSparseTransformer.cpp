@@ -1,5 +1,7 @@
 #include "SymbolicToSparseTransformer.h"
 
+#include <algorithm>
+
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/logic/AtomicExpressionFormula.h"
 #include "storm/logic/AtomicLabelFormula.h"
@@ -35,43 +37,139 @@ struct LabelInformation {
     std::map<std::string, storm::expressions::Expression> expressionLabels;
 };
 
+// Renumbers the states of the translated components. The components are first translated in ODD order and then
+// permuted one after another, so at most two copies of the same component exist at any time.
+template<typename ValueType>
+class StatePermutation {
+   public:
+    StatePermutation(SparseStateOrder const& order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                     storm::storage::BitVector const& initialStates)
+        : identity(order == SparseStateOrder::Odd) {
+        if (identity) {
+            return;
+        }
+        newStateIndices = computeSparseStateOrder(order, transitionMatrix, initialStates);
+        orderedStates.resize(newStateIndices.size());
+        for (uint64_t state = 0; state < newStateIndices.size(); ++state) {
+            orderedStates[newStateIndices[state]] = state;
+        }
+
+        auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+        newRowIndices.resize(transitionMatrix.getRowCount());
+        uint64_t newRow = 0;
+        for (auto const& state : orderedStates) {
+            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                newRowIndices[row] = newRow++;
+            }
+        }
+    }
+
+    storm::storage::SparseMatrix<ValueType> permuteMatrix(storm::storage::SparseMatrix<ValueType>&& matrix) const {
+        if (identity) {
+            return std::move(matrix);
+        }
+        bool hasCustomRowGrouping = !matrix.hasTrivialRowGrouping();
+        storm::storage::SparseMatrixBuilder<ValueType> builder(matrix.getRowCount(), matrix.getColumnCount(), matrix.getEntryCount(), true,
+                                                               hasCustomRowGrouping, hasCustomRowGrouping ? matrix.getRowGroupCount() : 0);
+        auto const& rowGroupIndices = matrix.getRowGroupIndices();
+        std::vector<std::pair<uint64_t, ValueType>> entries;
+        uint64_t newRow = 0;
+        for (auto const& state : orderedStates) {
+            if (hasCustomRowGrouping) {
+                builder.newRowGroup(newRow);
+            }
+            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row, ++newRow) {
+                entries.clear();
+                for (auto const& entry : matrix.getRow(row)) {
+                    entries.emplace_back(newStateIndices[entry.getColumn()], entry.getValue());
+                }
+                std::sort(entries.begin(), entries.end(), [](auto const& first, auto const& second) { return first.first < second.first; });
+                for (auto const& entry : entries) {
+                    builder.addNextValue(newRow, entry.first, entry.second);
+                }
+            }
+        }
+        matrix = storm::storage::SparseMatrix<ValueType>();
+        return builder.build();
+    }
+
+    std::vector<ValueType> permuteStateVector(std::vector<ValueType>&& vector) const {
+        return permuteVector(std::move(vector), newStateIndices);
+    }
+
+    std::vector<ValueType> permuteChoiceVector(std::vector<ValueType>&& vector) const {
+        return permuteVector(std::move(vector), newRowIndices);
+    }
+
+    storm::storage::BitVector permuteStates(storm::storage::BitVector&& states) const {
+        if (identity) {
+            return std::move(states);
+        }
+        storm::storage::BitVector result(states.size());
+        for (auto const& state : states) {
+            result.set(newStateIndices[state]);
+        }
+        return result;
+    }
+
+   private:
+    std::vector<ValueType> permuteVector(std::vector<ValueType>&& vector, std::vector<uint64_t> const& newIndices) const {
+        if (identity) {
+            return std::move(vector);
+        }
+        std::vector<ValueType> result(vector.size());
+        for (uint64_t index = 0; index < vector.size(); ++index) {
+            result[newIndices[index]] = std::move(vector[index]);
+        }
+        return result;
+    }
+
+    bool identity;
+    std::vector<uint64_t> newStateIndices;
+    std::vector<uint64_t> orderedStates;
+    std::vector<uint64_t> newRowIndices;
+};
+
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>::translate(
-    storm::models::symbolic::Dtmc<Type, ValueType> const& symbolicDtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    storm::models::symbolic::Dtmc<Type, ValueType> const& symbolicDtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+    SparseStateOrder const& stateOrder) {
     this->odd = symbolicDtmc.getReachableStates().createOdd();
     storm::storage::SparseMatrix<ValueType> transitionMatrix = symbolicDtmc.getTransitionMatrix().toMatrix(this->odd, this->odd);
+    StatePermutation<ValueType> permutation(stateOrder, transitionMatrix, symbolicDtmc.getInitialStates().toVector(this->odd));
+    transitionMatrix = permutation.permuteMatrix(std::move(transitionMatrix));
     std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
     for (auto const& rewardModelNameAndModel : symbolicDtmc.getRewardModels()) {
         boost::optional<std::vector<ValueType>> stateRewards;
         boost::optional<std::vector<ValueType>> stateActionRewards;
         boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
         if (rewardModelNameAndModel.second.hasStateRewards()) {
-            stateRewards = rewardModelNameAndModel.second.getStateRewardVector().toVector(this->odd);
+            stateRewards = permutation.permuteStateVector(rewardModelNameAndModel.second.getStateRewardVector().toVector(this->odd));
         }
         if (rewardModelNameAndModel.second.hasStateActionRewards()) {
-            stateActionRewards = rewardModelNameAndModel.second.getStateActionRewardVector().toVector(this->odd);
+            stateActionRewards = permutation.permuteStateVector(rewardModelNameAndModel.second.getStateActionRewardVector().toVector(this->odd));
         }
         if (rewardModelNameAndModel.second.hasTransitionRewards()) {
-            transitionRewards = rewardModelNameAndModel.second.getTransitionRewardMatrix().toMatrix(this->odd, this->odd);
+            transitionRewards = permutation.permuteMatrix(rewardModelNameAndModel.second.getTransitionRewardMatrix().toMatrix(this->odd, this->odd));
         }
         rewardModels.emplace(rewardModelNameAndModel.first,
                              storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
     storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
 
-    labelling.addLabel("init", symbolicDtmc.getInitialStates().toVector(this->odd));
-    labelling.addLabel("deadlock", symbolicDtmc.getDeadlockStates().toVector(this->odd));
+    labelling.addLabel("init", permutation.permuteStates(symbolicDtmc.getInitialStates().toVector(this->odd)));
+    labelling.addLabel("deadlock", permutation.permuteStates(symbolicDtmc.getDeadlockStates().toVector(this->odd)));
     if (formulas.empty()) {
         for (auto const& label : symbolicDtmc.getLabels()) {
-            labelling.addLabel(label, symbolicDtmc.getStates(label).toVector(this->odd));
+            labelling.addLabel(label, permutation.permuteStates(symbolicDtmc.getStates(label).toVector(this->odd)));
         }
     } else {
         LabelInformation labelInfo(formulas);
         for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicDtmc.getStates(label).toVector(this->odd));
+            labelling.addLabel(label, permutation.permuteStates(symbolicDtmc.getStates(label).toVector(this->odd)));
         }
         for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicDtmc.getStates(expressionLabel.second).toVector(this->odd));
+            labelling.addLabel(expressionLabel.first, permutation.permuteStates(symbolicDtmc.getStates(expressionLabel.second).toVector(this->odd)));
         }
     }
     return std::make_shared<storm::models::sparse::Dtmc<ValueType>>(transitionMatrix, labelling, rewardModels);
@@ -84,7 +182,8 @@ storm::dd::Odd const& SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>::getO
 
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTransformer<Type, ValueType>::translate(
-    storm::models::symbolic::Mdp<Type, ValueType> const& symbolicMdp, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    storm::models::symbolic::Mdp<Type, ValueType> const& symbolicMdp, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+    SparseStateOrder const& stateOrder) {
     storm::dd::Odd odd = symbolicMdp.getReachableStates().createOdd();
 
     // Collect action reward vectors that need translation
@@ -106,6 +205,8 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTra
         transitionMatrix = std::move(matrRewards.first);
         actionRewardVectors = std::move(matrRewards.second);
     }
+    StatePermutation<ValueType> permutation(stateOrder, transitionMatrix, symbolicMdp.getInitialStates().toVector(odd));
+    transitionMatrix = permutation.permuteMatrix(std::move(transitionMatrix));
 
     // Translate reward models
     std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
@@ -114,11 +215,11 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTra
         boost::optional<std::vector<ValueType>> stateActionRewards;
         boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
         if (rewardModelNameAndModel.second.hasStateRewards()) {
-            stateRewards = rewardModelNameAndModel.second.getStateRewardVector().toVector(odd);
+            stateRewards = permutation.permuteStateVector(rewardModelNameAndModel.second.getStateRewardVector().toVector(odd));
         }
         auto actRewIndexIt = rewardNameToActionRewardIndexMap.find(rewardModelNameAndModel.first);
         if (actRewIndexIt != rewardNameToActionRewardIndexMap.end()) {
-            stateActionRewards = std::move(actionRewardVectors[actRewIndexIt->second]);
+            stateActionRewards = permutation.permuteChoiceVector(std::move(actionRewardVectors[actRewIndexIt->second]));
         }
         STORM_LOG_THROW(!rewardModelNameAndModel.second.hasTransitionRewards(), storm::exceptions::NotImplementedException,
                         "Translation of symbolic to explicit transition rewards is not yet supported.");
@@ -128,19 +229,19 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTra
 
     storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
 
-    labelling.addLabel("init", symbolicMdp.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicMdp.getDeadlockStates().toVector(odd));
+    labelling.addLabel("init", permutation.permuteStates(symbolicMdp.getInitialStates().toVector(odd)));
+    labelling.addLabel("deadlock", permutation.permuteStates(symbolicMdp.getDeadlockStates().toVector(odd)));
     if (formulas.empty()) {
         for (auto const& label : symbolicMdp.getLabels()) {
-            labelling.addLabel(label, symbolicMdp.getStates(label).toVector(odd));
+            labelling.addLabel(label, permutation.permuteStates(symbolicMdp.getStates(label).toVector(odd)));
         }
     } else {
         LabelInformation labelInfo(formulas);
         for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicMdp.getStates(label).toVector(odd));
+            labelling.addLabel(label, permutation.permuteStates(symbolicMdp.getStates(label).toVector(odd)));
         }
         for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicMdp.getStates(expressionLabel.second).toVector(odd));
+            labelling.addLabel(expressionLabel.first, permutation.permuteStates(symbolicMdp.getStates(expressionLabel.second).toVector(odd)));
         }
     }
 
@@ -149,41 +250,44 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTra
 
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> SymbolicCtmcToSparseCtmcTransformer<Type, ValueType>::translate(
-    storm::models::symbolic::Ctmc<Type, ValueType> const& symbolicCtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    storm::models::symbolic::Ctmc<Type, ValueType> const& symbolicCtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+    SparseStateOrder const& stateOrder) {
     storm::dd::Odd odd = symbolicCtmc.getReachableStates().createOdd();
     storm::storage::SparseMatrix<ValueType> transitionMatrix = symbolicCtmc.getTransitionMatrix().toMatrix(odd, odd);
+    StatePermutation<ValueType> permutation(stateOrder, transitionMatrix, symbolicCtmc.getInitialStates().toVector(odd));
+    transitionMatrix = permutation.permuteMatrix(std::move(transitionMatrix));
     std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
     for (auto const& rewardModelNameAndModel : symbolicCtmc.getRewardModels()) {
         boost::optional<std::vector<ValueType>> stateRewards;
         boost::optional<std::vector<ValueType>> stateActionRewards;
         boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
         if (rewardModelNameAndModel.second.hasStateRewards()) {
-            stateRewards = rewardModelNameAndModel.second.getStateRewardVector().toVector(odd);
+            stateRewards = permutation.permuteStateVector(rewardModelNameAndModel.second.getStateRewardVector().toVector(odd));
         }
         if (rewardModelNameAndModel.second.hasStateActionRewards()) {
-            stateActionRewards = rewardModelNameAndModel.second.getStateActionRewardVector().toVector(odd);
+            stateActionRewards = permutation.permuteStateVector(rewardModelNameAndModel.second.getStateActionRewardVector().toVector(odd));
         }
         if (rewardModelNameAndModel.second.hasTransitionRewards()) {
-            transitionRewards = rewardModelNameAndModel.second.getTransitionRewardMatrix().toMatrix(odd, odd);
+            transitionRewards = permutation.permuteMatrix(rewardModelNameAndModel.second.getTransitionRewardMatrix().toMatrix(odd, odd));
         }
         rewardModels.emplace(rewardModelNameAndModel.first,
                              storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
     storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
 
-    labelling.addLabel("init", symbolicCtmc.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicCtmc.getDeadlockStates().toVector(odd));
+    labelling.addLabel("init", permutation.permuteStates(symbolicCtmc.getInitialStates().toVector(odd)));
+    labelling.addLabel("deadlock", permutation.permuteStates(symbolicCtmc.getDeadlockStates().toVector(odd)));
     if (formulas.empty()) {
         for (auto const& label : symbolicCtmc.getLabels()) {
-            labelling.addLabel(label, symbolicCtmc.getStates(label).toVector(odd));
+            labelling.addLabel(label, permutation.permuteStates(symbolicCtmc.getStates(label).toVector(odd)));
         }
     } else {
         LabelInformation labelInfo(formulas);
         for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicCtmc.getStates(label).toVector(odd));
+            labelling.addLabel(label, permutation.permuteStates(symbolicCtmc.getStates(label).toVector(odd)));
         }
         for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicCtmc.getStates(expressionLabel.second).toVector(odd));
+            labelling.addLabel(expressionLabel.first, permutation.permuteStates(symbolicCtmc.getStates(expressionLabel.second).toVector(odd)));
         }
     }
 
@@ -192,7 +296,8 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> SymbolicCtmcToSparseCtmc
 
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> SymbolicMaToSparseMaTransformer<Type, ValueType>::translate(
-    storm::models::symbolic::MarkovAutomaton<Type, ValueType> const& symbolicMa, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    storm::models::symbolic::MarkovAutomaton<Type, ValueType> const& symbolicMa, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+    SparseStateOrder const& stateOrder) {
     storm::dd::Odd odd = symbolicMa.getReachableStates().createOdd();
     // Collect action reward vectors that need translation
     std::vector<storm::dd::Add<Type, ValueType>> symbolicActionRewardVectors;
@@ -213,6 +318,8 @@ std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> SymbolicMaToS
         transitionMatrix = std::move(matrRewards.first);
         actionRewardVectors = std::move(matrRewards.second);
     }
+    StatePermutation<ValueType> permutation(stateOrder, transitionMatrix, symbolicMa.getInitialStates().toVector(odd));
+    transitionMatrix = permutation.permuteMatrix(std::move(transitionMatrix));
 
     // Translate reward models
     std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
@@ -221,11 +328,11 @@ std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> SymbolicMaToS
         boost::optional<std::vector<ValueType>> stateActionRewards;
         boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
         if (rewardModelNameAndModel.second.hasStateRewards()) {
-            stateRewards = rewardModelNameAndModel.second.getStateRewardVector().toVector(odd);
+            stateRewards = permutation.permuteStateVector(rewardModelNameAndModel.second.getStateRewardVector().toVector(odd));
         }
         auto actRewIndexIt = rewardNameToActionRewardIndexMap.find(rewardModelNameAndModel.first);
         if (actRewIndexIt != rewardNameToActionRewardIndexMap.end()) {
-            stateActionRewards = std::move(actionRewardVectors[actRewIndexIt->second]);
+            stateActionRewards = permutation.permuteChoiceVector(std::move(actionRewardVectors[actRewIndexIt->second]));
         }
         STORM_LOG_THROW(!rewardModelNameAndModel.second.hasTransitionRewards(), storm::exceptions::NotImplementedException,
                         "Translation of symbolic to explicit transition rewards is not yet supported.");
@@ -235,25 +342,25 @@ std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> SymbolicMaToS
 
     storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
 
-    labelling.addLabel("init", symbolicMa.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicMa.getDeadlockStates().toVector(odd));
+    labelling.addLabel("init", permutation.permuteStates(symbolicMa.getInitialStates().toVector(odd)));
+    labelling.addLabel("deadlock", permutation.permuteStates(symbolicMa.getDeadlockStates().toVector(odd)));
     if (formulas.empty()) {
         for (auto const& label : symbolicMa.getLabels()) {
-            labelling.addLabel(label, symbolicMa.getStates(label).toVector(odd));
+            labelling.addLabel(label, permutation.permuteStates(symbolicMa.getStates(label).toVector(odd)));
         }
     } else {
         LabelInformation labelInfo(formulas);
         for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicMa.getStates(label).toVector(odd));
+            labelling.addLabel(label, permutation.permuteStates(symbolicMa.getStates(label).toVector(odd)));
         }
         for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicMa.getStates(expressionLabel.second).toVector(odd));
+            labelling.addLabel(expressionLabel.first, permutation.permuteStates(symbolicMa.getStates(expressionLabel.second).toVector(odd)));
         }
     }
-    storm::storage::BitVector markovianStates = symbolicMa.getMarkovianStates().toVector(odd);
+    storm::storage::BitVector markovianStates = permutation.permuteStates(symbolicMa.getMarkovianStates().toVector(odd));
     storm::storage::sparse::ModelComponents<ValueType> components(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels), false,
                                                                   std::move(markovianStates));
-    components.exitRates = symbolicMa.getExitRateVector().toVector(odd);
+    components.exitRates = permutation.permuteStateVector(symbolicMa.getExitRateVector().toVector(odd));
 
     return std::make_shared<storm::models::sparse::MarkovAutomaton<ValueType>>(std::move(components));
 }
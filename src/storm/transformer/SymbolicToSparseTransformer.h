@@ -11,6 +11,7 @@
 #include "storm/models/symbolic/Mdp.h"
 
 #include "storm/storage/dd/Odd.h"
+#include "storm/transformer/SparseStateOrder.h"
 
 namespace storm {
 namespace transformer {
@@ -20,7 +21,13 @@ class SymbolicDtmcToSparseDtmcTransformer {
    public:
     std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> translate(
         storm::models::symbolic::Dtmc<Type, ValueType> const& symbolicDtmc,
-        std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = std::vector<std::shared_ptr<storm::logic::Formula const>>());
+        std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = std::vector<std::shared_ptr<storm::logic::Formula const>>(),
+        SparseStateOrder const& stateOrder = SparseStateOrder::Odd);
+
+    /*!
+     * Retrieves the ODD of the last translation. Note that it only reflects the numbering of the states of the sparse
+     * model if the states were translated in ODD order.
+     */
     storm::dd::Odd const& getOdd() const;
 
    private:
@@ -32,7 +39,8 @@ class SymbolicMdpToSparseMdpTransformer {
    public:
     static std::shared_ptr<storm::models::sparse::Mdp<ValueType>> translate(
         storm::models::symbolic::Mdp<Type, ValueType> const& symbolicMdp,
-        std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = std::vector<std::shared_ptr<storm::logic::Formula const>>());
+        std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = std::vector<std::shared_ptr<storm::logic::Formula const>>(),
+        SparseStateOrder const& stateOrder = SparseStateOrder::Odd);
 };
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -40,7 +48,8 @@ class SymbolicCtmcToSparseCtmcTransformer {
    public:
     static std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> translate(
         storm::models::symbolic::Ctmc<Type, ValueType> const& symbolicCtmc,
-        std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = std::vector<std::shared_ptr<storm::logic::Formula const>>());
+        std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = std::vector<std::shared_ptr<storm::logic::Formula const>>(),
+        SparseStateOrder const& stateOrder = SparseStateOrder::Odd);
 };
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -48,7 +57,8 @@ class SymbolicMaToSparseMaTransformer {
    public:
     static std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> translate(
         storm::models::symbolic::MarkovAutomaton<Type, ValueType> const& symbolicMa,
-        std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = std::vector<std::shared_ptr<storm::logic::Formula const>>());
+        std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = std::vector<std::shared_ptr<storm::logic::Formula const>>(),
+        SparseStateOrder const& stateOrder = SparseStateOrder::Odd);
 };
 }  // namespace transformer
 }  // namespace storm
@@ -1,5 +1,7 @@
 #include "storm/utility/dd.h"
 
+#include <algorithm>
+
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
@@ -49,6 +51,157 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
     return {reachableStates, iteration};
 }
 
+template<storm::dd::DdType Type>
+std::vector<TransitionRelationPartition<Type>> createTransitionRelationPartitions(
+    std::vector<storm::dd::Bdd<Type>> const& relations,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
+    std::vector<TransitionRelationPartition<Type>> partitions;
+    for (auto const& relation : relations) {
+        if (relation.isZero()) {
+            continue;
+        }
+
+        TransitionRelationPartition<Type> partition{relation, {}, {}};
+        for (auto const& rowColumnPair : rowColumnMetaVariablePairs) {
+            if (!partition.relation.containsMetaVariable(rowColumnPair.second)) {
+                // The relation does not restrict the successor value, which can only happen if the variable is left untouched.
+                continue;
+            }
+            storm::dd::Bdd<Type> identity = getRowColumnDiagonal(relation.getDdManager(), {rowColumnPair});
+            if ((partition.relation && !identity).isZero()) {
+                // The variable keeps its value in all transitions of this relation, so we can drop the successor variable.
+                partition.relation = partition.relation.existsAbstract({rowColumnPair.second});
+            } else {
+                partition.rowMetaVariables.insert(rowColumnPair.first);
+                partition.columnMetaVariables.insert(rowColumnPair.second);
+            }
+        }
+        partitions.push_back(std::move(partition));
+    }
+
+    // Sort the partitions such that the ones whose topmost variable is lowest in the variable order come first.
+    std::stable_sort(partitions.begin(), partitions.end(),
+                     [](TransitionRelationPartition<Type> const& first, TransitionRelationPartition<Type> const& second) {
+                         return first.relation.getLevel() > second.relation.getLevel();
+                     });
+    STORM_LOG_TRACE("Created " << partitions.size() << " partition(s) of the transition relation.");
+    return partitions;
+}
+
+template<storm::dd::DdType Type>
+std::vector<storm::dd::Bdd<Type>> splitTransitionRelation(storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& splitMetaVariables,
+                                                          uint64_t maximalNumberOfParts) {
+    // Gather the DD variables along which we split, ordered by their level.
+    std::vector<std::pair<uint64_t, storm::dd::Bdd<Type>>> levelsAndDdVariables;
+    for (auto const& metaVariable : splitMetaVariables) {
+        storm::dd::DdMetaVariable<Type> const& variable = transitions.getDdManager().getMetaVariable(metaVariable);
+        for (auto const& ddVariable : variable.getDdVariables()) {
+            levelsAndDdVariables.emplace_back(ddVariable.getLevel(), ddVariable);
+        }
+    }
+    std::sort(levelsAndDdVariables.begin(), levelsAndDdVariables.end(),
+              [](std::pair<uint64_t, storm::dd::Bdd<Type>> const& first, std::pair<uint64_t, storm::dd::Bdd<Type>> const& second) {
+                  return first.first < second.first;
+              });
+
+    std::vector<storm::dd::Bdd<Type>> parts = {transitions};
+    for (auto const& levelAndDdVariable : levelsAndDdVariables) {
+        if (2 * parts.size() > maximalNumberOfParts) {
+            break;
+        }
+        std::vector<storm::dd::Bdd<Type>> newParts;
+        for (auto const& part : parts) {
+            storm::dd::Bdd<Type> positivePart = part && levelAndDdVariable.second;
+            storm::dd::Bdd<Type> negativePart = part && !levelAndDdVariable.second;
+            if (!positivePart.isZero()) {
+                newParts.push_back(std::move(positivePart));
+            }
+            if (!negativePart.isZero()) {
+                newParts.push_back(std::move(negativePart));
+            }
+        }
+        parts = std::move(newParts);
+    }
+
+    for (auto& part : parts) {
+        part = part.existsAbstract(splitMetaVariables);
+    }
+    return parts;
+}
+
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates,
+                                                                 std::vector<TransitionRelationPartition<Type>> const& partitions,
+                                                                 storm::builder::DdReachabilityMethod const& method) {
+    STORM_LOG_TRACE("Computing reachable states using " << method << " on " << partitions.size() << " partition(s) of the transition relation, "
+                                                        << initialStates.getNonZeroCount() << " initial states.");
+
+    auto start = std::chrono::high_resolution_clock::now();
+    storm::dd::Bdd<Type> reachableStates = initialStates;
+    auto image = [](storm::dd::Bdd<Type> const& states, TransitionRelationPartition<Type> const& partition) {
+        return states.relationalProduct(partition.relation, partition.rowMetaVariables, partition.columnMetaVariables);
+    };
+
+    uint_fast64_t iteration = 0;
+    switch (method) {
+        case storm::builder::DdReachabilityMethod::Bfs: {
+            // Only compute the image of the states discovered in the last iteration.
+            storm::dd::Bdd<Type> frontier = initialStates;
+            while (!frontier.isZero()) {
+                storm::dd::Bdd<Type> successors = frontier.getDdManager().getBddZero();
+                for (auto const& partition : partitions) {
+                    successors |= image(frontier, partition);
+                }
+                frontier = successors && !reachableStates;
+                reachableStates |= frontier;
+                ++iteration;
+            }
+            break;
+        }
+        case storm::builder::DdReachabilityMethod::Chaining: {
+            bool changed = true;
+            while (changed) {
+                changed = false;
+                for (auto const& partition : partitions) {
+                    storm::dd::Bdd<Type> newReachableStates = image(reachableStates, partition) && !reachableStates;
+                    if (!newReachableStates.isZero()) {
+                        reachableStates |= newReachableStates;
+                        changed = true;
+                    }
+                }
+                ++iteration;
+            }
+            break;
+        }
+        case storm::builder::DdReachabilityMethod::ChainingWithRestart: {
+            uint64_t partitionIndex = 0;
+            while (partitionIndex < partitions.size()) {
+                // Apply the current partition until no new states are found.
+                bool changed = false;
+                storm::dd::Bdd<Type> newReachableStates = image(reachableStates, partitions[partitionIndex]) && !reachableStates;
+                while (!newReachableStates.isZero()) {
+                    changed = true;
+                    reachableStates |= newReachableStates;
+                    newReachableStates = image(newReachableStates, partitions[partitionIndex]) && !reachableStates;
+                    ++iteration;
+                }
+                // If new states were found, the partitions at lower levels need to be applied again.
+                partitionIndex = (changed && partitionIndex > 0) ? 0 : partitionIndex + 1;
+            }
+            break;
+        }
+        default:
+            STORM_LOG_ASSERT(false, "Unknown reachability method.");
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_TRACE("Reachability computation completed in " << iteration << " iterations ("
+                                                             << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms), "
+                                                             << reachableStates.getNonZeroCount() << " reachable states found.");
+
+    return {reachableStates, iteration};
+}
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -94,6 +247,147 @@ storm::dd::Bdd<Type> getRowColumnDiagonal(
     return ddManager.getIdentity(rowColumnMetaVariablePairs, false);
 }
 
+template<storm::dd::DdType Type>
+std::vector<std::vector<storm::dd::Bdd<Type>>> computeSccLayers(
+    storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // The SCCs are computed with the skeleton-based forward-backward search of Gentilini et al., which needs a linear number of symbolic steps
+    // and yields the SCCs in reverse topological order, i.e., every SCC after all SCCs it can reach. Hence, the layer of a component (one more
+    // than the highest layer of its successors) can be determined as soon as the component is found, so all layers are peeled in one pass.
+    storm::dd::DdManager<Type> const& manager = states.getDdManager();
+    storm::dd::Bdd<Type> relation = transitions && states && states.swapVariables(rowColumnMetaVariablePairs);
+    storm::dd::Bdd<Type> relationWithoutSelfLoops = relation && !getRowColumnDiagonal(manager, rowColumnMetaVariablePairs);
+    std::vector<storm::dd::Bdd<Type>> layerStates;
+    std::vector<storm::dd::Bdd<Type>> trivialComponents;
+    std::vector<std::vector<storm::dd::Bdd<Type>>> nontrivialComponents;
+    auto addToLayer = [&](uint64_t layer, storm::dd::Bdd<Type> const& component, bool trivial) {
+        if (layer == layerStates.size()) {
+            layerStates.push_back(manager.getBddZero());
+            trivialComponents.push_back(manager.getBddZero());
+            nontrivialComponents.emplace_back();
+        }
+        layerStates[layer] |= component;
+        if (trivial) {
+            trivialComponents[layer] |= component;
+        } else {
+            nontrivialComponents[layer].push_back(component);
+        }
+    };
+    auto pickState = [&rowMetaVariables](storm::dd::Bdd<Type> const& states) { return states.existsAbstractRepresentative(rowMetaVariables); };
+
+    // The work list contains sets of states that still need to be decomposed and SCCs whose layer needs to be determined. It is processed such
+    // that all successors of the states of an entry are handled before the entry itself. A set of states may come with a spine, i.e., a path
+    // that ends in the given node, which is a good choice for the next pivot state.
+    struct WorkItem {
+        storm::dd::Bdd<Type> states;
+        storm::dd::Bdd<Type> spine;
+        storm::dd::Bdd<Type> node;
+        bool isScc;
+    };
+    std::vector<WorkItem> workList = {WorkItem{states, manager.getBddZero(), manager.getBddZero(), false}};
+    uint64_t numberOfComponents = 0;
+    while (!workList.empty()) {
+        WorkItem item = std::move(workList.back());
+        workList.pop_back();
+
+        if (item.isScc) {
+            storm::dd::Bdd<Type> successors = item.states.relationalProduct(relation, rowMetaVariables, columnMetaVariables) && !item.states;
+            uint64_t layer = layerStates.size();
+            while (layer > 0 && (successors && layerStates[layer - 1]).isZero()) {
+                --layer;
+            }
+            addToLayer(layer, item.states, false);
+            ++numberOfComponents;
+            continue;
+        }
+
+        // States without transitions to other states of the set only have successors that were already handled, so they can be treated at once.
+        storm::dd::Bdd<Type> remainingStates = item.states;
+        while (true) {
+            storm::dd::Bdd<Type> trivialStates =
+                remainingStates && !(relationWithoutSelfLoops && remainingStates.swapVariables(rowColumnMetaVariablePairs)).existsAbstract(columnMetaVariables);
+            if (trivialStates.isZero()) {
+                break;
+            }
+            remainingStates &= !trivialStates;
+            for (uint64_t layer = layerStates.size(); layer > 0 && !trivialStates.isZero(); --layer) {
+                storm::dd::Bdd<Type> statesInLayer =
+                    trivialStates && layerStates[layer - 1].inverseRelationalProduct(relation, rowMetaVariables, columnMetaVariables);
+                if (!statesInLayer.isZero()) {
+                    addToLayer(layer, statesInLayer, true);
+                    trivialStates &= !statesInLayer;
+                }
+            }
+            if (!trivialStates.isZero()) {
+                addToLayer(0, trivialStates, true);
+            }
+        }
+        if (remainingStates.isZero()) {
+            continue;
+        }
+        storm::dd::Bdd<Type> remainingRelation = relation && remainingStates && remainingStates.swapVariables(rowColumnMetaVariablePairs);
+
+        // Removing trivial states only cuts off the end of the spine, so its new end is a predecessor of the removed part.
+        storm::dd::Bdd<Type> spine = item.spine && remainingStates;
+        storm::dd::Bdd<Type> node = item.node && remainingStates;
+        if (node.isZero() && !spine.isZero()) {
+            node = pickState(spine && (item.spine && !remainingStates).inverseRelationalProduct(relation, rowMetaVariables, columnMetaVariables));
+        }
+        storm::dd::Bdd<Type> pivot = node.isZero() ? pickState(remainingStates) : node;
+
+        // Compute the states reachable from the pivot level by level together with a path from the pivot to a state on the last level.
+        std::vector<storm::dd::Bdd<Type>> forwardLevels = {pivot};
+        storm::dd::Bdd<Type> forwardStates = pivot;
+        while (true) {
+            storm::dd::Bdd<Type> frontier = forwardLevels.back().relationalProduct(remainingRelation, rowMetaVariables, columnMetaVariables) && !forwardStates;
+            if (frontier.isZero()) {
+                break;
+            }
+            forwardStates |= frontier;
+            forwardLevels.push_back(std::move(frontier));
+        }
+        storm::dd::Bdd<Type> forwardNode = pickState(forwardLevels.back());
+        storm::dd::Bdd<Type> forwardSpine = forwardNode;
+        storm::dd::Bdd<Type> current = forwardNode;
+        for (uint64_t level = forwardLevels.size() - 1; level > 0; --level) {
+            current = pickState(forwardLevels[level - 1] && current.inverseRelationalProduct(remainingRelation, rowMetaVariables, columnMetaVariables));
+            forwardSpine |= current;
+        }
+        forwardLevels.clear();
+
+        // The reachable states are handled first, then the SCC of the pivot and finally the other states (that may reach the SCC). The part of
+        // the previous spine outside the SCC leads to the SCC, so its end is a predecessor of the SCC.
+        storm::dd::Bdd<Type> scc = computeBackwardsReachableStates(pivot, forwardStates, remainingRelation, rowMetaVariables, columnMetaVariables);
+        storm::dd::Bdd<Type> otherStates = remainingStates && !forwardStates;
+        storm::dd::Bdd<Type> otherSpine = spine && otherStates;
+        storm::dd::Bdd<Type> otherNode = otherSpine.isZero()
+                                             ? manager.getBddZero()
+                                             : pickState(otherSpine && scc.inverseRelationalProduct(remainingRelation, rowMetaVariables, columnMetaVariables));
+        workList.push_back(WorkItem{std::move(otherStates), std::move(otherSpine), std::move(otherNode), false});
+        workList.push_back(WorkItem{scc, manager.getBddZero(), manager.getBddZero(), true});
+        workList.push_back(WorkItem{forwardStates && !scc, forwardSpine && !scc, forwardNode && !scc, false});
+    }
+
+    std::vector<std::vector<storm::dd::Bdd<Type>>> layers(layerStates.size());
+    for (uint64_t layer = 0; layer < layerStates.size(); ++layer) {
+        if (!trivialComponents[layer].isZero()) {
+            layers[layer].push_back(std::move(trivialComponents[layer]));
+            ++numberOfComponents;
+        }
+        for (auto& component : nontrivialComponents[layer]) {
+            layers[layer].push_back(std::move(component));
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_TRACE("Decomposition into " << numberOfComponents << " component(s) in " << layers.size() << " layer(s) completed in "
+                                          << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
+    return layers;
+}
+
 template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates,
                                                                                              storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
                                                                                              std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -102,6 +396,26 @@ template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeR
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
     std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+template std::vector<TransitionRelationPartition<storm::dd::DdType::CUDD>> createTransitionRelationPartitions(
+    std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& relations,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+template std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> splitTransitionRelation(storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
+                                                                                  std::set<storm::expressions::Variable> const& splitMetaVariables,
+                                                                                  uint64_t maximalNumberOfParts);
+template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStates(
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, std::vector<TransitionRelationPartition<storm::dd::DdType::CUDD>> const& partitions,
+    storm::builder::DdReachabilityMethod const& method);
+
+template std::vector<TransitionRelationPartition<storm::dd::DdType::Sylvan>> createTransitionRelationPartitions(
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& relations,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> splitTransitionRelation(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
+                                                                                  std::set<storm::expressions::Variable> const& splitMetaVariables,
+                                                                                  uint64_t maximalNumberOfParts);
+template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeReachableStates(
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, std::vector<TransitionRelationPartition<storm::dd::DdType::Sylvan>> const& partitions,
+    storm::builder::DdReachabilityMethod const& method);
+
 template storm::dd::Bdd<storm::dd::DdType::CUDD> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates,
                                                                                  storm::dd::Bdd<storm::dd::DdType::CUDD> const& constraintStates,
                                                                                  storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
@@ -113,6 +427,15 @@ template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeBackwardsReachableStat
                                                                                    std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                                    std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+template std::vector<std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>>> computeSccLayers(
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& states, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+template std::vector<std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>>> computeSccLayers(
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
 template storm::dd::Bdd<storm::dd::DdType::CUDD> getRowColumnDiagonal(
     storm::dd::DdManager<storm::dd::DdType::CUDD> const& ddManager,
     std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
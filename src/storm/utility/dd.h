@@ -4,6 +4,7 @@
 #include <set>
 #include <vector>
 
+#include "storm/builder/DdReachabilityMethod.h"
 #include "storm/storage/dd/DdType.h"
 
 namespace storm {
@@ -29,11 +30,73 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
                                                                  std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                  std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+/*!
+ * A part of a (partitioned) transition relation. The relation only refers to the given row and column meta variables, i.e., all other variables keep
+ * their values when taking a transition of this part.
+ */
+template<storm::dd::DdType Type>
+struct TransitionRelationPartition {
+    storm::dd::Bdd<Type> relation;
+    std::set<storm::expressions::Variable> rowMetaVariables;
+    std::set<storm::expressions::Variable> columnMetaVariables;
+};
+
+/*!
+ * Creates the partitions of a transition relation from the given relations. For each relation, variables that are not changed by any of its transitions
+ * are removed from the relation, such that images only need to be computed w.r.t. the variables that are actually changed.
+ *
+ * @param relations The relations (over row and column meta variables) whose union is the transition relation.
+ * @param rowColumnMetaVariablePairs The pairs of row and column meta variables.
+ * @return The partitions sorted by the level of their topmost variable in descending order (i.e., partitions affecting lower levels come first).
+ */
+template<storm::dd::DdType Type>
+std::vector<TransitionRelationPartition<Type>> createTransitionRelationPartitions(
+    std::vector<storm::dd::Bdd<Type>> const& relations,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
+/*!
+ * Splits the given transition relation by the values of the given meta variables (e.g., the variables encoding nondeterminism) and abstracts from these
+ * variables afterwards. The split is performed along the DD variables of the given meta variables (ordered by their level) as long as the number of
+ * parts does not exceed the given maximum.
+ */
+template<storm::dd::DdType Type>
+std::vector<storm::dd::Bdd<Type>> splitTransitionRelation(storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& splitMetaVariables,
+                                                          uint64_t maximalNumberOfParts);
+
+/*!
+ * Computes the states reachable from the initial states using the given partitioned transition relation.
+ *
+ * @param method The method to use. Breadth-first search computes the image of all partitions in each iteration. Chaining applies the partitions one after
+ * another on the current set of states. Chaining with restart applies each partition (from low to high levels) until a local fixpoint is reached and restarts
+ * with the lowest partition whenever a partition discovered new states.
+ * @return The reachable states and the number of performed iterations.
+ */
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates,
+                                                                 std::vector<TransitionRelationPartition<Type>> const& partitions,
+                                                                 storm::builder::DdReachabilityMethod const& method);
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                      std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+/*!
+ * Decomposes the given states into layers of strongly connected components (SCCs) w.r.t. the given transition relation. The first layer consists of
+ * bottom SCCs of the given states, the second layer of the bottom SCCs that remain after removing the first layer and so on. Hence, the components of
+ * a layer do not reach each other and only depend on components of earlier layers. States that have no transitions to other states of the decomposition
+ * (except for themselves and states of earlier layers) are not split into singleton SCCs, but are gathered in a single component per layer.
+ *
+ * @param states The states to decompose.
+ * @param transitions The transition relation (over row and column meta variables).
+ * @return The layers of components, starting with the bottom-most layer.
+ */
+template<storm::dd::DdType Type>
+std::vector<std::vector<storm::dd::Bdd<Type>>> computeSccLayers(
+    storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Add<Type, ValueType> getRowColumnDiagonal(
     storm::dd::DdManager<Type> const& ddManager,
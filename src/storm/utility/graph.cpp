@@ -599,7 +599,7 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
     // set an arbitrary (valid) choice for the psi states.
     for (auto psiState : psiStates) {
         for (uint_fast64_t memState = 0; memState < scheduler.getNumberOfMemoryStates(); ++memState) {
-            if (!scheduler.getChoice(psiState, memState).isDefined()) {
+            if (!scheduler.isChoiceDefined(psiState, memState)) {
                 scheduler.setChoice(0, psiState, memState);
             }
         }
@@ -0,0 +1,111 @@
+#include "storm/utility/resources.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ResourceSettings.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+namespace resources {
+
+uint64_t getCgroupMemoryLimit() {
+    std::ifstream cgroupStream("/proc/self/cgroup");
+    std::stringstream processCgroups;
+    processCgroups << cgroupStream.rdbuf();
+
+    // The effective limit is the tightest limit of the control group of the process and its ancestors. An unlimited cgroup v2 reports 'max',
+    // which fails to parse, and an unlimited cgroup v1 reports a value close to the maximal 64-bit integer.
+    uint64_t const unlimited = 1ull << 62;
+    uint64_t limit = unlimited;
+    std::string limitFile;
+    for (std::string const& file : getCgroupMemoryLimitFiles(processCgroups.str())) {
+        std::ifstream stream(file);
+        uint64_t fileLimit = 0;
+        if (stream >> fileLimit && fileLimit < limit) {
+            limit = fileLimit;
+            limitFile = file;
+        }
+    }
+    if (limit == unlimited) {
+        return 0;
+    }
+    STORM_LOG_DEBUG("Found a memory limit of " << limit / (1024 * 1024) << "MB in " << limitFile << ".");
+    return limit;
+}
+
+std::vector<std::string> getCgroupMemoryLimitFiles(std::string const& processCgroups, std::string const& cgroupMountPoint) {
+    std::vector<std::string> result;
+    auto addFilesOfHierarchy = [&result](std::string const& hierarchyRoot, std::string path, std::string const& limitFileName) {
+        // Walk up from the control group of the process to the root of the hierarchy.
+        while (true) {
+            while (!path.empty() && path.back() == '/') {
+                path.pop_back();
+            }
+            result.push_back(hierarchyRoot + path + "/" + limitFileName);
+            if (path.empty()) {
+                break;
+            }
+            path.erase(path.find_last_of('/'));
+        }
+    };
+
+    // Every line has the form 'hierarchy-ID:controller-list:cgroup-path', where the path may contain colons itself.
+    std::istringstream stream(processCgroups);
+    std::string line;
+    while (std::getline(stream, line)) {
+        std::size_t firstColon = line.find(':');
+        std::size_t secondColon = firstColon == std::string::npos ? std::string::npos : line.find(':', firstColon + 1);
+        if (secondColon == std::string::npos) {
+            continue;
+        }
+        std::string hierarchyId = line.substr(0, firstColon);
+        std::string controllers = line.substr(firstColon + 1, secondColon - firstColon - 1);
+        std::string path = line.substr(secondColon + 1);
+        if (path.empty() || path.front() != '/') {
+            continue;
+        }
+
+        if (hierarchyId == "0" && controllers.empty()) {
+            addFilesOfHierarchy(cgroupMountPoint, path, "memory.max");
+        } else {
+            std::istringstream controllerStream(controllers);
+            std::string controller;
+            while (std::getline(controllerStream, controller, ',')) {
+                if (controller == "memory") {
+                    addFilesOfHierarchy(cgroupMountPoint + "/memory", path, "memory.limit_in_bytes");
+                    break;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+uint64_t getDdMemoryBudget() {
+    auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    if (!resourceSettings.isDdMemoryBudgetSet()) {
+        return 0;
+    }
+    if (resourceSettings.getDdMemoryBudget() > 0) {
+        return resourceSettings.getDdMemoryBudget() * 1024 * 1024;
+    }
+
+    uint64_t limit = getCgroupMemoryLimit();
+    if (limit == 0) {
+        STORM_LOG_WARN("Unable to determine the memory limit of the control group, so no DD memory budget is enforced.");
+        return 0;
+    }
+
+    // Leave some of the memory of the control group to the remaining data structures of the process.
+    uint64_t budget = limit / 4 * 3;
+    STORM_LOG_INFO("Using a DD memory budget of " << budget / (1024 * 1024) << "MB derived from the memory limit of the control group.");
+    return budget;
+}
+
+}  // namespace resources
+}  // namespace utility
+}  // namespace storm
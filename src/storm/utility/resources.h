@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace storm {
+namespace utility {
+namespace resources {
+
+/*!
+ * Retrieves the memory limit of the control group of the process, i.e., the tightest limit of the control group and its ancestors.
+ *
+ * @return The memory limit in bytes or zero if no limit could be determined.
+ */
+uint64_t getCgroupMemoryLimit();
+
+/*!
+ * Determines the files that may hold a memory limit of the control group of a process or of one of its ancestors.
+ * Both the unified hierarchy of cgroups v2 (`0::/path`) and the memory controller of cgroups v1 are considered.
+ *
+ * @param processCgroups The content of `/proc/<pid>/cgroup` of the process.
+ * @param cgroupMountPoint The directory at which the control group file system is mounted.
+ * @return The files, starting with the ones of the control group of the process and ending with the ones of the root.
+ */
+std::vector<std::string> getCgroupMemoryLimitFiles(std::string const& processCgroups, std::string const& cgroupMountPoint = "/sys/fs/cgroup");
+
+/*!
+ * Retrieves the memory budget of the DD library as selected by the settings (see `--dd-memory-budget`). If the budget
+ * is set to zero, it is derived from the memory limit of the control group of the process.
+ *
+ * @return The memory budget in bytes or zero if no budget is to be enforced.
+ */
+uint64_t getDdMemoryBudget();
+
+}  // namespace resources
+}  // namespace utility
+}  // namespace storm
@@ -2,8 +2,12 @@
 #include "test/storm_gtest.h"
 
 #include "storm-dft/api/storm-dft.h"
+#include "storm-dft/builder/ExplicitDFTModelBuilder.h"
 #include "storm-dft/transformations/DftTransformator.h"
 #include "storm-parsers/api/storm-parsers.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 namespace {
 
@@ -241,4 +245,34 @@ TYPED_TEST(DftModelCheckerTest, HecsReliability) {
     double result = this->analyzeReliability(STORM_TEST_RESOURCES_DIR "/dft/hecs_2_2.dft", 1.0);
     EXPECT_FLOAT_EQ(result, 0.00021997582);
 }
+
+TEST(DftModelCheckerParallelTest, VotingManyBEs) {
+    // The initial state and all states with one failed BE have at least 16 failable BEs, so their successors are computed in parallel if TBB is enabled.
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft = storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/voting5.dft");
+    EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> properties =
+        storm::api::extractFormulasFromProperties(storm::api::parseProperties("Tmin=? [F \"failed\"]"));
+    storm::dft::utility::RelevantEvents relevantEvents = storm::dft::api::computeRelevantEvents<double>(*dft, properties, {"all"});
+    dft->setRelevantEvents(relevantEvents, false);
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::dft::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+
+    // Sequential exploration
+    storm::dft::builder::ExplicitDFTModelBuilder<double> sequentialBuilder(*dft, symmetries);
+    sequentialBuilder.buildModel(0, 0.0);
+    std::shared_ptr<storm::models::sparse::Model<double>> sequentialModel = sequentialBuilder.getModel();
+    double sequentialResult = boost::get<double>(storm::dft::api::analyzeDFT<double>(*dft, properties, false, false, relevantEvents, false)[0]);
+    EXPECT_LT(17ul, sequentialModel->getNumberOfStates());
+
+    // Parallel exploration
+    std::unique_ptr<storm::settings::SettingMemento> useTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+    storm::dft::builder::ExplicitDFTModelBuilder<double> parallelBuilder(*dft, symmetries);
+    parallelBuilder.buildModel(0, 0.0);
+    std::shared_ptr<storm::models::sparse::Model<double>> parallelModel = parallelBuilder.getModel();
+    double parallelResult = boost::get<double>(storm::dft::api::analyzeDFT<double>(*dft, properties, false, false, relevantEvents, false)[0]);
+
+    EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates());
+    EXPECT_EQ(sequentialModel->getNumberOfTransitions(), parallelModel->getNumberOfTransitions());
+    EXPECT_FLOAT_EQ(sequentialResult, parallelResult);
+}
 }  // namespace
@@ -6,6 +6,7 @@
 #include "storm-config.h"
 #include "storm-dft/adapters/SFTBDDPropertyFormulaAdapter.h"
 #include "storm-dft/api/storm-dft.h"
+#include "storm-dft/modelchecker/DFTModularizer.h"
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
 #include "storm-dft/utility/MTTFHelper.h"
@@ -14,6 +15,7 @@
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "test/storm_gtest.h"
 #include "utility/vector.h"
 
@@ -122,6 +124,30 @@ TEST_P(SftBddTest, RRW) {
     expectVectorNear(checker->getAllRRWsAtTimebound(1), param.RRW);
 }
 
+TEST_P(SftBddTest, AllImportanceMeasures) {
+    auto const &param{TestWithParam::GetParam()};
+    auto const measures{checker->getAllImportanceMeasuresAtTimepoints({0.5, 1}, 1)};
+    auto const checkMeasure = [&](std::vector<std::vector<double>> const &values, std::vector<double> const &expected) {
+        std::vector<double> valuesAtOne{};
+        for (auto const &i : values) {
+            ASSERT_EQ(i.size(), 2ul);
+            valuesAtOne.push_back(i[1]);
+        }
+        expectVectorNear(valuesAtOne, expected);
+    };
+    checkMeasure(measures.birnbaumFactors, param.birnbaum);
+    checkMeasure(measures.CIFs, param.CIF);
+    checkMeasure(measures.DIFs, param.DIF);
+    checkMeasure(measures.RAWs, param.RAW);
+    checkMeasure(measures.RRWs, param.RRW);
+
+    // Compare with the computation for a single basic event
+    auto const &basicElements{checker->getDFT()->getBasicElements()};
+    for (size_t i{0}; i < basicElements.size(); ++i) {
+        expectVectorNear(measures.birnbaumFactors[i], checker->getBirnbaumFactorsAtTimepoints(basicElements[i]->name(), {0.5, 1}));
+    }
+}
+
 static std::vector<SftTestData> sftTestData{
     {
         "And",
@@ -287,4 +313,33 @@ TEST(TestBdd, AndOrFormula) {
     EXPECT_EQ(result[7].GetShaHash(), "a4f129fa27c6cd32625b088811d4b12f8059ae0547ee035c083deed9ef9d2c59");
 }
 
+TEST(TestBdd, ModularizerIsomorphicDynamicModules) {
+    // The dynamic modules PSF_1 and PSF_2 are isomorphic
+    auto dft = storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/hecs_2_2.dft");
+    storm::dft::modelchecker::DFTModularizer sequentialChecker{dft};
+    auto const expected{sequentialChecker.getProbabilitiesAtTimepoints({0.5, 1})};
+    EXPECT_EQ(sequentialChecker.getNumberOfDynamicModuleAnalyses(), 1ul);
+
+    // Analyse the modules in parallel if TBB is available
+    std::unique_ptr<storm::settings::SettingMemento> useTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+    storm::dft::modelchecker::DFTModularizer checker{dft};
+
+    EXPECT_NEAR(checker.getProbabilityAtTimebound(1), 0.00021997582, 1e-10);
+    // Only the representative of the isomorphic modules is analysed
+    EXPECT_EQ(checker.getNumberOfDynamicModuleAnalyses(), 1ul);
+
+    // Results for already analysed timepoints are reused
+    auto const result{checker.getProbabilitiesAtTimepoints({0.5, 1})};
+    EXPECT_EQ(checker.getNumberOfDynamicModuleAnalyses(), 2ul);
+    EXPECT_EQ(result.size(), 2ul);
+    EXPECT_LT(result[0], result[1]);
+    EXPECT_NEAR(result[1], 0.00021997582, 1e-10);
+    EXPECT_NEAR(result[0], expected[0], 1e-10);
+    EXPECT_NEAR(result[1], expected[1], 1e-10);
+
+    // Nothing has to be analysed if all timepoints are known
+    checker.getProbabilityAtTimebound(0.5);
+    EXPECT_EQ(checker.getNumberOfDynamicModuleAnalyses(), 2ul);
+}
+
 }  // namespace
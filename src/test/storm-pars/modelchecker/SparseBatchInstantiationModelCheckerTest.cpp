@@ -0,0 +1,197 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include <filesystem>
+#include <fstream>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-pars/api/export.h"
+#include "storm-pars/api/storm-pars.h"
+#include "storm/api/storm.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+
+#include "storm-pars/modelchecker/instantiation/SparseBatchInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseMdpInstantiationModelChecker.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/io/file.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+
+    class SparseBatchInstantiationModelCheckerTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            carl::VariablePool::getInstance().clear();
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        }
+
+        void TearDown() override {
+            carl::VariablePool::getInstance().clear();
+        }
+
+        // Returns all valuations that assign one of the given values to each parameter
+        template<typename ModelType>
+        std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> getGrid(ModelType const& model, std::vector<double> const& values) {
+            auto parameters = storm::models::sparse::getProbabilityParameters(model);
+            auto rewParameters = storm::models::sparse::getRewardParameters(model);
+            parameters.insert(rewParameters.begin(), rewParameters.end());
+            std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> result(1);
+            for (auto const& parameter : parameters) {
+                std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> newResult;
+                for (auto const& value : values) {
+                    for (auto valuation : result) {
+                        valuation[parameter] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value);
+                        newResult.push_back(std::move(valuation));
+                    }
+                }
+                result = std::move(newResult);
+            }
+            return result;
+        }
+
+        template<typename ModelType, typename InstantiationModelCheckerType>
+        void compareWithInstantiationModelChecker(ModelType const& model, std::shared_ptr<storm::logic::Formula const> const& formula, std::vector<double> const& values) {
+            auto valuations = getGrid(model, values);
+
+            storm::modelchecker::SparseBatchInstantiationModelChecker<ModelType> batchChecker(model);
+            batchChecker.setBatchSize(5);
+            batchChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formula, true));
+            std::vector<double> batchResult = batchChecker.check(env, valuations);
+            ASSERT_EQ(valuations.size(), batchResult.size());
+
+            InstantiationModelCheckerType checker(model);
+            checker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formula, true));
+            uint64_t initialState = *model.getInitialStates().begin();
+            for (uint64_t i = 0; i < valuations.size(); ++i) {
+                auto result = checker.check(env, valuations[i]);
+                double expected = result->template asExplicitQuantitativeCheckResult<double>()[initialState];
+                EXPECT_NEAR(expected, batchResult[i], 1e-4 * std::max(1.0, std::abs(expected))) << "for valuation #" << i;
+            }
+        }
+
+        storm::Environment env;
+    };
+
+    TEST_F(SparseBatchInstantiationModelCheckerTest, Brp_Prob) {
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P=? [F s=5 ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        auto model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        compareWithInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>>(*model, formulas[0], {0.2, 0.5, 0.7, 0.9});
+    }
+
+    TEST_F(SparseBatchInstantiationModelCheckerTest, Brp_Rew) {
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp_rewards16_2.pm";
+        std::string formulaAsString = "R=? [F ((s=5) | (s=0&srep=3)) ]";
+        std::string constantsAsString = "pL=0.9,TOAck=0.5";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        auto model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        compareWithInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>>(*model, formulas[0], {0.3, 0.6, 0.8});
+    }
+
+    TEST_F(SparseBatchInstantiationModelCheckerTest, two_dice_Prob) {
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pmdp/two_dice.nm";
+        std::string formulaAsString = "Pmin=? [ F \"doubles\" ];Pmax=? [ F \"doubles\" ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        auto model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalFunction>>();
+
+        for (auto const& formula : formulas) {
+            compareWithInstantiationModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, storm::modelchecker::SparseMdpInstantiationModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double>>(*model, formula, {0.3, 0.5, 0.6});
+        }
+    }
+
+    TEST_F(SparseBatchInstantiationModelCheckerTest, IntelTbb) {
+        // The batches are checked concurrently if Intel TBB is used.
+        std::unique_ptr<storm::settings::SettingMemento> useIntelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+
+        storm::prism::Program dtmcProgram = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm");
+        std::vector<std::shared_ptr<const storm::logic::Formula>> dtmcFormulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F s=5 ]", dtmcProgram));
+        auto dtmc = storm::api::buildSparseModel<storm::RationalFunction>(dtmcProgram, dtmcFormulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        compareWithInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>>(*dtmc, dtmcFormulas[0], {0.2, 0.5, 0.7, 0.9});
+
+        storm::prism::Program mdpProgram = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/pmdp/two_dice.nm");
+        std::vector<std::shared_ptr<const storm::logic::Formula>> mdpFormulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmin=? [ F \"doubles\" ];Pmax=? [ F \"doubles\" ]", mdpProgram));
+        auto mdp = storm::api::buildSparseModel<storm::RationalFunction>(mdpProgram, mdpFormulas)->as<storm::models::sparse::Mdp<storm::RationalFunction>>();
+        for (auto const& formula : mdpFormulas) {
+            compareWithInstantiationModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, storm::modelchecker::SparseMdpInstantiationModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double>>(*mdp, formula, {0.3, 0.5, 0.6});
+        }
+    }
+
+    TEST_F(SparseBatchInstantiationModelCheckerTest, ExportSamples) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm");
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F s=5 ]", program));
+        auto model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        auto valuations = getGrid(*model, {0.25, 0.5});
+        ASSERT_EQ(4ul, valuations.size());
+        std::vector<std::string> valueNames = {"first", "second"};
+        std::vector<std::vector<double>> values = {{0.1, 0.2, 0.3, 0.4}, {1.0, 2.0, 3.0, 4.0}};
+
+        // Comma-separated values: a header line followed by one line per sample point.
+        std::string csvPath = (std::filesystem::temp_directory_path() / "storm_batch_samples_test.csv").string();
+        storm::api::exportSamplesToFile(valuations, valueNames, values, csvPath);
+        std::ifstream csvFile;
+        storm::utility::openFile(csvPath, csvFile);
+        std::vector<std::string> lines;
+        std::string line;
+        while (storm::utility::getline(csvFile, line)) {
+            lines.push_back(line);
+        }
+        storm::utility::closeFile(csvFile);
+        std::filesystem::remove(csvPath);
+
+        ASSERT_EQ(valuations.size() + 1, lines.size());
+        std::stringstream expectedHeader;
+        for (auto const& parameterValue : valuations.front()) {
+            expectedHeader << parameterValue.first.name() << ",";
+        }
+        expectedHeader << "first,second";
+        EXPECT_EQ(expectedHeader.str(), lines.front());
+        for (uint64_t sample = 0; sample < valuations.size(); ++sample) {
+            std::stringstream expectedLine;
+            for (auto const& parameterValue : valuations[sample]) {
+                expectedLine << storm::utility::convertNumber<double>(parameterValue.second) << ",";
+            }
+            expectedLine << values[0][sample] << "," << values[1][sample];
+            EXPECT_EQ(expectedLine.str(), lines[sample + 1]);
+        }
+
+        // JSON: an array with one object per sample point.
+        std::string jsonPath = (std::filesystem::temp_directory_path() / "storm_batch_samples_test.json").string();
+        storm::api::exportSamplesToFile(valuations, valueNames, values, jsonPath);
+        std::ifstream jsonFile;
+        storm::utility::openFile(jsonPath, jsonFile);
+        storm::json<double> samples = storm::json<double>::parse(jsonFile);
+        storm::utility::closeFile(jsonFile);
+        std::filesystem::remove(jsonPath);
+
+        ASSERT_TRUE(samples.is_array());
+        ASSERT_EQ(valuations.size(), samples.size());
+        for (uint64_t sample = 0; sample < valuations.size(); ++sample) {
+            for (auto const& parameterValue : valuations[sample]) {
+                EXPECT_EQ(storm::utility::convertNumber<double>(parameterValue.second), samples[sample][parameterValue.first.name()].get<double>());
+            }
+            EXPECT_EQ(values[0][sample], samples[sample]["first"].get<double>());
+            EXPECT_EQ(values[1][sample], samples[sample]["second"].get<double>());
+        }
+    }
+}
+
+#endif
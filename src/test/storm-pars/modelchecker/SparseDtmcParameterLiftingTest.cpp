@@ -15,6 +15,9 @@
 #include "storm-pars/transformer/SparseParametricDtmcSimplifier.h"
 #include "storm/solver/stateelimination/NondeterministicModelStateEliminator.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 
 
@@ -463,5 +466,48 @@ namespace {
         EXPECT_EQ(storm::modelchecker::RegionResult::ExistsBoth, regionChecker->analyzeRegion(this->env(), exBothRegion, storm::modelchecker::RegionResultHypothesis::Unknown,storm::modelchecker::RegionResult::Unknown, true));
         EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown,storm::modelchecker::RegionResult::Unknown, true));
     }
+
+    TEST(SparseDtmcParameterLiftingRefinementTest, Brp_Prob_refinement_workers) {
+#ifdef STORM_USE_CLN_RF
+        GTEST_SKIP() << "Concurrent region refinement is not supported if Storm uses CLN for rational functions.";
+#endif
+        carl::VariablePool::getInstance().clear();
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.2<=pK<=0.95", modelParameters);
+        auto coverageThreshold = storm::utility::convertNumber<storm::RationalFunction>(0.1);
+        boost::optional<uint64_t> depthLimit = 5ull;
+        auto engine = storm::modelchecker::RegionCheckEngine::ParameterLifting;
+        auto hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown;
+
+        //start testing
+        auto expectedResult = storm::api::checkAndRefineRegionWithSparseEngine<storm::RationalFunction>(model, task, region, engine, coverageThreshold, depthLimit, hypothesis);
+        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<storm::RationalFunction>> result;
+        {
+            std::unique_ptr<storm::settings::SettingMemento> useTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+            result = storm::api::checkAndRefineRegionWithSparseEngine<storm::RationalFunction>(model, task, region, engine, coverageThreshold, depthLimit, hypothesis, true, storm::api::MonotonicitySetting(), 0, 4);
+        }
+
+        // The refinement has to yield the same regions in the same order
+        ASSERT_EQ(expectedResult->getRegionResults().size(), result->getRegionResults().size());
+        for (uint64_t i = 0; i < result->getRegionResults().size(); ++i) {
+            EXPECT_EQ(expectedResult->getRegionResults()[i].first.toString(), result->getRegionResults()[i].first.toString());
+            EXPECT_EQ(expectedResult->getRegionResults()[i].second, result->getRegionResults()[i].second);
+        }
+        carl::VariablePool::getInstance().clear();
+    }
 }
 #endif
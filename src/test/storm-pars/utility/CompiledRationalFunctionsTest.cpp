@@ -0,0 +1,54 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+#include "storm/utility/constants.h"
+
+TEST(CompiledRationalFunctionsTest, Evaluate) {
+    storm::RationalFunctionVariable x = storm::createRFVariable("x");
+    storm::RationalFunctionVariable y = storm::createRFVariable("y");
+    std::shared_ptr<storm::RawPolynomialCache> cache = std::make_shared<storm::RawPolynomialCache>();
+    storm::RationalFunction fx(storm::Polynomial(storm::RawPolynomial(x), cache));
+    storm::RationalFunction fy(storm::Polynomial(storm::RawPolynomial(y), cache));
+    storm::RationalFunction one = storm::utility::one<storm::RationalFunction>();
+    storm::RationalFunction two = one + one;
+
+    std::vector<storm::RationalFunction> functions = {one - fx, fx * fx * fy / two, fy / (one + fx), fx * fx * fx};
+    storm::utility::parametric::CompiledRationalFunctions compiledFunctions;
+    for (uint64_t i = 0; i < functions.size(); ++i) {
+        EXPECT_EQ(i, compiledFunctions.add(functions[i]));
+    }
+    // Equal functions share their index
+    EXPECT_EQ(0ull, compiledFunctions.add(one - fx));
+    EXPECT_EQ(functions.size(), compiledFunctions.getNumberOfFunctions());
+    ASSERT_EQ(2ull, compiledFunctions.getVariables().size());
+
+    std::vector<std::pair<double, double>> points = {{0.3, 0.7}, {0.5, 0.5}, {0.9, 0.1}};
+    std::vector<double> batchValues(2 * points.size());
+    for (uint64_t j = 0; j < points.size(); ++j) {
+        storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+        valuation.emplace(x, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(points[j].first));
+        valuation.emplace(y, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(points[j].second));
+        std::vector<double> variableValues = compiledFunctions.getVariableValues(valuation);
+        for (uint64_t variable = 0; variable < 2; ++variable) {
+            batchValues[variable * points.size() + j] = variableValues[variable];
+        }
+        for (uint64_t i = 0; i < functions.size(); ++i) {
+            double expected = storm::utility::convertNumber<double>(functions[i].evaluate(valuation));
+            EXPECT_NEAR(expected, compiledFunctions.evaluate(i, variableValues), 1e-12);
+        }
+    }
+
+    std::vector<double> result;
+    compiledFunctions.evaluate(batchValues, points.size(), result);
+    ASSERT_EQ(functions.size() * points.size(), result.size());
+    for (uint64_t j = 0; j < points.size(); ++j) {
+        double xValue = points[j].first;
+        double yValue = points[j].second;
+        EXPECT_NEAR(1 - xValue, result[j], 1e-12);
+        EXPECT_NEAR(xValue * xValue * yValue / 2, result[points.size() + j], 1e-12);
+        EXPECT_NEAR(yValue / (1 + xValue), result[2 * points.size() + j], 1e-12);
+        EXPECT_NEAR(xValue * xValue * xValue, result[3 * points.size() + j], 1e-12);
+    }
+}
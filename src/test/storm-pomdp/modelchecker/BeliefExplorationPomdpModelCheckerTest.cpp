@@ -1,7 +1,12 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
 
+#include <deque>
+#include <functional>
+#include <set>
+
 #include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelChecker.h"
+#include "storm-pomdp/storage/BeliefManager.h"
 #include "storm-pomdp/transformer/MakePOMDPCanonic.h"
 #include "storm/api/storm.h"
 #include "storm-parsers/api/storm-parsers.h"
@@ -10,6 +15,9 @@
 #include "storm-pomdp/transformer/KnownProbabilityTransformer.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 
 namespace {
@@ -123,6 +131,21 @@ namespace {
         static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision();}
     };
     
+    class ParallelExpansionRefineDoubleVIEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+        static bool const isExactModelChecking = false;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.005); }
+        static PreprocessingType const preprocessingType = PreprocessingType::None;
+        static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision(); options.parallelExpansion = true;}
+    };
+    
     class DefaultDoubleOVIEnvironment {
     public:
         typedef double ValueType;
@@ -174,6 +197,15 @@ namespace {
     public:
         typedef typename TestType::ValueType ValueType;
         BeliefExplorationTest() : _environment(TestType::createEnvironment()) {}
+        void SetUp() override {
+            // The successors are only expanded in parallel if TBB is enabled
+            if (options().parallelExpansion) {
+                _useIntelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+            }
+        }
+        void TearDown() override {
+            _useIntelTbb.reset();
+        }
         storm::Environment const& env() const { return _environment; }
         storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType> options() const {
             storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType> opt(true, true); // Always compute both bounds (lower and upper)
@@ -231,6 +263,7 @@ namespace {
         
     private:
         storm::Environment _environment;
+        std::unique_ptr<storm::settings::SettingMemento> _useIntelTbb;
     };
   
     typedef ::testing::Types<
@@ -241,6 +274,7 @@ namespace {
             FineDoubleVIEnvironment,
             RefineDoubleVIEnvironment,
             PreprocessedRefineDoubleVIEnvironment,
+            ParallelExpansionRefineDoubleVIEnvironment,
             DefaultDoubleOVIEnvironment,
             DefaultRationalPIEnvironment,
             PreprocessedDefaultRationalPIEnvironment
@@ -430,6 +464,110 @@ namespace {
         EXPECT_LE(result.diff(), this->precision()) << "Result [" << result.lowerBound << ", " << result.upperBound << "] is not precise enough. If (only) this fails, the result bounds are still correct, but they might be unexpectedly imprecise.\n";
     }
     
+    struct CanonicPomdp {
+        std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp;
+        std::shared_ptr<storm::logic::Formula const> formula;
+    };
+    
+    CanonicPomdp buildCanonicPomdp(std::string const& programFile, std::string const& formulaAsString, std::string const& constantsAsString) {
+        storm::prism::Program program = storm::utility::prism::preprocess(storm::api::parseProgram(programFile), constantsAsString);
+        CanonicPomdp result;
+        result.formula = storm::api::parsePropertiesForPrismProgram(formulaAsString, program).front().getRawFormula();
+        auto pomdp = storm::api::buildSparseModel<double>(program, {result.formula})->as<storm::models::sparse::Pomdp<double>>();
+        storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+        result.pomdp = makeCanonic.transform();
+        return result;
+    }
+    
+    CanonicPomdp buildMaze2Rmin() {
+        return buildCanonicPomdp(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "R[exp]min=? [F \"goal\"]", "sl=0.075");
+    }
+    
+    CanonicPomdp buildRefuelPmax() {
+        return buildCanonicPomdp(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
+    }
+    
+    /*!
+     * Checks that the bounds obtained with the given options coincide (up to the given tolerance) with the bounds obtained with modified options.
+     */
+    void checkBoundsCoincide(CanonicPomdp const& input, storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<double> options, std::function<void(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<double>&)> const& modifyOptions, double tolerance, std::string const& description) {
+        storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<double>> referenceChecker(input.pomdp, options);
+        auto referenceResult = referenceChecker.check(*input.formula);
+        
+        modifyOptions(options);
+        storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<double>> modifiedChecker(input.pomdp, options);
+        auto modifiedResult = modifiedChecker.check(*input.formula);
+        
+        EXPECT_NEAR(referenceResult.lowerBound, modifiedResult.lowerBound, tolerance) << "Lower bounds differ " << description << ".";
+        EXPECT_NEAR(referenceResult.upperBound, modifiedResult.upperBound, tolerance) << "Upper bounds differ " << description << ".";
+    }
+    
+    void checkIncrementalRefinement(CanonicPomdp const& input) {
+        // The bounds after each refinement step have to coincide with the bounds obtained by re-computing all values in every step.
+        for (uint64_t stepLimit = 0; stepLimit <= 6; ++stepLimit) {
+            storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<double> options(true, true);
+            options.refine = true;
+            options.refineStepLimit = stepLimit;
+            options.incrementalValueComputation = false;
+            checkBoundsCoincide(input, options, [](auto& modifiedOptions) { modifiedOptions.incrementalValueComputation = true; }, 1e-4, "after " + std::to_string(stepLimit) + " refinement step(s)");
+        }
+    }
+    
+    TEST(BeliefExplorationIncrementalRefinementTest, maze2_Rmin) {
+        checkIncrementalRefinement(buildMaze2Rmin());
+    }
+    
+    TEST(BeliefExplorationIncrementalRefinementTest, refuel_Pmax) {
+        checkIncrementalRefinement(buildRefuelPmax());
+    }
     
+    void checkParallelExpansion(CanonicPomdp const& input) {
+        std::unique_ptr<storm::settings::SettingMemento> useIntelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        
+        // Explore the beliefs layer by layer. The parallel manager prefetches the successors of a whole layer before they are retrieved.
+        typedef storm::storage::BeliefManager<storm::models::sparse::Pomdp<double>> BeliefManagerType;
+        BeliefManagerType sequentialManager(*input.pomdp, 1e-9, BeliefManagerType::TriangulationMode::Dynamic);
+        BeliefManagerType parallelManager(*input.pomdp, 1e-9, BeliefManagerType::TriangulationMode::Dynamic);
+        std::vector<double> observationResolutions(input.pomdp->getNrObservations(), 4.0);
+        ASSERT_EQ(sequentialManager.getInitialBelief(), parallelManager.getInitialBelief());
+        std::deque<uint64_t> layer = {sequentialManager.getInitialBelief()};
+        std::set<uint64_t> discoveredBeliefs(layer.begin(), layer.end());
+        while (!layer.empty() && sequentialManager.getNumberOfBeliefIds() < 5000) {
+            parallelManager.prefetchSuccessors(std::vector<uint64_t>(layer.begin(), layer.end()), observationResolutions);
+            std::deque<uint64_t> nextLayer;
+            for (auto const& beliefId : layer) {
+                for (uint64_t action = 0; action < sequentialManager.getBeliefNumberOfChoices(beliefId); ++action) {
+                    auto sequentialSuccessors = sequentialManager.expandAndTriangulate(beliefId, action, observationResolutions);
+                    auto parallelSuccessors = parallelManager.expandAndTriangulate(beliefId, action, observationResolutions);
+                    ASSERT_EQ(sequentialSuccessors, parallelSuccessors) << "Successors of belief " << beliefId << " and action " << action << " differ.";
+                    for (auto const& successor : sequentialSuccessors) {
+                        if (discoveredBeliefs.insert(successor.first).second) {
+                            nextLayer.push_back(successor.first);
+                        }
+                    }
+                }
+            }
+            layer = std::move(nextLayer);
+        }
+        parallelManager.clearPrefetchedSuccessors();
+        ASSERT_EQ(sequentialManager.getNumberOfBeliefIds(), parallelManager.getNumberOfBeliefIds());
+        for (uint64_t beliefId = 0; beliefId < sequentialManager.getNumberOfBeliefIds(); ++beliefId) {
+            EXPECT_EQ(sequentialManager.toString(beliefId), parallelManager.toString(beliefId));
+        }
+        
+        // The refined bounds have to coincide with the bounds of the sequential exploration.
+        storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<double> options(true, true);
+        options.refine = true;
+        options.refineStepLimit = 3;
+        checkBoundsCoincide(input, options, [](auto& modifiedOptions) { modifiedOptions.parallelExpansion = true; }, 0.0, "with parallel expansion");
+    }
+    
+    TEST(BeliefExplorationParallelExpansionTest, maze2_Rmin) {
+        checkParallelExpansion(buildMaze2Rmin());
+    }
+    
+    TEST(BeliefExplorationParallelExpansionTest, refuel_Pmax) {
+        checkParallelExpansion(buildRefuelPmax());
+    }
     
 }
@@ -0,0 +1,129 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelChecker.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+
+
+namespace {
+    class DoubleEnvironment {
+    public:
+        typedef double ValueType;
+        static bool const isExact = false;
+    };
+    
+    class RationalEnvironment {
+    public:
+        typedef storm::RationalNumber ValueType;
+        static bool const isExact = true;
+    };
+    
+    template<typename TestType>
+    class PointBasedTest : public ::testing::Test {
+    public:
+        typedef typename TestType::ValueType ValueType;
+        storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<ValueType> options() const {
+            storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<ValueType> opt;
+            opt.precision = precision();
+            opt.trialLimit = 1000;
+            return opt;
+        }
+        ValueType parseNumber(std::string const& str) {
+            return storm::utility::convertNumber<ValueType>(str);
+        }
+        struct Input {
+            std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> model;
+            std::shared_ptr<storm::logic::Formula const> formula;
+        };
+        Input buildPrism(std::string const& programFile, std::string const& formulaAsString, std::string const& constantsAsString = "") const {
+            storm::prism::Program program = storm::api::parseProgram(programFile);
+            program = storm::utility::prism::preprocess(program, constantsAsString);
+            Input input;
+            input.formula = storm::api::parsePropertiesForPrismProgram(formulaAsString, program).front().getRawFormula();
+            input.model = storm::api::buildSparseModel<ValueType>(program, {input.formula})->template as<storm::models::sparse::Pomdp<ValueType>>();
+            storm::transformer::MakePOMDPCanonic<ValueType> makeCanonic(*input.model);
+            input.model = makeCanonic.transform();
+            EXPECT_TRUE(input.model->isCanonic());
+            return input;
+        }
+        ValueType precision() const { return storm::utility::convertNumber<ValueType>(0.01); }
+        ValueType modelcheckingPrecision() const { if (TestType::isExact) return storm::utility::zero<ValueType>(); else return storm::utility::convertNumber<ValueType>(1e-6); }
+    };
+  
+    typedef ::testing::Types<
+            DoubleEnvironment,
+            RationalEnvironment
+    > TestingTypes;
+    
+    TYPED_TEST_SUITE(PointBasedTest, TestingTypes,);
+    
+    TYPED_TEST(PointBasedTest, simple_Pmax) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0");
+        storm::pomdp::modelchecker::PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
+        auto result = checker.check(*data.formula);
+        
+        ValueType expected = this->parseNumber("7/10");
+        EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
+        EXPECT_GE(result.upperBound, expected - this->modelcheckingPrecision());
+        EXPECT_LE(result.diff(), this->precision()) << "Result [" << result.lowerBound << ", " << result.upperBound << "] is not precise enough.\n";
+    }
+    
+    TYPED_TEST(PointBasedTest, simple_slippery_Pmin) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmin=? [F \"goal\" ]", "slippery=0.4");
+        storm::pomdp::modelchecker::PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
+        auto result = checker.check(*data.formula);
+        
+        ValueType expected = this->parseNumber("3/10");
+        EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
+        EXPECT_GE(result.upperBound, expected - this->modelcheckingPrecision());
+        EXPECT_LE(result.diff(), this->precision()) << "Result [" << result.lowerBound << ", " << result.upperBound << "] is not precise enough.\n";
+    }
+    
+    TYPED_TEST(PointBasedTest, simple_Rmax) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Rmax=? [F s>4 ]", "slippery=0");
+        storm::pomdp::modelchecker::PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
+        auto result = checker.check(*data.formula);
+        
+        ValueType expected = this->parseNumber("29/50");
+        EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
+        EXPECT_GE(result.upperBound, expected - this->modelcheckingPrecision());
+        EXPECT_LE(result.diff(), this->precision()) << "Result [" << result.lowerBound << ", " << result.upperBound << "] is not precise enough.\n";
+    }
+    
+    TYPED_TEST(PointBasedTest, simple_Rmin) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Rmin=? [F s>4 ]", "slippery=0");
+        storm::pomdp::modelchecker::PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
+        auto result = checker.check(*data.formula);
+        
+        ValueType expected = this->parseNumber("19/50");
+        EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
+        EXPECT_GE(result.upperBound, expected - this->modelcheckingPrecision());
+        EXPECT_LE(result.diff(), this->precision()) << "Result [" << result.lowerBound << ", " << result.upperBound << "] is not precise enough.\n";
+    }
+    
+    TYPED_TEST(PointBasedTest, refuel_Pmax_noTrialLimit) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        // Without a trial limit, the computation has to terminate on its own even if the weighted gaps of all successors drop below the precision.
+        auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
+        auto options = this->options();
+        options.trialLimit = boost::none;
+        storm::pomdp::modelchecker::PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, options);
+        auto result = checker.check(*data.formula);
+        
+        ValueType expected = this->parseNumber("38/155");
+        EXPECT_LE(result.lowerBound, expected + this->modelcheckingPrecision());
+        EXPECT_GE(result.upperBound, expected - this->modelcheckingPrecision());
+        EXPECT_LE(result.diff(), this->precision()) << "Result [" << result.lowerBound << ", " << result.upperBound << "] is not precise enough.\n";
+    }
+}
@@ -12,6 +12,7 @@
 #include "storm-parsers/parser/JaniParser.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdJaniModelBuilder.h"
+#include "storm/builder/DdVariableOrdering.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 
 #include "storm-parsers/api/model_descriptions.h"
@@ -666,3 +667,67 @@ TEST(DdJaniModelBuilderTest_Sylvan, InputEnabling) {
     EXPECT_EQ(4ul, model->getNumberOfStates());
     EXPECT_EQ(5ul, model->getNumberOfTransitions());
 }
+
+TEST(DdJaniModelBuilderTest_Cudd, ForceVariableOrder) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    storm::jani::Model janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+
+    // The declaration order lists the locations of all automata before the global and the local variables.
+    std::set<std::string> automata;
+    for (auto const& automaton : janiModel.getAutomata()) {
+        automata.insert(automaton.getName());
+    }
+    std::vector<storm::expressions::Variable> declarationOrder =
+        storm::builder::computeDdVariableOrder(janiModel, automata, storm::builder::DdVariableOrderingHeuristic::Declaration);
+    ASSERT_LE(automata.size(), declarationOrder.size());
+    auto automatonIt = automata.begin();
+    for (uint64_t index = 0; index < automata.size(); ++index, ++automatonIt) {
+        EXPECT_EQ(janiModel.getAutomaton(*automatonIt).getLocationExpressionVariable(), declarationOrder[index]);
+    }
+
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::CUDD, double> builder;
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::CUDD, double>::Options options;
+    options.variableOrderingHeuristic = storm::builder::DdVariableOrderingHeuristic::Declaration;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> declarationModel = builder.build(janiModel, options);
+    options.variableOrderingHeuristic = storm::builder::DdVariableOrderingHeuristic::Force;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> forceModel = builder.build(janiModel, options);
+
+    EXPECT_EQ(1038ul, forceModel->getNumberOfStates());
+    EXPECT_EQ(1282ul, forceModel->getNumberOfTransitions());
+    EXPECT_EQ(declarationModel->getNumberOfStates(), forceModel->getNumberOfStates());
+    EXPECT_EQ(declarationModel->getNumberOfTransitions(), forceModel->getNumberOfTransitions());
+    EXPECT_EQ(declarationModel->as<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>>()->getNumberOfChoices(),
+              forceModel->as<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>>()->getNumberOfChoices());
+}
+
+TEST(DdJaniModelBuilderTest_Sylvan, ForceVariableOrder) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    storm::jani::Model janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+
+    // The declaration order lists the locations of all automata before the global and the local variables.
+    std::set<std::string> automata;
+    for (auto const& automaton : janiModel.getAutomata()) {
+        automata.insert(automaton.getName());
+    }
+    std::vector<storm::expressions::Variable> declarationOrder =
+        storm::builder::computeDdVariableOrder(janiModel, automata, storm::builder::DdVariableOrderingHeuristic::Declaration);
+    ASSERT_LE(automata.size(), declarationOrder.size());
+    auto automatonIt = automata.begin();
+    for (uint64_t index = 0; index < automata.size(); ++index, ++automatonIt) {
+        EXPECT_EQ(janiModel.getAutomaton(*automatonIt).getLocationExpressionVariable(), declarationOrder[index]);
+    }
+
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double> builder;
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>::Options options;
+    options.variableOrderingHeuristic = storm::builder::DdVariableOrderingHeuristic::Declaration;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> declarationModel = builder.build(janiModel, options);
+    options.variableOrderingHeuristic = storm::builder::DdVariableOrderingHeuristic::Force;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> forceModel = builder.build(janiModel, options);
+
+    EXPECT_EQ(1038ul, forceModel->getNumberOfStates());
+    EXPECT_EQ(1282ul, forceModel->getNumberOfTransitions());
+    EXPECT_EQ(declarationModel->getNumberOfStates(), forceModel->getNumberOfStates());
+    EXPECT_EQ(declarationModel->getNumberOfTransitions(), forceModel->getNumberOfTransitions());
+    EXPECT_EQ(declarationModel->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>()->getNumberOfChoices(),
+              forceModel->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>()->getNumberOfChoices());
+}
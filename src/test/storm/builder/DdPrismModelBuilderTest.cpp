@@ -1,6 +1,7 @@
 #include "storm-config.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/builder/DdVariableOrdering.h"
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
@@ -9,6 +10,9 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
 #include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/expressions/ExpressionManager.h"
 #include "test/storm_gtest.h"
 
 TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
@@ -325,6 +329,63 @@ TEST(DdPrismModelBuilderTest_Cudd, Composition) {
     EXPECT_EQ(21ul, mdp->getNumberOfChoices());
 }
 
+namespace {
+template<storm::dd::DdType DdType>
+void checkPartitionedReachability(std::string const& path) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(path).preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<DdType>> bfsModel = storm::builder::DdPrismModelBuilder<DdType>().build(program);
+
+    for (auto const& method : {storm::builder::DdReachabilityMethod::Chaining, storm::builder::DdReachabilityMethod::ChainingWithRestart}) {
+        typename storm::builder::DdPrismModelBuilder<DdType>::Options options;
+        options.reachabilityMethod = method;
+        std::shared_ptr<storm::models::symbolic::Model<DdType>> model = storm::builder::DdPrismModelBuilder<DdType>().build(program, options);
+
+        EXPECT_EQ(bfsModel->getNumberOfStates(), model->getNumberOfStates()) << "Method: " << method;
+        EXPECT_EQ(bfsModel->getNumberOfTransitions(), model->getNumberOfTransitions()) << "Method: " << method;
+        EXPECT_EQ(bfsModel->getNumberOfChoices(), model->getNumberOfChoices()) << "Method: " << method;
+        EXPECT_EQ(bfsModel->getReachableStates(), model->getReachableStates()) << "Method: " << method;
+    }
+}
+}  // namespace
+
+TEST(DdPrismModelBuilderTest_Sylvan, PartitionedReachability) {
+    checkPartitionedReachability<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    checkPartitionedReachability<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+    checkPartitionedReachability<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/system_composition.nm");
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, PartitionedReachability) {
+    checkPartitionedReachability<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    checkPartitionedReachability<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+    checkPartitionedReachability<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/system_composition.nm");
+}
+
+namespace {
+template<storm::dd::DdType DdType>
+void checkVariableOrderingHeuristic(std::string const& path) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(path).preprocess().asPrismProgram();
+    typename storm::builder::DdPrismModelBuilder<DdType>::Options options;
+    options.variableOrderingHeuristic = storm::builder::DdVariableOrderingHeuristic::Declaration;
+    std::shared_ptr<storm::models::symbolic::Model<DdType>> declarationModel = storm::builder::DdPrismModelBuilder<DdType>().build(program, options);
+    options.variableOrderingHeuristic = storm::builder::DdVariableOrderingHeuristic::Force;
+    std::shared_ptr<storm::models::symbolic::Model<DdType>> forceModel = storm::builder::DdPrismModelBuilder<DdType>().build(program, options);
+
+    EXPECT_EQ(declarationModel->getNumberOfStates(), forceModel->getNumberOfStates());
+    EXPECT_EQ(declarationModel->getNumberOfTransitions(), forceModel->getNumberOfTransitions());
+    EXPECT_EQ(declarationModel->getNumberOfChoices(), forceModel->getNumberOfChoices());
+}
+}  // namespace
+
+TEST(DdPrismModelBuilderTest_Sylvan, VariableOrderingHeuristicOption) {
+    checkVariableOrderingHeuristic<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    checkVariableOrderingHeuristic<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, VariableOrderingHeuristicOption) {
+    checkVariableOrderingHeuristic<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    checkVariableOrderingHeuristic<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+}
+
 TEST(UnboundedTest_Sylvan, Mdp) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/unbounded.nm");
     storm::prism::Program program = modelDescription.preprocess("N=1").asPrismProgram();
@@ -336,3 +397,27 @@ TEST(UnboundedTest_Cudd, Mdp) {
     storm::prism::Program program = modelDescription.preprocess("N=1").asPrismProgram();
     EXPECT_FALSE(storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().canHandle(program));
 }
+
+TEST(DdPrismModelBuilderTest, ForceVariableOrder) {
+    storm::expressions::ExpressionManager manager;
+    storm::expressions::Variable a = manager.declareBooleanVariable("a");
+    storm::expressions::Variable b = manager.declareBooleanVariable("b");
+    storm::expressions::Variable c = manager.declareBooleanVariable("c");
+    storm::expressions::Variable d = manager.declareBooleanVariable("d");
+
+    std::vector<storm::expressions::Variable> variables = {a, b, c, d};
+    std::vector<std::set<storm::expressions::Variable>> hyperedges = {{a, c}, {b, d}};
+    EXPECT_EQ(variables, storm::builder::computeDdVariableOrder(variables, hyperedges, storm::builder::DdVariableOrderingHeuristic::Declaration));
+    std::vector<storm::expressions::Variable> expected = {a, c, b, d};
+    EXPECT_EQ(expected, storm::builder::computeDdVariableOrder(variables, hyperedges, storm::builder::DdVariableOrderingHeuristic::Force));
+
+    // The order of the program variables must be a permutation of the declared variables.
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::vector<storm::expressions::Variable> declarationOrder =
+        storm::builder::computeDdVariableOrder(program, storm::builder::DdVariableOrderingHeuristic::Declaration);
+    std::vector<storm::expressions::Variable> forceOrder = storm::builder::computeDdVariableOrder(program, storm::builder::DdVariableOrderingHeuristic::Force);
+    EXPECT_EQ(declarationOrder.size(), forceOrder.size());
+    EXPECT_EQ(std::set<storm::expressions::Variable>(declarationOrder.begin(), declarationOrder.end()),
+              std::set<storm::expressions::Variable>(forceOrder.begin(), forceOrder.end()));
+}
@@ -7,7 +7,10 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/AbstractionSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
 
@@ -15,6 +18,60 @@
 
 #include "storm-parsers/api/storm-parsers.h"
 
+namespace {
+template<storm::dd::DdType DdType>
+void checkParallelAbstraction(storm::storage::SymbolicModelDescription const& model, std::vector<std::string> const& formulasAsString) {
+    storm::parser::FormulaParser formulaParser(model.isPrismProgram() ? model.asPrismProgram().getManager().getSharedPointer()
+                                                                      : model.asJaniModel().getManager().getSharedPointer());
+    for (auto const& formulaAsString : formulasAsString) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaAsString);
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+
+        storm::modelchecker::GameBasedMdpModelChecker<DdType, storm::models::symbolic::Mdp<DdType>> sequentialChecker(model);
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = sequentialChecker.check(task);
+
+        // Enumerate the abstractions of the commands (or edges) concurrently.
+        std::unique_ptr<storm::settings::SettingMemento> useTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        storm::modelchecker::GameBasedMdpModelChecker<DdType, storm::models::symbolic::Mdp<DdType>> parallelChecker(model);
+        std::unique_ptr<storm::modelchecker::CheckResult> parallelResult = parallelChecker.check(task);
+
+        EXPECT_NEAR(sequentialResult->asExplicitQuantitativeCheckResult<double>()[0], parallelResult->asExplicitQuantitativeCheckResult<double>()[0],
+                    storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision())
+            << "for formula " << formulaAsString;
+    }
+}
+
+template<storm::dd::DdType DdType>
+void checkQualitativeResultReuse(storm::prism::Program const& program, std::vector<std::pair<std::string, double>> const& formulasAndResults) {
+    auto& abstractionSettings = storm::settings::mutableAbstractionSettings();
+    // Start with a coarse abstraction such that several refinement steps are needed, in which qualitative results can be reused.
+    abstractionSettings.setAddAllGuards(false);
+    double precision = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision();
+
+    storm::parser::FormulaParser formulaParser;
+    for (auto const& formulaAndResult : formulasAndResults) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaAndResult.first);
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+
+        abstractionSettings.setReuseMode(storm::settings::modules::AbstractionSettings::ReuseMode::None);
+        storm::modelchecker::GameBasedMdpModelChecker<DdType, storm::models::symbolic::Mdp<DdType>> checkerWithoutReuse(program);
+        std::unique_ptr<storm::modelchecker::CheckResult> resultWithoutReuse = checkerWithoutReuse.check(task);
+
+        abstractionSettings.setReuseMode(storm::settings::modules::AbstractionSettings::ReuseMode::Qualitative);
+        storm::modelchecker::GameBasedMdpModelChecker<DdType, storm::models::symbolic::Mdp<DdType>> checkerWithReuse(program);
+        std::unique_ptr<storm::modelchecker::CheckResult> resultWithReuse = checkerWithReuse.check(task);
+
+        double valueWithoutReuse = resultWithoutReuse->asExplicitQuantitativeCheckResult<double>()[0];
+        double valueWithReuse = resultWithReuse->asExplicitQuantitativeCheckResult<double>()[0];
+        EXPECT_NEAR(formulaAndResult.second, valueWithoutReuse, precision) << "for formula " << formulaAndResult.first;
+        EXPECT_NEAR(valueWithoutReuse, valueWithReuse, precision) << "for formula " << formulaAndResult.first;
+    }
+
+    abstractionSettings.setReuseMode(storm::settings::modules::AbstractionSettings::ReuseMode::All);
+    abstractionSettings.setAddAllGuards(true);
+}
+}  // namespace
+
 #if defined STORM_HAVE_MSAT
 TEST(GameBasedMdpModelCheckerTest, Dice_Cudd) {
 #else
@@ -174,3 +231,51 @@ TEST(GameBasedMdpModelCheckerTest, DISABLED_Dice_Sylvan) {
     EXPECT_NEAR(0.083333283662796020508, quantitativeResult6[0],
                 storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
+
+#if defined STORM_HAVE_MSAT
+TEST(GameBasedMdpModelCheckerTest, ParallelAbstraction_Cudd) {
+#else
+TEST(GameBasedMdpModelCheckerTest, DISABLED_ParallelAbstraction_Cudd) {
+#endif
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::vector<std::string> formulas = {"Pmin=? [F s1=7 & s2=7 & d1+d2=2]", "Pmax=? [F s1=7 & s2=7 & d1+d2=3]", "Pmax=? [F s1=7 & s2=7 & d1+d2=4]"};
+
+    // The program is abstracted by the module abstractor, its JANI counterpart by the automaton abstractor.
+    checkParallelAbstraction<storm::dd::DdType::CUDD>(program, formulas);
+    checkParallelAbstraction<storm::dd::DdType::CUDD>(program.toJani(), formulas);
+}
+
+#if defined STORM_HAVE_MSAT
+TEST(GameBasedMdpModelCheckerTest, ParallelAbstraction_Sylvan) {
+#else
+TEST(GameBasedMdpModelCheckerTest, DISABLED_ParallelAbstraction_Sylvan) {
+#endif
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::vector<std::string> formulas = {"Pmin=? [F s1=7 & s2=7 & d1+d2=2]", "Pmax=? [F s1=7 & s2=7 & d1+d2=3]", "Pmax=? [F s1=7 & s2=7 & d1+d2=4]"};
+
+    // The program is abstracted by the module abstractor, its JANI counterpart by the automaton abstractor.
+    checkParallelAbstraction<storm::dd::DdType::Sylvan>(program, formulas);
+    checkParallelAbstraction<storm::dd::DdType::Sylvan>(program.toJani(), formulas);
+}
+
+#if defined STORM_HAVE_MSAT
+TEST(GameBasedMdpModelCheckerTest, QualitativeResultReuse_Cudd) {
+#else
+TEST(GameBasedMdpModelCheckerTest, DISABLED_QualitativeResultReuse_Cudd) {
+#endif
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    checkQualitativeResultReuse<storm::dd::DdType::CUDD>(
+        program,
+        {{"Pmin=? [F \"two\"]", 0.0277777612209320068}, {"Pmax=? [F \"three\"]", 0.0555555224418640136}, {"Pmax=? [F \"four\"]", 0.083333283662796020508}});
+}
+
+#if defined STORM_HAVE_MSAT
+TEST(GameBasedMdpModelCheckerTest, QualitativeResultReuse_Sylvan) {
+#else
+TEST(GameBasedMdpModelCheckerTest, DISABLED_QualitativeResultReuse_Sylvan) {
+#endif
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    checkQualitativeResultReuse<storm::dd::DdType::Sylvan>(
+        program,
+        {{"Pmin=? [F \"two\"]", 0.0277777612209320068}, {"Pmax=? [F \"three\"]", 0.0555555224418640136}, {"Pmax=? [F \"four\"]", 0.083333283662796020508}});
+}
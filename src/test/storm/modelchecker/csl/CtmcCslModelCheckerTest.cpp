@@ -11,6 +11,7 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
@@ -132,6 +133,27 @@ class SparseNativeSorEnvironment {
     }
 };
 
+class SparseNativeAdaptiveUniformizationEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // unused for sparse models
+    static const CtmcEngine engine = CtmcEngine::PrismSparse;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Ctmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::SOR);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-9));
+        env.solver().native().setRelativeTerminationCriterion(false);
+        env.solver().native().setMaximalNumberOfIterations(5000000);
+        env.solver().timeBounded().setCtmcMethod(storm::solver::CtmcTransientMethod::AdaptiveUniformization);
+        env.solver().timeBounded().setSteadyStateDetection(true);
+        env.solver().timeBounded().setRestrictToActiveSupport(true);
+        return env;
+    }
+};
+
 class HybridCuddGmmxxGmresEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
@@ -298,8 +320,8 @@ class CtmcCslModelCheckerTest : public ::testing::Test {
 };
 
 typedef ::testing::Types<SparseGmmxxGmresIluEnvironment, JaniSparseGmmxxGmresIluEnvironment, JitSparseGmmxxGmresIluEnvironment, SparseEigenDGmresEnvironment,
-                         SparseEigenDoubleLUEnvironment, SparseNativeSorEnvironment, HybridCuddGmmxxGmresEnvironment, JaniHybridCuddGmmxxGmresEnvironment,
-                         HybridSylvanGmmxxGmresEnvironment>
+                         SparseEigenDoubleLUEnvironment, SparseNativeSorEnvironment, SparseNativeAdaptiveUniformizationEnvironment,
+                         HybridCuddGmmxxGmresEnvironment, JaniHybridCuddGmmxxGmresEnvironment, HybridSylvanGmmxxGmresEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(CtmcCslModelCheckerTest, TestingTypes, );
@@ -579,4 +601,36 @@ TYPED_TEST(CtmcCslModelCheckerTest, HOAProbabilitiesPolling) {
         EXPECT_FALSE(checker->canHandle(tasks[0]));
     }
 }
+
+TEST(CtmcCslTimePointsTest, Tandem) {
+    std::string formulasString = "P=? [ F<=10 \"network_full\" ]";
+    formulasString += "; P=? [\"second_queue_full\" U<=1 !\"second_queue_full\"]";
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/tandem5.sm", true);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*model);
+    storm::Environment env;
+
+    std::vector<double> timePoints = {0.0, 0.5, 1.0, 5.0, 10.0};
+    for (auto const& formula : formulas) {
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+        storm::logic::BoundedUntilFormula const& pathFormula = formula->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+        auto results = checker.computeBoundedUntilProbabilitiesForTimePoints(env, task.substituteFormula(pathFormula), timePoints);
+        ASSERT_EQ(timePoints.size(), results.size());
+        for (uint64_t i = 0; i < timePoints.size(); ++i) {
+            // Compare with the result of checking the formula with the time point as upper bound.
+            auto singleFormula = std::make_shared<storm::logic::BoundedUntilFormula>(
+                pathFormula.getLeftSubformula().asSharedPointer(), pathFormula.getRightSubformula().asSharedPointer(), boost::none,
+                storm::logic::TimeBound(false, program.getManager().rational(timePoints[i])), storm::logic::TimeBoundReference(storm::logic::TimeBoundType::Time));
+            auto expected = checker.computeBoundedUntilProbabilities(env, task.substituteFormula(*singleFormula));
+            auto const& expectedValues = expected->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            auto const& values = results[i]->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            ASSERT_EQ(expectedValues.size(), values.size());
+            for (uint64_t state = 0; state < values.size(); ++state) {
+                EXPECT_NEAR(expectedValues[state], values[state], 1e-6);
+            }
+        }
+    }
+}
 }  // namespace
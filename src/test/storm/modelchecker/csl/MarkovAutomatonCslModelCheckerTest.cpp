@@ -10,12 +10,14 @@
 #include "storm/api/properties.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
@@ -23,6 +25,8 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/jani/Property.h"
 
@@ -423,4 +427,84 @@ TYPED_TEST(MarkovAutomatonCslModelCheckerTest, HOASimple) {
         EXPECT_FALSE(checker->canHandle(tasks[0]));
     }
 }
+
+void checkUnifPlusWithIntelTbb(std::string const& pathToPrismFile, std::string const& formulasAsString, std::vector<double> const& expectedResults) {
+    storm::prism::Program program = storm::api::parseProgram(pathToPrismFile);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::MarkovAutomaton<double>>();
+    storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<double>> checker(*model);
+    storm::modelchecker::ExplicitQualitativeCheckResult initialStates(model->getInitialStates());
+    ASSERT_EQ(expectedResults.size(), formulas.size());
+
+    storm::Environment env;
+    env.solver().timeBounded().setMaMethod(storm::solver::MaBoundedReachabilityMethod::UnifPlus);
+    env.solver().timeBounded().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+    double const precision = 1e-6;
+
+    for (uint64_t index = 0; index < formulas.size(); ++index) {
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formulas[index]);
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = checker.check(env, task);
+        sequentialResult->filter(initialStates);
+        double sequentialValue = sequentialResult->asQuantitativeCheckResult<double>().getMin();
+
+        // The sweeps for the lower and the upper bound are performed concurrently if Intel TBB is used.
+        std::unique_ptr<storm::settings::SettingMemento> useIntelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        std::unique_ptr<storm::modelchecker::CheckResult> parallelResult = checker.check(env, task);
+        parallelResult->filter(initialStates);
+        double parallelValue = parallelResult->asQuantitativeCheckResult<double>().getMin();
+
+        EXPECT_NEAR(expectedResults[index], sequentialValue, precision);
+        EXPECT_NEAR(expectedResults[index], parallelValue, precision);
+        EXPECT_NEAR(sequentialValue, parallelValue, 2 * precision);
+    }
+}
+
+TEST(MarkovAutomatonUnifPlusTest, IntelTbbServer) {
+    checkUnifPlusWithIntelTbb(STORM_TEST_RESOURCES_DIR "/ma/server.ma", "Pmax=? [F<1 \"error\"]", {0.455504});
+}
+
+TEST(MarkovAutomatonUnifPlusTest, IntelTbbSimple) {
+    checkUnifPlusWithIntelTbb(STORM_TEST_RESOURCES_DIR "/ma/simple.ma", "Pmin=? [F<1 s>2]; Pmax=? [F<1.3 s=3]", {0.6321205588, 0.727468207});
+}
+
+void checkTimePoints(std::string const& pathToPrismFile, std::string const& formulaAsString, std::vector<double> const& timePoints) {
+    storm::prism::Program program = storm::api::parseProgram(pathToPrismFile);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::MarkovAutomaton<double>>();
+    storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<double>> checker(*model);
+    ASSERT_EQ(1ul, formulas.size());
+
+    // Curves are always computed with IMCA, so the single time points are checked with IMCA as well.
+    storm::Environment env;
+    env.solver().timeBounded().setMaMethod(storm::solver::MaBoundedReachabilityMethod::Imca);
+    env.solver().timeBounded().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-5));
+    double const precision = 1e-4;
+
+    storm::logic::ProbabilityOperatorFormula const& formula = formulas.front()->asProbabilityOperatorFormula();
+    storm::logic::BoundedUntilFormula const& pathFormula = formula.getSubformula().asBoundedUntilFormula();
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formulas.front());
+    auto results = checker.computeBoundedUntilProbabilitiesForTimePoints(env, task.substituteFormula(pathFormula), timePoints);
+    ASSERT_EQ(timePoints.size(), results.size());
+    for (uint64_t i = 0; i < timePoints.size(); ++i) {
+        // Compare with the result of checking the formula with the time point as upper bound.
+        auto singleFormula = std::make_shared<storm::logic::BoundedUntilFormula>(
+            pathFormula.getLeftSubformula().asSharedPointer(), pathFormula.getRightSubformula().asSharedPointer(), boost::none,
+            storm::logic::TimeBound(false, program.getManager().rational(timePoints[i])), storm::logic::TimeBoundReference(storm::logic::TimeBoundType::Time));
+        auto expected = checker.computeBoundedUntilProbabilities(env, task.substituteFormula(*singleFormula));
+        auto const& expectedValues = expected->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        auto const& values = results[i]->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(expectedValues.size(), values.size());
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            EXPECT_NEAR(expectedValues[state], values[state], precision);
+        }
+    }
+}
+
+TEST(MarkovAutomatonTimePointsTest, Server) {
+    checkTimePoints(STORM_TEST_RESOURCES_DIR "/ma/server.ma", "Pmax=? [F<1 \"error\"]", {0.0, 0.5, 1.0, 2.0});
+}
+
+TEST(MarkovAutomatonTimePointsTest, Simple) {
+    checkTimePoints(STORM_TEST_RESOURCES_DIR "/ma/simple.ma", "Pmin=? [F<1 s>2]", {0.25, 1.0, 1.3});
+}
 }  // namespace
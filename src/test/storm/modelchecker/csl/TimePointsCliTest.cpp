@@ -0,0 +1,118 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "storm-cli-utilities/model-handling.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/settings/ArgumentBase.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/IOSettings.h"
+
+namespace {
+// Sets the given argument of the given I/O option (and marks the option as set) until the object is destroyed.
+class IOOptionSelection {
+   public:
+    IOOptionSelection(std::string const& optionName, std::string const& argumentName, std::string const& value) : argument(nullptr) {
+        auto& ioSettings = storm::settings::mutableManager().getModule(storm::settings::modules::IOSettings::moduleName);
+        for (auto const& option : ioSettings.getOptions()) {
+            if (option->getLongName() == optionName) {
+                argument = &option->getArgumentByName(argumentName);
+            }
+        }
+        EXPECT_NE(nullptr, argument);
+        if (argument != nullptr) {
+            previousValue = argument->getValueAsString();
+            EXPECT_TRUE(argument->setFromStringValue(value));
+        }
+        memento = ioSettings.overrideOption(optionName, true);
+    }
+
+    ~IOOptionSelection() {
+        memento.reset();
+        if (argument != nullptr) {
+            argument->setFromStringValue(previousValue);
+        }
+    }
+
+   private:
+    storm::settings::ArgumentBase* argument;
+    std::string previousValue;
+    std::unique_ptr<storm::settings::SettingMemento> memento;
+};
+
+std::vector<std::string> splitCsvLine(std::string const& line) {
+    std::vector<std::string> result;
+    std::stringstream stream(line);
+    std::string entry;
+    while (std::getline(stream, entry, ',')) {
+        result.push_back(entry);
+    }
+    return result;
+}
+
+TEST(TimePointsCliTest, WriteCurves) {
+    std::stringstream stream;
+    storm::cli::writeTimePointCurves<double>(stream, {0.0, 0.5}, {"a", "b"}, {{0.0, 0.25}, {1.0, 0.75}});
+    EXPECT_EQ("time,a,b\n0,0,1\n0.5,0.25,0.75\n", stream.str());
+}
+
+TEST(TimePointsCliTest, ExportCurveTandem) {
+    auto formulasForBound = [](std::string const& bound) {
+        return "P=? [ F<=" + bound + " \"network_full\" ]; P=? [\"second_queue_full\" U<=" + bound + " !\"second_queue_full\"]";
+    };
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/tandem5.sm", true);
+    storm::cli::SymbolicInput input;
+    input.properties = storm::api::parsePropertiesForPrismProgram(formulasForBound("10"), program);
+    auto formulas = storm::api::extractFormulasFromProperties(input.properties);
+    auto model = storm::api::buildSparseModel<double>(program, formulas);
+    storm::cli::ModelProcessingInformation mpi;
+
+    std::vector<double> const timePoints = {0.0, 0.5, 1.0, 5.0, 10.0};
+    std::string const filename = (std::filesystem::temp_directory_path() / "storm_test_timepoints_curve.csv").string();
+    {
+        IOOptionSelection timePointsSelection("timepoints", "values", "10,0.5,1,0,5");
+        IOOptionSelection exportCurveSelection("exportcurve", "filename", filename);
+        storm::cli::verifyTimePointsWithSparseEngine<double>(model, input, mpi);
+    }
+
+    std::ifstream stream(filename);
+    ASSERT_TRUE(stream.good());
+    std::string line;
+    ASSERT_TRUE(static_cast<bool>(std::getline(stream, line)));
+    EXPECT_EQ("time," + input.properties[0].getName() + "," + input.properties[1].getName(), line);
+
+    storm::modelchecker::ExplicitQualitativeCheckResult initialStates(model->getInitialStates());
+    for (auto const& timePoint : timePoints) {
+        ASSERT_TRUE(static_cast<bool>(std::getline(stream, line)));
+        auto entries = splitCsvLine(line);
+        ASSERT_EQ(3ul, entries.size());
+        EXPECT_NEAR(timePoint, std::stod(entries[0]), 1e-9);
+
+        // Compare with the result of checking the properties with the time point as upper bound.
+        std::stringstream bound;
+        bound << timePoint;
+        auto singleFormulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasForBound(bound.str()), program));
+        ASSERT_EQ(2ul, singleFormulas.size());
+        for (uint64_t index = 0; index < singleFormulas.size(); ++index) {
+            auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(singleFormulas[index], true));
+            result->filter(initialStates);
+            EXPECT_NEAR(result->asQuantitativeCheckResult<double>().getMin(), std::stod(entries[index + 1]), 1e-6);
+        }
+    }
+    EXPECT_FALSE(static_cast<bool>(std::getline(stream, line)));
+    stream.close();
+    std::filesystem::remove(filename);
+}
+}  // namespace
@@ -7,6 +7,7 @@
 #include "storm/api/builder.h"
 #include "storm/api/properties.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
@@ -23,6 +24,8 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/jani/Property.h"
 
@@ -298,6 +301,21 @@ class HybridSylvanDoubleValueIterationEnvironment {
         return env;
     }
 };
+class HybridSylvanDoubleSccValueIterationEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
+    static const MdpEngine engine = MdpEngine::Hybrid;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::symbolic::Mdp<ddType, ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.modelchecker().setHybridSccDecomposition(true);
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        return env;
+    }
+};
 class HybridCuddDoubleSoundValueIterationEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
@@ -421,6 +439,15 @@ class MdpPrctlModelCheckerTest : public ::testing::Test {
     typedef typename storm::models::symbolic::Mdp<TestType::ddType, ValueType> SymbolicModelType;
 
     MdpPrctlModelCheckerTest() : _environment(TestType::createEnvironment()) {}
+    void SetUp() override {
+        // The SCCs of a layer are only solved concurrently if TBB is enabled.
+        if (std::is_same<TestType, HybridSylvanDoubleSccValueIterationEnvironment>::value) {
+            _useIntelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        }
+    }
+    void TearDown() override {
+        _useIntelTbb.reset();
+    }
     storm::Environment const& env() const {
         return _environment;
     }
@@ -518,6 +545,7 @@ class MdpPrctlModelCheckerTest : public ::testing::Test {
 
    private:
     storm::Environment _environment;
+    std::unique_ptr<storm::settings::SettingMemento> _useIntelTbb;
 
     std::unique_ptr<storm::modelchecker::QualitativeCheckResult> getInitialStateFilter(std::shared_ptr<storm::models::Model<ValueType>> const& model) const {
         if (isSparseModel()) {
@@ -535,7 +563,8 @@ typedef ::testing::Types<SparseDoubleValueIterationGmmxxGaussSeidelMultEnvironme
                          SparseDoubleSoundValueIterationEnvironment, SparseDoubleOptimisticValueIterationEnvironment,
                          SparseDoubleTopologicalValueIterationEnvironment, SparseDoubleTopologicalSoundValueIterationEnvironment, SparseDoubleLPEnvironment,
                          SparseRationalPolicyIterationEnvironment, SparseRationalViToPiEnvironment, SparseRationalRationalSearchEnvironment,
-                         HybridCuddDoubleValueIterationEnvironment, HybridSylvanDoubleValueIterationEnvironment, HybridCuddDoubleSoundValueIterationEnvironment,
+                         HybridCuddDoubleValueIterationEnvironment, HybridSylvanDoubleValueIterationEnvironment,
+                         HybridSylvanDoubleSccValueIterationEnvironment, HybridCuddDoubleSoundValueIterationEnvironment,
                          HybridCuddDoubleOptimisticValueIterationEnvironment, HybridSylvanRationalPolicyIterationEnvironment,
                          DdCuddDoubleValueIterationEnvironment, JaniDdCuddDoubleValueIterationEnvironment, DdSylvanDoubleValueIterationEnvironment,
                          DdCuddDoublePolicyIterationEnvironment, DdSylvanRationalRationalSearchEnvironment>
@@ -1,10 +1,17 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <limits>
+#include <sstream>
+
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/io/DirectEncodingExporter.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 TEST(DirectEncodingParserTest, DtmcParsing) {
     std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
@@ -44,6 +51,40 @@ TEST(DirectEncodingParserTest, MdpParsing) {
     ASSERT_TRUE(!modelPtr->getRewardModel("coinflips").isAllZero());
 }
 
+TEST(DirectEncodingParserTest, MdpParsingInChunks) {
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+
+    // Enable Intel TBB and derive the parser options from the settings as done by the command line interface.
+    std::unique_ptr<storm::settings::SettingMemento> useIntelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+    storm::parser::DirectEncodingParserOptions options;
+    options.parseValuesInParallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+    options.transitionsPerChunk = 7;
+    std::shared_ptr<storm::models::sparse::Model<double>> chunkedModelPtr =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", options);
+
+    ASSERT_EQ(storm::models::ModelType::Mdp, chunkedModelPtr->getType());
+    ASSERT_EQ(modelPtr->getNumberOfStates(), chunkedModelPtr->getNumberOfStates());
+    ASSERT_EQ(modelPtr->getNumberOfChoices(), chunkedModelPtr->getNumberOfChoices());
+    EXPECT_EQ(modelPtr->getTransitionMatrix(), chunkedModelPtr->getTransitionMatrix());
+    EXPECT_EQ(modelPtr->getStates("six"), chunkedModelPtr->getStates("six"));
+}
+
+TEST(DirectEncodingParserTest, ExportDoubles) {
+    std::vector<double> values = {0.0, 1.0, -2.5, 0.1, 1.0 / 3.0, 1e-300, 123456789.0, std::numeric_limits<double>::infinity()};
+    for (std::streamsize precision : {6, 12, 17}) {
+        for (double value : values) {
+            std::ostringstream expected;
+            expected.precision(precision);
+            expected << value;
+            std::ostringstream actual;
+            actual.precision(precision);
+            storm::exporter::writeDouble(actual, value);
+            EXPECT_EQ(expected.str(), actual.str());
+        }
+    }
+}
+
 TEST(DirectEncodingParserTest, CtmcParsing) {
     std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
         storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
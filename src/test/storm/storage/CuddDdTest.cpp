@@ -1,6 +1,8 @@
 #include "storm-config.h"
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/DdMetaVariable.h"
@@ -11,6 +13,10 @@
 
 #include "storm/storage/SparseMatrix.h"
 
+#include <algorithm>
+#include <memory>
+#include <numeric>
+
 TEST(CuddDd, AddConstants) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     storm::dd::Add<storm::dd::DdType::CUDD, double> zero;
@@ -701,6 +707,59 @@ TEST(CuddDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+#ifdef STORM_HAVE_INTELTBB
+TEST(CuddDd, AddParallelToMatrixTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 100);
+
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd =
+        manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(x.second)).template toAdd<double>() *
+        manager->getRange(x.first).template toAdd<double>();
+    dd += manager->getEncoding(x.first, 1).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>() *
+          manager->template getConstant<double>(2);
+    dd += manager->getEncoding(x.second, 100).template toAdd<double>() * manager->template getIdentity<double>(x.first);
+
+    storm::dd::Odd rowOdd = manager->getRange(x.first).template toAdd<double>().createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).template toAdd<double>().createOdd();
+    storm::storage::SparseMatrix<double> matrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+
+    std::vector<uint_fast64_t> ddRowVariableIndices;
+    std::vector<uint_fast64_t> ddColumnVariableIndices;
+    for (auto const& ddVariable : manager->getMetaVariable(x.first).getDdVariables()) {
+        ddRowVariableIndices.push_back(ddVariable.getIndex());
+    }
+    for (auto const& ddVariable : manager->getMetaVariable(x.second).getDdVariables()) {
+        ddColumnVariableIndices.push_back(ddVariable.getIndex());
+    }
+    std::sort(ddRowVariableIndices.begin(), ddRowVariableIndices.end());
+    std::sort(ddColumnVariableIndices.begin(), ddColumnVariableIndices.end());
+
+    // Fill the entries concurrently using the row indications of the sequentially built matrix.
+    std::vector<uint_fast64_t> rowGroupIndices(matrix.getRowCount() + 1);
+    std::iota(rowGroupIndices.begin(), rowGroupIndices.end(), 0);
+    std::vector<uint_fast64_t> rowIndications(matrix.getRowCount() + 1);
+    for (uint_fast64_t row = 0; row < matrix.getRowCount(); ++row) {
+        rowIndications[row] = matrix.begin(row) - matrix.begin();
+    }
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, double>> columnsAndValues(matrix.getEntryCount());
+    dd.getInternalAdd().toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices,
+                                           ddColumnVariableIndices, true, true);
+
+    uint_fast64_t position = 0;
+    for (uint_fast64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            EXPECT_EQ(entry.getColumn(), columnsAndValues[position].getColumn());
+            EXPECT_EQ(entry.getValue(), columnsAndValues[position].getValue());
+            ++position;
+        }
+    }
+
+    // The conversion fills the entries concurrently once TBB is enabled.
+    std::unique_ptr<storm::settings::SettingMemento> useIntelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+    EXPECT_EQ(matrix, dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd));
+}
+#endif
+
 TEST(CuddDd, BddOddTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
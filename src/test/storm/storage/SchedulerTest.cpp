@@ -50,3 +50,42 @@ TEST(SchedulerTest, PartialDeterministicMemorylessScheduler) {
     ASSERT_FALSE(scheduler.getChoice(1).isDefined());
     ASSERT_FALSE(scheduler.getChoice(2).isDefined());
 }
+
+TEST(SchedulerTest, CompactChoicesWithLargeIndices) {
+    storm::storage::Scheduler<double> scheduler(3);
+
+    ASSERT_NO_THROW(scheduler.setChoice(1, 0));
+    ASSERT_NO_THROW(scheduler.setChoice(1000, 1));
+    ASSERT_NO_THROW(scheduler.setChoice(123456789ull, 2));
+
+    ASSERT_FALSE(scheduler.isPartialScheduler());
+    ASSERT_TRUE(scheduler.isDeterministicScheduler());
+    ASSERT_EQ(1ul, scheduler.getChoice(0).getDeterministicChoice());
+    ASSERT_EQ(1000ul, scheduler.getChoice(1).getDeterministicChoice());
+    ASSERT_EQ(123456789ul, scheduler.getChoice(2).getDeterministicChoice());
+
+    ASSERT_NO_THROW(scheduler.clearChoice(1));
+    ASSERT_TRUE(scheduler.isPartialScheduler());
+    ASSERT_FALSE(scheduler.getChoice(1).isDefined());
+    ASSERT_EQ(123456789ul, scheduler.getChoice(2).getDeterministicChoice());
+}
+
+TEST(SchedulerTest, RandomizedChoiceAfterDeterministicChoices) {
+    storm::storage::Scheduler<double> scheduler(3);
+
+    ASSERT_NO_THROW(scheduler.setChoice(2, 0));
+    ASSERT_NO_THROW(scheduler.setChoice(7, 1));
+    ASSERT_TRUE(scheduler.isDeterministicScheduler());
+
+    storm::storage::Distribution<double, uint_fast64_t> distribution;
+    distribution.addProbability(0, 0.5);
+    distribution.addProbability(1, 0.5);
+    ASSERT_NO_THROW(scheduler.setChoice(distribution, 2));
+
+    ASSERT_FALSE(scheduler.isPartialScheduler());
+    ASSERT_FALSE(scheduler.isDeterministicScheduler());
+    ASSERT_EQ(2ul, scheduler.getChoice(0).getDeterministicChoice());
+    ASSERT_EQ(7ul, scheduler.getChoice(1).getDeterministicChoice());
+    ASSERT_FALSE(scheduler.getChoice(2).isDeterministic());
+    ASSERT_EQ(2ul, scheduler.getChoice(2).getChoiceAsDistribution().size());
+}
@@ -3,7 +3,10 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/SylvanSettings.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/DdMetaVariable.h"
@@ -11,8 +14,10 @@
 
 #include "storm/storage/SparseMatrix.h"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <numeric>
 
 TEST(SylvanDd, Constants) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
@@ -828,6 +833,100 @@ TEST(SylvanDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+#ifdef STORM_HAVE_INTELTBB
+TEST(SylvanDd, AddParallelToMatrixTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 100);
+
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd =
+        manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(x.second)).template toAdd<double>() *
+        manager->getRange(x.first).template toAdd<double>();
+    dd += manager->getEncoding(x.first, 1).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>() *
+          manager->template getConstant<double>(2);
+    dd += manager->getEncoding(x.second, 100).template toAdd<double>() * manager->template getIdentity<double>(x.first);
+
+    storm::dd::Odd rowOdd = manager->getRange(x.first).template toAdd<double>().createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).template toAdd<double>().createOdd();
+    storm::storage::SparseMatrix<double> matrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+
+    std::vector<uint_fast64_t> ddRowVariableIndices;
+    std::vector<uint_fast64_t> ddColumnVariableIndices;
+    for (auto const& ddVariable : manager->getMetaVariable(x.first).getDdVariables()) {
+        ddRowVariableIndices.push_back(ddVariable.getIndex());
+    }
+    for (auto const& ddVariable : manager->getMetaVariable(x.second).getDdVariables()) {
+        ddColumnVariableIndices.push_back(ddVariable.getIndex());
+    }
+    std::sort(ddRowVariableIndices.begin(), ddRowVariableIndices.end());
+    std::sort(ddColumnVariableIndices.begin(), ddColumnVariableIndices.end());
+
+    // Fill the entries concurrently using the row indications of the sequentially built matrix.
+    std::vector<uint_fast64_t> rowGroupIndices(matrix.getRowCount() + 1);
+    std::iota(rowGroupIndices.begin(), rowGroupIndices.end(), 0);
+    std::vector<uint_fast64_t> rowIndications(matrix.getRowCount() + 1);
+    for (uint_fast64_t row = 0; row < matrix.getRowCount(); ++row) {
+        rowIndications[row] = matrix.begin(row) - matrix.begin();
+    }
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, double>> columnsAndValues(matrix.getEntryCount());
+    dd.getInternalAdd().toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices,
+                                           ddColumnVariableIndices, true, true);
+
+    uint_fast64_t position = 0;
+    for (uint_fast64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            EXPECT_EQ(entry.getColumn(), columnsAndValues[position].getColumn());
+            EXPECT_EQ(entry.getValue(), columnsAndValues[position].getValue());
+            ++position;
+        }
+    }
+
+    // The conversion fills the entries concurrently once TBB is enabled.
+    std::unique_ptr<storm::settings::SettingMemento> useIntelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+    EXPECT_EQ(matrix, dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd));
+}
+#endif
+
+TEST(SylvanDd, TraversalStatisticsTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    // The DD has to be large enough to be traversed by several tasks.
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 8191);
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> identity = manager->template getIdentity<double>(x.first);
+    storm::dd::SylvanTraversalStatistics& statistics = storm::dd::InternalDdManager<storm::dd::DdType::Sylvan>::getTraversalStatistics();
+
+    auto countVisitedNodes = [&statistics, &identity]() {
+        std::vector<uint64_t> visitedNodesBefore = statistics.getVisitedNodesPerWorker();
+        std::vector<double> ddAsVector = identity.toVector();
+        std::vector<uint64_t> visitedNodesAfter = statistics.getVisitedNodesPerWorker();
+
+        EXPECT_EQ(8192ul, ddAsVector.size());
+        for (uint_fast64_t i = 0; i < ddAsVector.size(); ++i) {
+            EXPECT_EQ(static_cast<double>(i), ddAsVector[i]);
+        }
+
+        EXPECT_EQ(visitedNodesBefore.size(), visitedNodesAfter.size());
+        uint64_t visitedNodes = 0;
+        for (uint64_t worker = 0; worker < visitedNodesAfter.size(); ++worker) {
+            visitedNodes += visitedNodesAfter[worker] - visitedNodesBefore[worker];
+        }
+        return visitedNodes;
+    };
+
+    // Statistics are only recorded if they are printed.
+    {
+        std::unique_ptr<storm::settings::SettingMemento> printStatistics =
+            dynamic_cast<storm::settings::modules::SylvanSettings&>(storm::settings::mutableManager().getModule(storm::settings::modules::SylvanSettings::moduleName))
+                .overridePrintStatisticsSet(false);
+        EXPECT_EQ(0ul, countVisitedNodes());
+    }
+    {
+        std::unique_ptr<storm::settings::SettingMemento> printStatistics =
+            dynamic_cast<storm::settings::modules::SylvanSettings&>(storm::settings::mutableManager().getModule(storm::settings::modules::SylvanSettings::moduleName))
+                .overridePrintStatisticsSet(true);
+        // Every node of the identity DD is visited (at least) once.
+        EXPECT_LE(identity.getNodeCount(), countVisitedNodes());
+    }
+}
+
 TEST(SylvanDd, AddSharpenTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
@@ -951,3 +1050,19 @@ TEST(SylvanDd, BddToExpressionTest) {
 
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(SylvanDd, MemoryStatistics) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd = manager->template getIdentity<double>(x.first);
+    EXPECT_LE(dd.getNodeCount(), manager->getNumberOfNodes());
+    EXPECT_LT(0ul, manager->getMemoryInUse());
+
+    // Garbage collection must not touch DDs that are still referenced.
+    ASSERT_NO_THROW(manager->performGarbageCollection());
+    EXPECT_LE(dd.getNodeCount(), manager->getNumberOfNodes());
+    EXPECT_EQ(45, dd.sumAbstract({x.first}).getValue());
+
+    ASSERT_NO_THROW(manager->finishPhase("test"));
+}
@@ -28,6 +28,55 @@
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 
+#include "storm/settings/ArgumentBase.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
+#include "storm/storage/dd/bisimulation/Partition.h"
+#include "storm/storage/dd/bisimulation/PreservationInformation.h"
+#include "storm/storage/dd/bisimulation/SignatureComputer.h"
+#include "storm/storage/dd/bisimulation/SignatureRefiner.h"
+
+namespace {
+// Selects the refinement mode of the symbolic bisimulation (see --bisimulation:refine) until the object is destroyed.
+class RefinementModeSelection {
+   public:
+    RefinementModeSelection(std::string const& mode) : argument(nullptr) {
+        auto& bisimulationSettings = storm::settings::mutableManager().getModule(storm::settings::modules::BisimulationSettings::moduleName);
+        for (auto const& option : bisimulationSettings.getOptions()) {
+            if (option->getLongName() == "refine") {
+                argument = &option->getArgumentByName("mode");
+            }
+        }
+        EXPECT_NE(nullptr, argument);
+        if (argument != nullptr) {
+            previousMode = argument->getValueAsString();
+            EXPECT_TRUE(argument->setFromStringValue(mode));
+        }
+    }
+
+    ~RefinementModeSelection() {
+        if (argument != nullptr) {
+            argument->setFromStringValue(previousMode);
+        }
+    }
+
+   private:
+    storm::settings::ArgumentBase* argument;
+    std::string previousMode;
+};
+
+template<storm::dd::DdType DdType>
+std::shared_ptr<storm::models::Model<double>> computeQuotient(storm::models::symbolic::Model<DdType, double> const& model,
+                                                              std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+                                                              std::string const& refinementMode) {
+    RefinementModeSelection refinementModeSelection(refinementMode);
+    storm::dd::BisimulationDecomposition<DdType, double> decomposition(model, formulas, storm::storage::BisimulationType::Strong);
+    decomposition.compute();
+    return decomposition.getQuotient(storm::dd::bisimulation::QuotientFormat::Dd);
+}
+}  // namespace
+
 TEST(SymbolicModelBisimulationDecomposition, Die_Cudd) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
 
@@ -495,3 +544,67 @@ TEST(SymbolicModelBisimulationDecomposition, AsynchronousLeader_Sylvan) {
     EXPECT_TRUE(quotient->isSymbolicModel());
     EXPECT_EQ(2152ul, (quotient->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan, double>>()->getNumberOfChoices()));
 }
+
+TEST(SymbolicModelBisimulationDecomposition, ChangedStatesRefinement_Sylvan) {
+    // Restricting the signatures to the states that changed their block has to yield the same quotient as the full refinement.
+    storm::parser::FormulaParser formulaParser;
+    auto checkModes = [](storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double> const& model,
+                         std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+        std::shared_ptr<storm::models::Model<double>> fullQuotient = computeQuotient(model, formulas, "full");
+        std::shared_ptr<storm::models::Model<double>> changedQuotient = computeQuotient(model, formulas, "changed");
+        EXPECT_EQ(fullQuotient->getNumberOfStates(), changedQuotient->getNumberOfStates());
+        EXPECT_EQ(fullQuotient->getNumberOfTransitions(), changedQuotient->getNumberOfTransitions());
+        EXPECT_EQ(fullQuotient->getType(), changedQuotient->getType());
+    };
+
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(program);
+    checkModes(*model, {formulaParser.parseSingleFormulaFromString("P=? [F \"two\"]")});
+
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(program);
+    checkModes(*model, {formulaParser.parseSingleFormulaFromString("Pmin=? [F \"two\"]")});
+
+    // The initial partition is refined with respect to the rewards, so the first refinement step has to use the full signatures.
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+    smd = smd.preprocess();
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Rmax=? [F \"elected\"]");
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(smd.asPrismProgram(), *formula);
+    std::shared_ptr<storm::models::Model<double>> changedQuotient = computeQuotient(*model, {formula}, "changed");
+    EXPECT_EQ(1107ul, changedQuotient->getNumberOfStates());
+    EXPECT_EQ(2684ul, changedQuotient->getNumberOfTransitions());
+    checkModes(*model, {formula});
+}
+
+TEST(SymbolicModelBisimulationDecomposition, SignatureTableGrowth_Sylvan) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(program);
+    storm::dd::bisimulation::Partition<storm::dd::DdType::Sylvan, double> initialPartition = storm::dd::bisimulation::Partition<storm::dd::DdType::Sylvan, double>::create(
+        *model, storm::storage::BisimulationType::Strong, storm::dd::bisimulation::PreservationInformation<storm::dd::DdType::Sylvan, double>(*model));
+
+    auto computeNumberOfBlocks = [&model, &initialPartition](uint64_t initialTableCapacity) {
+        storm::dd::bisimulation::InternalSignatureRefinerOptions options(true);
+        options.initialTableCapacity = initialTableCapacity;
+        storm::dd::bisimulation::SignatureComputer<storm::dd::DdType::Sylvan, double> signatureComputer(*model);
+        storm::dd::bisimulation::SignatureRefiner<storm::dd::DdType::Sylvan, double> signatureRefiner(
+            model->getManager(), initialPartition.getBlockVariable(), model->getRowVariables(), model->getColumnVariables(), model->getNondeterminismVariables(),
+            options);
+
+        storm::dd::bisimulation::Partition<storm::dd::DdType::Sylvan, double> partition = initialPartition;
+        while (true) {
+            storm::dd::bisimulation::Partition<storm::dd::DdType::Sylvan, double> newPartition =
+                signatureRefiner.refine(partition, signatureComputer.compute(partition).next());
+            if (newPartition.getNumberOfBlocks() == partition.getNumberOfBlocks()) {
+                return partition.getNumberOfBlocks();
+            }
+            partition = newPartition;
+        }
+    };
+
+    // A table with only four entries has to grow (and rehash its entries) during the refinement.
+    uint64_t numberOfBlocks = computeNumberOfBlocks(1ull << 20);
+    EXPECT_LT(4ul, numberOfBlocks);
+    EXPECT_EQ(numberOfBlocks, computeNumberOfBlocks(4));
+}
@@ -0,0 +1,57 @@
+#include "storm-config.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/transformer/SparseStateOrder.h"
+#include "test/storm_gtest.h"
+
+namespace {
+std::vector<storm::transformer::SparseStateOrder> const stateOrders = {
+    storm::transformer::SparseStateOrder::Odd, storm::transformer::SparseStateOrder::Bfs, storm::transformer::SparseStateOrder::ReverseCuthillMcKee};
+
+double getResultAtInitialState(std::shared_ptr<storm::models::sparse::Model<double>> const& model,
+                               std::shared_ptr<storm::logic::Formula const> const& formula) {
+    auto result = storm::api::verifyWithSparseEngine(model, storm::api::createTask<double>(formula, true));
+    return result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()];
+}
+}  // namespace
+
+TEST(SymbolicToSparseTransformerTest, DtmcStateOrders) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::string formulasString = "P=? [F \"two\"]; R{\"coin_flips\"}=? [F \"done\"]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto symbolicModel = storm::api::buildSymbolicModel<storm::dd::DdType::Sylvan, double>(program, formulas);
+
+    for (auto const& stateOrder : stateOrders) {
+        auto model = storm::api::transformSymbolicToSparseModel(symbolicModel, formulas, stateOrder);
+        EXPECT_EQ(13ul, model->getNumberOfStates());
+        EXPECT_EQ(20ul, model->getNumberOfTransitions());
+        EXPECT_EQ(1ul, model->getInitialStates().getNumberOfSetBits());
+        EXPECT_EQ(1ul, model->getStates("two").getNumberOfSetBits());
+        if (stateOrder == storm::transformer::SparseStateOrder::Bfs) {
+            EXPECT_TRUE(model->getInitialStates().get(0));
+        }
+
+        EXPECT_NEAR(1.0 / 6.0, getResultAtInitialState(model, formulas[0]), 1e-6);
+        EXPECT_NEAR(11.0 / 3.0, getResultAtInitialState(model, formulas[1]), 1e-6);
+    }
+}
+
+TEST(SymbolicToSparseTransformerTest, MdpStateOrders) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::string formulasString = "Pmin=? [F \"two\"]; Rmin=? [F \"done\"]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto symbolicModel = storm::api::buildSymbolicModel<storm::dd::DdType::Sylvan, double>(program, formulas);
+
+    for (auto const& stateOrder : stateOrders) {
+        auto model = storm::api::transformSymbolicToSparseModel(symbolicModel, formulas, stateOrder);
+        EXPECT_EQ(169ul, model->getNumberOfStates());
+        EXPECT_EQ(436ul, model->getNumberOfTransitions());
+        EXPECT_EQ(254ul, model->getNumberOfChoices());
+
+        EXPECT_NEAR(1.0 / 36.0, getResultAtInitialState(model, formulas[0]), 1e-6);
+        EXPECT_NEAR(22.0 / 3.0, getResultAtInitialState(model, formulas[1]), 1e-6);
+    }
+}
@@ -0,0 +1,41 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/utility/resources.h"
+
+TEST(ResourcesTest, CgroupMemoryLimitFilesV2) {
+    std::string processCgroups = "0::/user.slice/user-1000.slice/session-2.scope\n";
+    std::vector<std::string> expected = {"/sys/fs/cgroup/user.slice/user-1000.slice/session-2.scope/memory.max",
+                                         "/sys/fs/cgroup/user.slice/user-1000.slice/memory.max", "/sys/fs/cgroup/user.slice/memory.max",
+                                         "/sys/fs/cgroup/memory.max"};
+    EXPECT_EQ(expected, storm::utility::resources::getCgroupMemoryLimitFiles(processCgroups));
+
+    // Processes in the root control group (e.g. in a container with its own cgroup namespace) only see the limit of the root.
+    EXPECT_EQ(std::vector<std::string>({"/mnt/cgroup/memory.max"}), storm::utility::resources::getCgroupMemoryLimitFiles("0::/\n", "/mnt/cgroup"));
+}
+
+TEST(ResourcesTest, CgroupMemoryLimitFilesV1) {
+    std::string processCgroups =
+        "12:pids:/docker/abc\n"
+        "11:cpu,cpuacct:/docker/abc\n"
+        "10:hugetlb,memory:/docker/abc\n"
+        "1:name=systemd:/docker/abc\n";
+    std::vector<std::string> expected = {"/sys/fs/cgroup/memory/docker/abc/memory.limit_in_bytes", "/sys/fs/cgroup/memory/docker/memory.limit_in_bytes",
+                                         "/sys/fs/cgroup/memory/memory.limit_in_bytes"};
+    EXPECT_EQ(expected, storm::utility::resources::getCgroupMemoryLimitFiles(processCgroups));
+}
+
+TEST(ResourcesTest, CgroupMemoryLimitFilesHybrid) {
+    // In the hybrid mode, the memory controller is attached to the v1 hierarchy, but the unified hierarchy is listed as well.
+    std::string processCgroups =
+        "5:memory:/user.slice\n"
+        "1:name=systemd:/user.slice/session-2.scope\n"
+        "0::/user.slice/session-2.scope\n";
+    std::vector<std::string> expected = {"/sys/fs/cgroup/memory/user.slice/memory.limit_in_bytes", "/sys/fs/cgroup/memory/memory.limit_in_bytes",
+                                         "/sys/fs/cgroup/user.slice/session-2.scope/memory.max", "/sys/fs/cgroup/user.slice/memory.max",
+                                         "/sys/fs/cgroup/memory.max"};
+    EXPECT_EQ(expected, storm::utility::resources::getCgroupMemoryLimitFiles(processCgroups));
+
+    EXPECT_TRUE(storm::utility::resources::getCgroupMemoryLimitFiles("").empty());
+    EXPECT_TRUE(storm::utility::resources::getCgroupMemoryLimitFiles("malformed line\n").empty());
+}